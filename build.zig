@@ -519,6 +519,21 @@ fn buildBinary(
                 .file = "pkg/noun/hashtable_tests.c",
                 .deps = noun_test_deps,
             },
+            .{
+                .name = "hashtable-bench",
+                .file = "pkg/noun/hashtable_bench.c",
+                .deps = noun_test_deps,
+            },
+            .{
+                .name = "pack-test",
+                .file = "pkg/noun/pack_tests.c",
+                .deps = noun_test_deps,
+            },
+            .{
+                .name = "events-bench",
+                .file = "pkg/noun/events_bench.c",
+                .deps = noun_test_deps,
+            },
             .{
                 .name = "hamt-test",
                 .file = "pkg/vere/hamt_test.c",
@@ -570,6 +585,16 @@ fn buildBinary(
                 .file = "pkg/vere/unix_tests.c",
                 .deps = vere_test_deps,
             },
+            .{
+                .name = "book-test",
+                .file = "pkg/vere/book_tests.c",
+                .deps = vere_test_deps,
+            },
+            .{
+                .name = "dict-test",
+                .file = "pkg/vere/dict_tests.c",
+                .deps = vere_test_deps,
+            },
             .{
                 .name = "benchmarks",
                 .file = "pkg/vere/benchmarks.c",
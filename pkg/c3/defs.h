@@ -64,6 +64,12 @@
 #     error  "port me"
 #endif
 
+#if   (64 == (CHAR_BIT * __SIZEOF_LONG_LONG__))
+#     define c3_tz_d __builtin_ctzll
+#else
+#     error  "port me"
+#endif
+
 #     define c3_bits_word(w) ((w) ? (32 - c3_lz_w(w)) : 0)
 
     /* Min and max.
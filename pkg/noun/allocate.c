@@ -2,6 +2,10 @@
 
 #include "allocate.h"
 
+#include <errno.h>
+#include <pthread.h>
+
+#include "events.h"
 #include "hashtable.h"
 #include "log.h"
 #include "manage.h"
@@ -9,6 +13,7 @@
 #include "retrieve.h"
 #include "trace.h"
 #include "vortex.h"
+#include "zave.h"
 
 u3_road* u3a_Road;
 
@@ -188,6 +193,9 @@ _box_detach(u3a_box* box_u)
   }
 }
 
+static c3_o
+_ca_slab_free(u3a_box* box_u);
+
 /* _box_free(): free and coalesce.
 */
 static void
@@ -203,6 +211,12 @@ _box_free(u3a_box* box_u)
 
   _box_vaal(box_u);
 
+  //  slab slots are returned to their page, never coalesced
+  //
+  if ( c3y == _ca_slab_free(box_u) ) {
+    return;
+  }
+
 #if 0
   /* Clear the contents of the block, for debugging.
   */
@@ -425,12 +439,11 @@ _ca_reclaim_half(void)
   fprintf(stderr, "allocate: reclaim: half of %d entries\r\n",
           u3to(u3h_root, u3R->cax.har_p)->use_w);
 
-  u3h_trim_to(u3R->cax.har_p, u3to(u3h_root, u3R->cax.har_p)->use_w / 2);
+  u3z_trim(u3z_memo_toss, u3to(u3h_root, u3R->cax.har_p)->use_w / 2);
 #else
   /*  brutal and guaranteed effective
   */
-  u3h_free(u3R->cax.har_p);
-  u3R->cax.har_p = u3h_new();
+  u3z_free(u3z_memo_toss);
 #endif
 }
 
@@ -595,6 +608,29 @@ _ca_walloc(c3_w len_w, c3_w ald_w, c3_w off_w)
 {
   void* ptr_v;
 
+  //  sand roads only bump the hat; nothing is freed, so nothing to reclaim
+  //
+  if ( u3R->how.fag_w & u3a_flag_sand ) {
+    c3_w     siz_w = c3_max(u3a_minimum, u3a_boxed(len_w));
+    u3a_box* box_u = 0;
+
+    //  stop two pages short of the cap, so that running out is a bail
+    //  to the road's owner rather than a fault on the guard page
+    //
+    if ( u3a_open(u3R) > (siz_w + ald_w + (2U << u3a_page)) ) {
+      box_u = _ca_box_make_hat(siz_w, ald_w, off_w, 1);
+    }
+
+    //  out of sand: the bail itself must allocate, so let it carve
+    //  up the emergency buffer it releases (and not a new slab page)
+    //
+    if ( 0 == box_u ) {
+      u3R->how.fag_w &= ~(u3a_flag_sand | u3a_flag_slab);
+      u3m_bail(c3__meme);
+    }
+    return u3a_boxto(box_u);
+  }
+
   for (;;) {
     ptr_v = _ca_willoc(len_w, ald_w, off_w);
     if ( 0 != ptr_v ) {
@@ -606,6 +642,180 @@ _ca_walloc(c3_w len_w, c3_w ald_w, c3_w off_w)
   return ptr_v;
 }
 
+/* _ca_slab_class(): slab size class for box size [siz_w].
+*/
+static inline c3_w
+_ca_slab_class(c3_w siz_w)
+{
+  return (siz_w - u3a_minimum) >> 1;
+}
+
+/* _ca_slab_slot(): the first slot box in [sab_u].
+*/
+static inline c3_w*
+_ca_slab_slot(u3a_slab* sab_u)
+{
+  return (c3_w*)(void*)(sab_u + 1);
+}
+
+/* _ca_slab_of(): the slab page containing [box_u], if any.
+*/
+static inline u3a_slab*
+_ca_slab_of(u3a_box* box_u)
+{
+  c3_w siz_w = box_u->siz_w;
+
+  if ( siz_w <= u3a_slab_max ) {
+    c3_w tag_w = ((c3_w*)(void*)box_u)[siz_w - 1];
+
+    if ( tag_w & 0x80000000 ) {
+      return u3to(u3a_slab, tag_w & 0x7fffffff);
+    }
+  }
+
+  return 0;
+}
+
+/* _ca_slab_link(): push [sab_u] onto the page list [lis_p].
+*/
+static void
+_ca_slab_link(u3p(u3a_slab)* lis_p, u3a_slab* sab_u)
+{
+  u3p(u3a_slab) sab_p = u3of(u3a_slab, sab_u);
+
+  sab_u->pre_p = 0;
+  sab_u->nex_p = *lis_p;
+
+  if ( sab_u->nex_p ) {
+    u3to(u3a_slab, sab_u->nex_p)->pre_p = sab_p;
+  }
+  *lis_p = sab_p;
+}
+
+/* _ca_slab_unlink(): remove [sab_u] from the page list [lis_p].
+*/
+static void
+_ca_slab_unlink(u3p(u3a_slab)* lis_p, u3a_slab* sab_u)
+{
+  if ( sab_u->nex_p ) {
+    u3to(u3a_slab, sab_u->nex_p)->pre_p = sab_u->pre_p;
+  }
+  if ( sab_u->pre_p ) {
+    u3to(u3a_slab, sab_u->pre_p)->nex_p = sab_u->nex_p;
+  }
+  else {
+    u3_assert( *lis_p == u3of(u3a_slab, sab_u) );
+    *lis_p = sab_u->nex_p;
+  }
+
+  sab_u->pre_p = sab_u->nex_p = 0;
+}
+
+/* _ca_slab_free(): if [box_u] is a slab slot, release it to its page.
+*/
+static c3_o
+_ca_slab_free(u3a_box* box_u)
+{
+  u3a_slab* sab_u = _ca_slab_of(box_u);
+
+  if ( !sab_u ) {
+    return c3n;
+  }
+  else {
+    c3_w cla_w = _ca_slab_class(sab_u->siz_w);
+    c3_w sot_w = ((c3_w*)(void*)box_u - _ca_slab_slot(sab_u)) / sab_u->siz_w;
+
+    c3_dessert( sot_w < sab_u->hig_w );
+    c3_dessert( !(sab_u->map_w[sot_w >> 5] & (1U << (sot_w & 31))) );
+
+    sab_u->map_w[sot_w >> 5] |= (1U << (sot_w & 31));
+
+    //  a full page has free slots again
+    //
+    if ( sab_u->num_w == sab_u->use_w-- ) {
+      _ca_slab_unlink(&(u3R->sab.ful_p[cla_w]), sab_u);
+      _ca_slab_link(&(u3R->sab.par_p[cla_w]), sab_u);
+    }
+    //  release an empty page, unless it's the only one left
+    //
+    else if (  !sab_u->use_w
+            && (sab_u->pre_p || sab_u->nex_p) )
+    {
+      _ca_slab_unlink(&(u3R->sab.par_p[cla_w]), sab_u);
+      u3a_wfree(sab_u);
+    }
+
+    return c3y;
+  }
+}
+
+/* _ca_slab_make(): allocate a slab page for boxes of [siz_w] words.
+*/
+static u3a_slab*
+_ca_slab_make(c3_w siz_w)
+{
+  u3a_slab* sab_u = _ca_walloc(u3a_slab_page, 1, 0);
+
+  memset(sab_u, 0, sizeof(*sab_u));
+  sab_u->siz_w = siz_w;
+  sab_u->num_w = (u3a_slab_page - c3_wiseof(u3a_slab)) / siz_w;
+
+  c3_dessert( sab_u->num_w <= (32 * u3a_slab_maps) );
+
+  return sab_u;
+}
+
+/* _ca_slab_alloc(): allocate a box of [siz_w] words from a slab.
+*/
+static void*
+_ca_slab_alloc(c3_w siz_w)
+{
+  c3_w           cla_w = _ca_slab_class(siz_w);
+  u3p(u3a_slab)* par_p = &(u3R->sab.par_p[cla_w]);
+  u3a_slab*      sab_u;
+  c3_w           sot_w;
+
+  if ( !*par_p ) {
+    _ca_slab_link(par_p, _ca_slab_make(siz_w));
+  }
+
+  sab_u = u3to(u3a_slab, *par_p);
+
+  //  reuse a freed slot, or bump into fresh ones
+  //
+  if ( sab_u->use_w < sab_u->hig_w ) {
+    c3_w i_w = 0;
+
+    while ( !sab_u->map_w[i_w] ) {
+      i_w++;
+    }
+
+    sot_w = (i_w << 5) + c3_tz_w(sab_u->map_w[i_w]);
+    sab_u->map_w[i_w] &= sab_u->map_w[i_w] - 1;
+  }
+  else {
+    sot_w = sab_u->hig_w++;
+  }
+
+  if ( sab_u->num_w == ++sab_u->use_w ) {
+    _ca_slab_unlink(par_p, sab_u);
+    _ca_slab_link(&(u3R->sab.ful_p[cla_w]), sab_u);
+  }
+
+  {
+    c3_w*    box_w = _ca_slab_slot(sab_u) + (sot_w * siz_w);
+    u3a_box* box_u = (void*)box_w;
+
+    box_u->siz_w = siz_w;
+    box_u->use_w = 1;
+    box_w[siz_w - 1] = u3a_slab_tag(u3of(u3a_slab, sab_u));
+
+    _box_vaal(box_u);
+
+    return u3a_boxto(box_u);
+  }
+}
+
 /* u3a_walloc(): allocate storage words on hat heap.
 */
 void*
@@ -613,7 +823,17 @@ u3a_walloc(c3_w len_w)
 {
   void* ptr_v;
 
-  ptr_v = _ca_walloc(len_w, 1, 0);
+  //  small boxes come from slabs, where enabled (sand roads just bump)
+  //
+  if (  (u3a_flag_slab == (u3R->how.fag_w & (u3a_flag_slab | u3a_flag_sand)))
+     && (u3a_boxed(len_w) <= u3a_slab_max) )
+  {
+    c3_w siz_w = c3_max(u3a_minimum, u3a_boxed(len_w));
+    ptr_v = _ca_slab_alloc(c3_align(siz_w, u3a_walign, C3_ALGHI));
+  }
+  else {
+    ptr_v = _ca_walloc(len_w, 1, 0);
+  }
 
 #if 0
   if ( (703 == u3_Code) &&
@@ -682,6 +902,12 @@ u3a_pile_prep(u3a_pile* pil_u, c3_w len_w)
 void
 u3a_wfree(void* tox_v)
 {
+  //  sand roads are released wholesale by u3m_fall()
+  //
+  if ( u3R->how.fag_w & u3a_flag_sand ) {
+    return;
+  }
+
   _box_free(u3a_botox(tox_v));
 }
 
@@ -695,6 +921,14 @@ u3a_wtrim(void* tox_v, c3_w old_w, c3_w len_w)
 {
   c3_w* nov_w = tox_v;
 
+  //  slab slots have a fixed size; sand roads never reuse the tail
+  //
+  if (  (u3R->how.fag_w & u3a_flag_sand)
+     || _ca_slab_of(u3a_botox(nov_w)) )
+  {
+    return;
+  }
+
   if ( (old_w > len_w)
        && ((old_w - len_w) >= u3a_minimum) )
     {
@@ -900,7 +1134,9 @@ u3a_cfree(c3_w* cel_w)
   }
 #endif
 
-  if ( u3R == &(u3H->rod_u) ) {
+  if (  (u3R == &(u3H->rod_u))
+     || (u3R->how.fag_w & u3a_flag_sand) )
+  {
     u3a_wfree(cel_w);
     return;
   }
@@ -1505,7 +1741,11 @@ u3a_gain(u3_noun som)
   u3t_on(mal_o);
   u3_assert(u3_none != som);
 
-  if ( !_(u3a_is_cat(som)) ) {
+  //  sand roads don't count references
+  //
+  if (  !_(u3a_is_cat(som))
+     && !(u3R->how.fag_w & u3a_flag_sand) )
+  {
     som = _(u3a_is_north(u3R))
               ? _me_gain_north(som)
               : _me_gain_south(som);
@@ -1521,7 +1761,9 @@ void
 u3a_lose(u3_noun som)
 {
   u3t_on(mal_o);
-  if ( !_(u3a_is_cat(som)) ) {
+  if (  !_(u3a_is_cat(som))
+     && !(u3R->how.fag_w & u3a_flag_sand) )
+  {
     if ( _(u3a_is_north(u3R)) ) {
       _me_lose_north(som);
     } else {
@@ -1781,6 +2023,423 @@ u3a_mark_mptr(void* ptr_v)
   return u3a_mark_ptr(org_w);
 }
 
+#ifndef U3_MEMORY_DEBUG
+/*  parallel gc: on a large home road, a gang of threads marks each root,
+**  and then sweeps the heap in spans.  a box belongs to the thread whose
+**  compare-and-swap first makes its refcount negative; only that thread
+**  marks its children.  the lowest box claimed in each span of the heap
+**  is a known box boundary, from which the sweep can start.
+*/
+#define _ca_gang_max  8                       //  max threads, with caller
+#define _ca_gang_min  (1U << 24)              //  min heap words (64MB)
+#define _ca_gang_spa  256                     //  max sweep spans
+#define _ca_gang_dol  64                      //  stack depth worth sharing
+
+/* _ca_mate: marking thread.
+*/
+typedef struct _ca_mate {
+  u3_noun* sak;                               //  local stack
+  c3_w     len_w;                             //  stack depth
+  c3_w     cap_w;                             //  stack capacity
+  c3_d     siz_d;                             //  words marked
+  c3_o     don_o;                             //  shared work
+  u3_post* beg_p;                             //  lowest box, per span
+} _ca_mate;
+
+/* _ca_gang: parallel gc state.
+*/
+static struct {
+  c3_w            ted_w;                      //  worker threads, if on
+  pthread_t       ted_u[_ca_gang_max];        //  workers, from 1
+  _ca_mate        mat_u[_ca_gang_max];        //  caller is 0
+  pthread_mutex_t mut_u;                      //  guards shared state
+  pthread_cond_t  wok_u;                      //  work posted, or stop
+  pthread_cond_t  don_u;                      //  worker idled
+  c3_w            idl_w;                      //  idle workers
+  c3_o            end_o;                      //  stopping
+  u3_noun*        que;                        //  shared stack
+  c3_w            len_w;                      //  shared depth
+  c3_w            cap_w;                      //  shared capacity
+  c3_d            siz_d;                      //  words marked by workers
+  c3_o            sew_o;                      //  spans valid for sweep
+  c3_w            tem_w;                      //  threads for sweep
+  c3_w            swe_w;                      //  threads, last sweep
+  u3_post         rut_p;                      //  heap bottom, when marked
+  u3_post         hat_p;                      //  heap top, when marked
+  c3_w            sif_w;                      //  log2 span words
+  u3_post         beg_p[_ca_gang_max][_ca_gang_spa];
+} _ca_gang = {
+  .mut_u = PTHREAD_MUTEX_INITIALIZER,
+  .wok_u = PTHREAD_COND_INITIALIZER,
+  .don_u = PTHREAD_COND_INITIALIZER,
+  .sew_o = c3n,
+  .swe_w = 1,
+};
+
+/* _ca_mate_push(): push [som] on a marking thread's stack.
+*/
+static inline void
+_ca_mate_push(_ca_mate* mat_u, u3_noun som)
+{
+  if ( mat_u->len_w == mat_u->cap_w ) {
+    mat_u->cap_w = c3_max(1024, 2 * mat_u->cap_w);
+    mat_u->sak   = c3_realloc(mat_u->sak, mat_u->cap_w * sizeof(u3_noun));
+  }
+  mat_u->sak[mat_u->len_w++] = som;
+}
+
+/* _ca_mate_mark_ptr(): u3a_mark_ptr() for the gang, recording span starts.
+*/
+static inline c3_w
+_ca_mate_mark_ptr(_ca_mate* mat_u, void* ptr_v)
+{
+  u3a_box* box_u;
+  c3_w     use_w, nex_w, siz_w;
+
+  if ( !((ptr_v >= u3a_into(_ca_gang.rut_p)) &&
+         (ptr_v < u3a_into(_ca_gang.hat_p))) )
+  {
+    return 0;
+  }
+
+  box_u = u3a_botox(ptr_v);
+  use_w = __atomic_load_n(&box_u->use_w, __ATOMIC_RELAXED);
+
+  do {
+    c3_ws use_ws = (c3_ws)use_w;
+
+    if ( 0 == use_ws ) {
+      fprintf(stderr, "%p is bogus\r\n", ptr_v);
+      return 0;
+    }
+    else if ( 0x80000000 == use_w ) {         //  see u3a_prof()
+      nex_w = (c3_w)-1;
+      siz_w = 0xffffffff;
+    }
+    else if ( use_ws < 0 ) {
+      nex_w = use_w - 1;
+      siz_w = 0;
+    }
+    else {
+      nex_w = (c3_w)-1;
+      siz_w = box_u->siz_w;
+    }
+  }
+  while ( !__atomic_compare_exchange_n(&box_u->use_w, &use_w, nex_w, 1,
+                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED) );
+
+  if ( siz_w ) {
+    u3_post box_p = u3a_outa(box_u);
+    c3_w    spa_w = (box_p - _ca_gang.rut_p) >> _ca_gang.sif_w;
+
+    if ( box_p < mat_u->beg_p[spa_w] ) {
+      mat_u->beg_p[spa_w] = box_p;
+    }
+  }
+
+  return siz_w;
+}
+
+/* _ca_mate_dole(): move the bottom half of a thread's stack to the gang.
+*/
+static void
+_ca_mate_dole(_ca_mate* mat_u)
+{
+  c3_w hav_w = mat_u->len_w >> 1;
+
+  pthread_mutex_lock(&_ca_gang.mut_u);
+  {
+    if ( (_ca_gang.len_w + hav_w) > _ca_gang.cap_w ) {
+      _ca_gang.cap_w = c3_max(2 * _ca_gang.cap_w, _ca_gang.len_w + hav_w);
+      _ca_gang.que   = c3_realloc(_ca_gang.que,
+                                  _ca_gang.cap_w * sizeof(u3_noun));
+    }
+
+    memcpy(_ca_gang.que + _ca_gang.len_w, mat_u->sak,
+           hav_w * sizeof(u3_noun));
+    _ca_gang.len_w += hav_w;
+
+    pthread_cond_broadcast(&_ca_gang.wok_u);
+    pthread_cond_signal(&_ca_gang.don_u);
+  }
+  pthread_mutex_unlock(&_ca_gang.mut_u);
+
+  mat_u->len_w -= hav_w;
+  memmove(mat_u->sak, mat_u->sak + hav_w, mat_u->len_w * sizeof(u3_noun));
+  mat_u->don_o = c3y;
+}
+
+/* _ca_mate_take(): move shared work to a thread's stack.  Hold the lock.
+*/
+static void
+_ca_mate_take(_ca_mate* mat_u)
+{
+  c3_w tak_w = c3_min(_ca_gang.len_w, _ca_gang_dol);
+
+  while ( tak_w-- ) {
+    _ca_mate_push(mat_u, _ca_gang.que[--_ca_gang.len_w]);
+  }
+}
+
+/* _ca_mate_mark(): mark everything on a thread's stack, sharing if idle.
+*/
+static void
+_ca_mate_mark(_ca_mate* mat_u)
+{
+  while ( mat_u->len_w ) {
+    u3_noun som = mat_u->sak[--mat_u->len_w];
+
+    while ( c3n == u3a_is_senior(u3R, som) ) {
+      c3_w new_w = _ca_mate_mark_ptr(mat_u, u3a_to_ptr(som));
+
+      if ( (0 == new_w) || (0xffffffff == new_w) ) {  //  see u3a_mark_ptr()
+        break;
+      }
+
+      mat_u->siz_d += new_w;
+
+      if ( c3n == u3du(som) ) {
+        break;
+      }
+
+      _ca_mate_push(mat_u, u3h(som));
+      som = u3t(som);
+    }
+
+    if (  (mat_u->len_w > _ca_gang_dol)
+       && __atomic_load_n(&_ca_gang.idl_w, __ATOMIC_RELAXED) )
+    {
+      _ca_mate_dole(mat_u);
+    }
+  }
+}
+
+/* _ca_gang_work(): marking thread.
+*/
+static void*
+_ca_gang_work(void* ptr_v)
+{
+  _ca_mate* mat_u = ptr_v;
+
+  pthread_mutex_lock(&_ca_gang.mut_u);
+
+  while ( 1 ) {
+    if ( _ca_gang.len_w ) {
+      _ca_mate_take(mat_u);
+      pthread_mutex_unlock(&_ca_gang.mut_u);
+      _ca_mate_mark(mat_u);
+      pthread_mutex_lock(&_ca_gang.mut_u);
+    }
+    else if ( c3y == _ca_gang.end_o ) {
+      break;
+    }
+    else {
+      _ca_gang.siz_d += mat_u->siz_d;
+      mat_u->siz_d    = 0;
+
+      __atomic_add_fetch(&_ca_gang.idl_w, 1, __ATOMIC_RELAXED);
+      pthread_cond_signal(&_ca_gang.don_u);
+      pthread_cond_wait(&_ca_gang.wok_u, &_ca_gang.mut_u);
+      __atomic_sub_fetch(&_ca_gang.idl_w, 1, __ATOMIC_RELAXED);
+    }
+  }
+
+  pthread_mutex_unlock(&_ca_gang.mut_u);
+
+  return 0;
+}
+
+/* _ca_gang_mark(): mark [som] with the gang.  Produce size.
+*/
+static c3_w
+_ca_gang_mark(u3_noun som)
+{
+  _ca_mate* mat_u = &_ca_gang.mat_u[0];
+
+  mat_u->siz_d = 0;
+  mat_u->don_o = c3n;
+
+  _ca_mate_push(mat_u, som);
+  _ca_mate_mark(mat_u);
+
+  //  if we shared, help until all shared work is done
+  //
+  if ( c3y == mat_u->don_o ) {
+    pthread_mutex_lock(&_ca_gang.mut_u);
+
+    while ( 1 ) {
+      if ( _ca_gang.len_w ) {
+        _ca_mate_take(mat_u);
+        pthread_mutex_unlock(&_ca_gang.mut_u);
+        _ca_mate_mark(mat_u);
+        pthread_mutex_lock(&_ca_gang.mut_u);
+      }
+      else if ( _ca_gang.ted_w == _ca_gang.idl_w ) {
+        break;
+      }
+      else {
+        pthread_cond_wait(&_ca_gang.don_u, &_ca_gang.mut_u);
+      }
+    }
+
+    mat_u->siz_d  += _ca_gang.siz_d;
+    _ca_gang.siz_d = 0;
+
+    pthread_mutex_unlock(&_ca_gang.mut_u);
+  }
+
+  return (c3_w)mat_u->siz_d;
+}
+
+/* _ca_gang_size(): threads for parallel gc of u3R, or 1.
+*/
+static c3_w
+_ca_gang_size(void)
+{
+  long cpu_l;
+
+  if (  (&(u3H->rod_u) != u3R)
+     || (u3C.wag_w & u3o_debug_ram)
+     || ((u3R->hat_p - u3R->rut_p) < _ca_gang_min) )
+  {
+    return 1;
+  }
+
+  cpu_l = sysconf(_SC_NPROCESSORS_ONLN);
+
+  return ( cpu_l < 2 ) ? 1 : c3_min((c3_w)cpu_l, _ca_gang_max);
+}
+
+/* _ca_gang_spawn(): start [num_w] threads at [fun_f], signals blocked.
+**                   Produce threads started.
+*/
+static c3_w
+_ca_gang_spawn(c3_w num_w, void* (*fun_f)(void*), void* arg_v, size_t siz_i)
+{
+  sigset_t all_u, old_u;
+  c3_w     i_w;
+
+  sigfillset(&all_u);
+  pthread_sigmask(SIG_BLOCK, &all_u, &old_u);
+
+  for ( i_w = 0; i_w < num_w; i_w++ ) {
+    void* ptr_v = (c3_y*)arg_v + (i_w * siz_i);
+
+    if ( 0 != pthread_create(&_ca_gang.ted_u[1 + i_w], 0, fun_f, ptr_v) ) {
+      fprintf(stderr, "loom: gc thread: %s\r\n", strerror(errno));
+      break;
+    }
+  }
+
+  pthread_sigmask(SIG_SETMASK, &old_u, 0);
+
+  return i_w;
+}
+
+/* u3a_mark_open(): start parallel marking, if worthwhile.  Produce threads.
+*/
+c3_w
+u3a_mark_open(void)
+{
+  c3_w ted_w = _ca_gang_size();
+  c3_w hep_w, i_w, j_w;
+
+  _ca_gang.sew_o = c3n;
+
+  if ( 1 == ted_w ) {
+    return 1;
+  }
+
+  //  refcounts are written all over the heap, off the main thread;
+  //  take any dirty-page faults here first
+  //
+  u3e_soil(u3R->rut_p, u3R->hat_p);
+
+  hep_w          = u3R->hat_p - u3R->rut_p;
+  _ca_gang.rut_p = u3R->rut_p;
+  _ca_gang.hat_p = u3R->hat_p;
+  _ca_gang.sif_w = 0;
+
+  while ( (hep_w >> _ca_gang.sif_w) >= _ca_gang_spa ) {
+    _ca_gang.sif_w++;
+  }
+
+  for ( i_w = 0; i_w < _ca_gang_max; i_w++ ) {
+    for ( j_w = 0; j_w < _ca_gang_spa; j_w++ ) {
+      _ca_gang.beg_p[i_w][j_w] = _ca_gang.hat_p;
+    }
+    memset(&_ca_gang.mat_u[i_w], 0, sizeof(_ca_mate));
+    _ca_gang.mat_u[i_w].beg_p = _ca_gang.beg_p[i_w];
+  }
+
+  _ca_gang.end_o = c3n;
+  _ca_gang.idl_w = 0;
+  _ca_gang.len_w = 0;
+  _ca_gang.siz_d = 0;
+
+  _ca_gang.ted_w = _ca_gang_spawn(ted_w - 1, _ca_gang_work,
+                                  &_ca_gang.mat_u[1], sizeof(_ca_mate));
+
+  if ( !_ca_gang.ted_w ) {
+    return 1;
+  }
+
+  _ca_gang.tem_w = 1 + _ca_gang.ted_w;
+
+  return _ca_gang.tem_w;
+}
+
+/* u3a_mark_shut(): stop parallel marking.
+*/
+void
+u3a_mark_shut(void)
+{
+  c3_w i_w;
+
+  if ( !_ca_gang.ted_w ) {
+    return;
+  }
+
+  pthread_mutex_lock(&_ca_gang.mut_u);
+  _ca_gang.end_o = c3y;
+  pthread_cond_broadcast(&_ca_gang.wok_u);
+  pthread_mutex_unlock(&_ca_gang.mut_u);
+
+  for ( i_w = 1; i_w <= _ca_gang.ted_w; i_w++ ) {
+    pthread_join(_ca_gang.ted_u[i_w], 0);
+  }
+
+  for ( i_w = 0; i_w <= _ca_gang.ted_w; i_w++ ) {
+    c3_free(_ca_gang.mat_u[i_w].sak);
+    _ca_gang.mat_u[i_w].sak = 0;
+  }
+
+  c3_free(_ca_gang.que);
+  _ca_gang.que   = 0;
+  _ca_gang.cap_w = 0;
+  _ca_gang.ted_w = 0;
+
+  //  the sweep may now start from our span records
+  //
+  _ca_gang.sew_o = c3y;
+}
+#else
+/* u3a_mark_open(): start parallel marking, if worthwhile.  Produce threads.
+*/
+c3_w
+u3a_mark_open(void)
+{
+  return 1;
+}
+
+/* u3a_mark_shut(): stop parallel marking.
+*/
+void
+u3a_mark_shut(void)
+{
+}
+#endif
+
 /* u3a_mark_noun(): mark a noun for gc.  Produce size.
 */
 c3_w
@@ -1788,6 +2447,12 @@ u3a_mark_noun(u3_noun som)
 {
   c3_w siz_w = 0;
 
+#ifndef U3_MEMORY_DEBUG
+  if ( _ca_gang.ted_w ) {
+    return _ca_gang_mark(som);
+  }
+#endif
+
   while ( 1 ) {
     if ( _(u3a_is_senior(u3R, som)) ) {
       return siz_w;
@@ -2057,7 +2722,7 @@ void
 u3a_quac_free(u3m_quac* qua_u)
 {
   c3_w i_w = 0;
-  while ( qua_u->qua_u[i_w] != NULL ) {
+  while ( (qua_u->qua_u != NULL) && (qua_u->qua_u[i_w] != NULL) ) {
     u3a_quac_free(qua_u->qua_u[i_w]);
     i_w++;
   }
@@ -2199,15 +2864,64 @@ u3a_print_quac(FILE* fil_u, c3_w den_w, u3m_quac* mas_u)
       fprintf(fil_u, "%*s--", den_w, "");
       _ca_print_memory(fil_u, mas_u->siz_w);
     }
+
+    //  gc pause, where measured
+    //
+    if ( mas_u->mic_d ) {
+      fprintf(fil_u, "%*s(%" PRIu64 " ms, %u thread%s, MB/s %" PRIu64 ")\r\n",
+              den_w + 2, "",
+              mas_u->mic_d / 1000,
+              mas_u->ted_w, ( 1 == mas_u->ted_w ) ? "" : "s",
+              (c3_d)mas_u->siz_w / mas_u->mic_d);
+    }
   }
 }
 
+/* u3a_sweep_quac(): sweep a fully marked road, producing a timed report.
+*/
+u3m_quac*
+u3a_sweep_quac(void)
+{
+  u3m_quac* qua_u = c3_calloc(sizeof(*qua_u));
+  c3_d      tim_d = u3t_trace_time();
+
+  qua_u->nam_c = strdup("sweep");
+  qua_u->siz_w = u3a_sweep() * 4;
+  qua_u->mic_d = c3_max(1, u3t_trace_time() - tim_d);
+#ifndef U3_MEMORY_DEBUG
+  qua_u->ted_w = _ca_gang.swe_w;
+#else
+  qua_u->ted_w = 1;
+#endif
+
+  return qua_u;
+}
+
+/* _ca_memo_quac(): name a memo cache report with its counters.
+*/
+static u3m_quac*
+_ca_memo_quac(c3_c* cap_c, u3z_cid cid)
+{
+  u3m_quac* qua_u = c3_calloc(sizeof(*qua_u));
+  u3z_stat* sat_u = &(u3z_Stat[cid]);
+  c3_c      nam_c[256];
+
+  snprintf(nam_c, sizeof(nam_c),
+           "%s (%u entries, %u words; "
+           "%" PRIu64 " hits, %" PRIu64 " misses, %" PRIu64 " evictions)",
+           cap_c, u3z_wyt(cid), u3z_weight(cid),
+           sat_u->hit_d, sat_u->mis_d, sat_u->eve_d);
+
+  qua_u->nam_c = strdup(nam_c);
+  return qua_u;
+}
+
 /* u3a_mark_road(): mark ad-hoc persistent road structures.
 */
 u3m_quac*
 u3a_mark_road()
 {
-  u3m_quac** qua_u = c3_malloc(sizeof(*qua_u) * 9);
+  u3m_quac** qua_u = c3_malloc(sizeof(*qua_u) * 10);
 
   qua_u[0] = c3_calloc(sizeof(*qua_u[0]));
   qua_u[0]->nam_c = strdup("namespace");
@@ -2233,22 +2947,24 @@ u3a_mark_road()
   qua_u[5]->nam_c = strdup("new profile trace");
   qua_u[5]->siz_w = u3a_mark_noun(u3R->pro.trace) * 4;
 
-  qua_u[6] = c3_calloc(sizeof(*qua_u[6]));
-  qua_u[6]->nam_c = strdup("transient memoization cache");
+  qua_u[6] = _ca_memo_quac("transient memoization cache", u3z_memo_toss);
   qua_u[6]->siz_w = u3h_mark(u3R->cax.har_p) * 4;
 
-  qua_u[7] = c3_calloc(sizeof(*qua_u[7]));
-  qua_u[7]->nam_c = strdup("persistent memoization cache");
+  qua_u[7] = _ca_memo_quac("persistent memoization cache", u3z_memo_keep);
   qua_u[7]->siz_w = u3h_mark(u3R->cax.per_p) * 4;
 
-  qua_u[8] = NULL;
+  qua_u[8] = c3_calloc(sizeof(*qua_u[8]));
+  qua_u[8]->nam_c = strdup("incremental pack stack");
+  qua_u[8]->siz_w = u3m_pack_mark() * 4;
+
+  qua_u[9] = NULL;
 
   c3_w sum_w = 0;
-  for (c3_w i_w = 0; i_w < 8; i_w++) {
+  for (c3_w i_w = 0; i_w < 9; i_w++) {
     sum_w += qua_u[i_w]->siz_w;
   }
 
-  u3m_quac* tot_u = c3_malloc(sizeof(*tot_u));
+  u3m_quac* tot_u = c3_calloc(sizeof(*tot_u));
   tot_u->nam_c = strdup("total road stuff");
   tot_u->siz_w = sum_w;
   tot_u->qua_u = qua_u;
@@ -2263,8 +2979,7 @@ u3a_reclaim(void)
 {
   //  clear the memoization cache
   //
-  u3h_free(u3R->cax.har_p);
-  u3R->cax.har_p = u3h_new();
+  u3z_free(u3z_memo_toss);
 }
 
 /* u3a_rewrite_compact(): rewrite pointers in ad-hoc persistent road structures.
@@ -2482,6 +3197,212 @@ u3a_ream(void)
   }
 }
 
+#ifndef U3_MEMORY_DEBUG
+/* _ca_slab_sweep(): sweep slab slots, repairing marks and freeing leaks.
+**
+**   slab pages themselves are marked, so that the heap sweep
+**   counts them as allocated. produces leaked words.
+*/
+static c3_w
+_ca_slab_sweep(void)
+{
+  c3_w leq_w = 0;
+  c3_w cla_w;
+
+  for ( cla_w = 0; cla_w < u3a_slab_no; cla_w++ ) {
+    u3p(u3a_slab) lis_p[2] = { u3R->sab.par_p[cla_w], u3R->sab.ful_p[cla_w] };
+    c3_w          j_w;
+
+    for ( j_w = 0; j_w < 2; j_w++ ) {
+      u3p(u3a_slab) sab_p = lis_p[j_w];
+
+      while ( sab_p ) {
+        u3a_slab* sab_u = u3to(u3a_slab, sab_p);
+        c3_w*     sot_w = _ca_slab_slot(sab_u);
+        c3_w      use_w = sab_u->use_w;
+        c3_w      i_w;
+
+        sab_p = sab_u->nex_p;
+        u3a_botox(sab_u)->use_w = (c3_w)-1;
+
+        for ( i_w = 0; i_w < sab_u->hig_w; i_w++ ) {
+          u3a_box* box_u  = (void*)(sot_w + (i_w * sab_u->siz_w));
+          c3_ws    use_ws = (c3_ws)box_u->use_w;
+
+          if ( sab_u->map_w[i_w >> 5] & (1U << (i_w & 31)) ) {
+            continue;
+          }
+          else if ( use_ws > 0 ) {
+            _ca_print_leak("leak", box_u, use_ws);
+
+            leq_w += box_u->siz_w;
+            box_u->use_w = 0;
+            sab_u->map_w[i_w >> 5] |= (1U << (i_w & 31));
+            sab_u->use_w--;
+          }
+          else if ( use_ws < 0 ) {
+            box_u->use_w = (c3_w)(0 - use_ws);
+          }
+        }
+
+        //  a full page had leaks; empty pages are kept for reuse
+        //
+        if ( (sab_u->num_w == use_w) && (use_w != sab_u->use_w) ) {
+          _ca_slab_unlink(&(u3R->sab.ful_p[cla_w]), sab_u);
+          _ca_slab_link(&(u3R->sab.par_p[cla_w]), sab_u);
+        }
+      }
+    }
+  }
+
+  return leq_w;
+}
+#endif
+
+#ifndef U3_MEMORY_DEBUG
+/* _ca_span: a thread's span of the heap, for sweeping.
+*/
+typedef struct _ca_span {
+  c3_w*     box_w;                            //  first box
+  c3_w*     end_w;                            //  end of span
+  c3_w      pos_w;                            //  words in use
+  c3_w      leq_w;                            //  words leaked
+  u3a_box** lek_u;                            //  leaked boxes
+  c3_w      len_w;                            //  leaked count
+  c3_w      cap_w;                            //  leaked capacity
+} _ca_span;
+
+/* _ca_span_sweep(): sweep a span, deferring leaks.
+*/
+static void*
+_ca_span_sweep(void* ptr_v)
+{
+  _ca_span* spa_u = ptr_v;
+  c3_w*     box_w = spa_u->box_w;
+
+  while ( box_w < spa_u->end_w ) {
+    u3a_box* box_u  = (void *)box_w;
+    c3_ws    use_ws = (c3_ws)box_u->use_w;
+
+    if ( use_ws > 0 ) {
+      if ( spa_u->len_w == spa_u->cap_w ) {
+        spa_u->cap_w = c3_max(16, 2 * spa_u->cap_w);
+        spa_u->lek_u = c3_realloc(spa_u->lek_u,
+                                  spa_u->cap_w * sizeof(u3a_box*));
+      }
+      spa_u->lek_u[spa_u->len_w++] = box_u;
+      spa_u->leq_w += box_u->siz_w;
+    }
+    else if ( use_ws < 0 ) {
+      spa_u->pos_w += box_u->siz_w;
+      box_u->use_w = (c3_w)(0 - use_ws);
+    }
+    box_w += box_u->siz_w;
+  }
+
+  u3_assert( box_w == spa_u->end_w );
+
+  return 0;
+}
+
+/* _ca_sweep_gang(): sweep the heap in parallel, if just marked so.
+*/
+static c3_o
+_ca_sweep_gang(c3_w* pos_w, c3_w* leq_w)
+{
+  u3_post  sat_p[_ca_gang_spa + 1];
+  _ca_span spa_u[_ca_gang_max];
+  c3_w     num_w = 0, ted_w, i_w, j_w;
+
+  _ca_gang.swe_w = 1;
+
+  if (  (c3n == _ca_gang.sew_o)
+     || (&(u3H->rod_u) != u3R)
+     || (_ca_gang.rut_p != u3R->rut_p)
+     || (_ca_gang.hat_p != u3R->hat_p) )
+  {
+    _ca_gang.sew_o = c3n;
+    return c3n;
+  }
+
+  _ca_gang.sew_o = c3n;
+
+  //  span boundaries: the heap bottom, and the lowest marked box per span
+  //
+  sat_p[num_w++] = _ca_gang.rut_p;
+
+  for ( i_w = 1; i_w < _ca_gang_spa; i_w++ ) {
+    u3_post min_p = _ca_gang.hat_p;
+
+    for ( j_w = 0; j_w < _ca_gang_max; j_w++ ) {
+      min_p = c3_min(min_p, _ca_gang.beg_p[j_w][i_w]);
+    }
+
+    if ( min_p < _ca_gang.hat_p ) {
+      sat_p[num_w++] = min_p;
+    }
+  }
+
+  sat_p[num_w] = _ca_gang.hat_p;
+
+  //  divide spans evenly among threads; the caller takes the first
+  //
+  ted_w = c3_min(_ca_gang.tem_w, num_w);
+  memset(spa_u, 0, sizeof(spa_u));
+
+  for ( i_w = 0; i_w < ted_w; i_w++ ) {
+    spa_u[i_w].box_w = u3a_into(sat_p[(i_w * num_w) / ted_w]);
+    spa_u[i_w].end_w = u3a_into(sat_p[((i_w + 1) * num_w) / ted_w]);
+  }
+
+  {
+    c3_w dun_w = _ca_gang_spawn(ted_w - 1, _ca_span_sweep,
+                                &spa_u[1], sizeof(_ca_span));
+
+    //  sweep any spans we couldn't hand off ourselves
+    //
+    for ( i_w = 1 + dun_w; i_w < ted_w; i_w++ ) {
+      _ca_span_sweep(&spa_u[i_w]);
+    }
+
+    _ca_span_sweep(&spa_u[0]);
+
+    for ( i_w = 1; i_w <= dun_w; i_w++ ) {
+      pthread_join(_ca_gang.ted_u[i_w], 0);
+    }
+
+    _ca_gang.swe_w = 1 + dun_w;
+  }
+
+  //  leaks go on the free lists, here on the main thread
+  //
+  for ( i_w = 0; i_w < ted_w; i_w++ ) {
+    for ( j_w = 0; j_w < spa_u[i_w].len_w; j_w++ ) {
+      u3a_box* box_u = spa_u[i_w].lek_u[j_w];
+
+      _ca_print_leak("leak", box_u, (c3_ws)box_u->use_w);
+
+      box_u->use_w = 0;
+      _box_attach(box_u);
+    }
+
+    *pos_w += spa_u[i_w].pos_w;
+    *leq_w += spa_u[i_w].leq_w;
+    c3_free(spa_u[i_w].lek_u);
+  }
+
+  return c3y;
+}
+#else
+/* _ca_sweep_gang(): sweep the heap in parallel, if just marked so.
+*/
+static c3_o
+_ca_sweep_gang(c3_w* pos_w, c3_w* leq_w)
+{
+  return c3n;
+}
+#endif
+
 /* u3a_sweep(): sweep a fully marked road.
 */
 c3_w
@@ -2507,7 +3428,17 @@ u3a_sweep(void)
   /* Sweep through the arena, repairing and counting leaks.
   */
   pos_w = leq_w = weq_w = 0;
-  {
+
+#ifndef U3_MEMORY_DEBUG
+  //  slab slots are swept first; their pages are counted below
+  //
+  if ( &(u3H->rod_u) != u3R ) {
+    leq_w = _ca_slab_sweep();
+    pos_w = 0 - leq_w;
+  }
+#endif
+
+  if ( c3n == _ca_sweep_gang(&pos_w, &leq_w) ) {
     u3_post box_p = _(u3a_is_north(u3R)) ? u3R->rut_p : u3R->hat_p;
     u3_post end_p = _(u3a_is_north(u3R)) ? u3R->hat_p : u3R->rut_p;
     c3_w*   box_w = u3a_into(box_p);
@@ -2821,6 +3752,108 @@ u3a_pack_move(u3a_road* rod_u)
   }
 }
 
+/* _ca_pack_low(): detach a free box of [siz_w] words from below [lim_p].
+**
+**   Free lists are LIFO, so recently freed (high) boxes come first;
+**   only a bounded prefix of each list is probed.
+*/
+static u3a_box*
+_ca_pack_low(c3_w siz_w, u3_post lim_p)
+{
+  c3_w sel_w;
+
+  for ( sel_w = _box_slot(siz_w); sel_w < u3a_fbox_no; sel_w++ ) {
+    u3p(u3a_fbox) fre_p = u3R->all.fre_p[sel_w];
+    c3_w          pro_w = 0;
+
+    while ( fre_p && (pro_w++ < 256) ) {
+      u3a_box* box_u = &(u3to(u3a_fbox, fre_p)->box_u);
+
+      if (  (box_u->siz_w >= siz_w)
+         && ((fre_p + siz_w) <= lim_p) )
+      {
+        c3_w* box_w = (c3_w*)(void*)box_u;
+
+        _box_detach(box_u);
+
+        if ( (siz_w + u3a_minimum) <= box_u->siz_w ) {
+          _box_attach(_box_make(box_w + siz_w, box_u->siz_w - siz_w, 0));
+          return _box_make(box_w, siz_w, 1);
+        }
+        else {
+          box_u->use_w = 1;
+          return box_u;
+        }
+      }
+
+      fre_p = u3to(u3a_fbox, fre_p)->nex_p;
+    }
+  }
+
+  return 0;
+}
+
+/* u3a_pack_down(): move sole-owned [som] below [lim_p], or u3_none.
+**
+**   The caller holds the only reference, and must replace it.
+*/
+u3_weak
+u3a_pack_down(u3_noun som, u3_post lim_p)
+{
+  u3a_box* box_u = u3a_botox(u3a_to_ptr(som));
+  u3a_box* new_u;
+  c3_w     siz_w = box_u->siz_w;
+  u3_post  new_p;
+
+  u3_assert( c3y == u3a_is_north(u3R) );
+
+  if (  (1 != box_u->use_w)
+     || (u3a_outa(box_u) < lim_p)
+     || !(new_u = _ca_pack_low(siz_w, lim_p)) )
+  {
+    return u3_none;
+  }
+
+  //  copy everything between the header and the trailing size;
+  //  the new box may be larger, if the remainder was too small to split
+  //
+  memcpy(u3a_boxto(new_u), u3a_boxto(box_u),
+         (siz_w - c3_wiseof(u3a_box) - 1) << 2);
+
+  _box_free(box_u);
+
+  new_p = u3a_outa(u3a_boxto(new_u));
+
+  return ( c3y == u3a_is_cell(som) ) ? u3a_to_pom(new_p) : u3a_to_pug(new_p);
+}
+
+/* u3a_pack_live(): count in-use words in boxes above [lim_p].
+*/
+c3_w
+u3a_pack_live(u3_post lim_p)
+{
+  c3_w* bot_w = u3a_into(c3_max(lim_p, u3R->rut_p));
+  c3_w* box_w = u3a_into(u3R->hat_p);
+  c3_w  liv_w = 0;
+
+  u3_assert( c3y == u3a_is_north(u3R) );
+
+  //  walk down from the hat, by trailing sizes
+  //
+  while ( box_w > bot_w ) {
+    u3a_box* box_u;
+
+    box_w -= box_w[-1];
+    box_u  = (void*)box_w;
+
+    if ( box_u->use_w ) {
+      liv_w += box_u->siz_w;
+    }
+  }
+
+  return liv_w;
+}
+
 /* u3a_rewrite_ptr(): mark a pointer as already having been rewritten
 */
 c3_o
@@ -3022,4 +4055,36 @@ u3a_loom_sane(void)
         u3_assert(!"loom: wack");
     }
   }
+
+  /*
+    Slab pages (inner roads only): page lists are well-linked, and the
+    free bitmap agrees with the live slot count.
+  */
+  if ( &(u3H->rod_u) != u3R ) {
+    for (c3_w i_w = 0; i_w < u3a_slab_no; i_w++) {
+      u3p(u3a_slab) lis_p[2] = { u3R->sab.par_p[i_w], u3R->sab.ful_p[i_w] };
+
+      for (c3_w j_w = 0; j_w < 2; j_w++) {
+        u3p(u3a_slab) pre_p = 0;
+
+        for (u3p(u3a_slab) sab_p = lis_p[j_w]; sab_p;) {
+          u3a_slab *sab_u = u3to(u3a_slab, sab_p);
+          c3_w      fre_w = 0;
+
+          for (c3_w k_w = 0; k_w < u3a_slab_maps; k_w++) {
+            fre_w += c3_pc_w(sab_u->map_w[k_w]);
+          }
+
+          if (sab_u->pre_p != pre_p) u3_assert(!"loom: slab wack");
+          if (sab_u->siz_w != (u3a_minimum + (2 * i_w))) u3_assert(!"loom: slab wack");
+          if (sab_u->hig_w > sab_u->num_w) u3_assert(!"loom: slab wack");
+          if (fre_w != (sab_u->hig_w - sab_u->use_w)) u3_assert(!"loom: slab wack");
+          if ((1 == j_w) != (sab_u->num_w == sab_u->use_w)) u3_assert(!"loom: slab wack");
+
+          pre_p = sab_p;
+          sab_p = sab_u->nex_p;
+        }
+      }
+    }
+  }
 }
@@ -58,6 +58,25 @@
     */
 #     define u3a_fbox_no 27
 
+    /* u3a_slab_no: number of small-box slab size classes.
+    **
+    **   box sizes u3a_minimum, u3a_minimum + 2, ... u3a_slab_max,
+    **   which covers allocations of up to 16 words.
+    */
+#     define u3a_slab_no 8
+
+    /* u3a_slab_max: largest box (in words) served from a slab.
+    */
+#     define u3a_slab_max (u3a_minimum + (2 * (u3a_slab_no - 1)))
+
+    /* u3a_slab_page: words of user data in a slab page.
+    */
+#     define u3a_slab_page (1 << 10)
+
+    /* u3a_slab_maps: words in a slab page free bitmap.
+    */
+#     define u3a_slab_maps 6
+
   /**  Structures.
   **/
     /* u3a_atom, u3a_cell: logical atom and cell structures.
@@ -109,6 +128,23 @@
         u3p(struct _u3a_fbox) nex_p;
       } u3a_fbox;
 
+    /* u3a_slab: slab page header, for small boxes of a single size.
+    **
+    **   a slab page is itself an ordinary box, carved into [num_w]
+    **   boxes of [siz_w] words, handed out bump-first. the trailing
+    **   size word of each slot box is tagged with the page offset
+    **   (see u3a_slab_tag), and the free bitmap is indexed by slot.
+    */
+      typedef struct _u3a_slab {
+        u3p(struct _u3a_slab) pre_p;          //  previous page in class
+        u3p(struct _u3a_slab) nex_p;          //  next page in class
+        c3_w siz_w;                           //  slot box size
+        c3_w num_w;                           //  slot count
+        c3_w hig_w;                           //  bump index
+        c3_w use_w;                           //  live slots
+        c3_w map_w[u3a_slab_maps];            //  free bitmap (below hig_w)
+      } u3a_slab;
+
     /* u3a_jets: jet dashboard
     */
       typedef struct _u3a_jets {
@@ -132,7 +168,19 @@
         u3p(c3_w) rut_p;                      //  bottom of durable region
         u3p(c3_w) ear_p;                      //  original cap if kid is live
 
-        c3_w fut_w[32];                       //  futureproof buffer
+        union {                               //  futureproof buffer
+          c3_w fut_w[32];                     //
+          struct {                            //
+            struct {                          //  small-box slabs (kids only)
+              u3p(u3a_slab) par_p[u3a_slab_no]; //  pages with free slots
+              u3p(u3a_slab) ful_p[u3a_slab_no]; //  full pages
+            } sab;                            //
+            struct {                          //  memo cache weight
+              c3_w har_w;                     //  transient, retained words
+              c3_w per_w;                     //  persistent, retained words
+            } maz;                            //
+          };                                  //
+        };                                    //
 
         struct {                              //  escape buffer
           union {
@@ -185,7 +233,8 @@
     /* u3a_flag: flags for how.fag_w.  All arena related.
     */
       enum u3a_flag {
-        u3a_flag_sand  = 0x1,                 //  bump allocation (XX not impl)
+        u3a_flag_sand  = 0x1,                 //  bump allocation, no refcounts
+        u3a_flag_slab  = 0x2,                 //  small-box slab allocation
       };
 
     /* u3a_pile: stack control, abstracted over road direction.
@@ -211,6 +260,10 @@
                                    ( (u3a_box *)(void *)(box_v) + 1 ) )
 #     define u3a_botox(tox_v)  ( (u3a_box *)(void *)(tox_v) - 1 )
 
+    /* u3a_slab_tag(): trailing size word of a slot box in slab [sab_p].
+    */
+#     define u3a_slab_tag(sab_p)  ( 0x80000000 | (c3_w)(sab_p) )
+
     /* Inside a noun.
     */
 
@@ -340,6 +393,8 @@
                   ? c3n \
                   : _(u3a_is_junior(r, som)) \
                   ? c3n \
+                  : ((r)->how.fag_w & u3a_flag_sand) \
+                  ? c3n \
                   : (u3a_botox(u3a_to_ptr(som))->use_w == 1) \
                   ? c3y : c3n )
 
@@ -604,6 +659,19 @@
           c3_w
           u3a_mark_noun(u3_noun som);
 
+        /* u3a_mark_open(): start parallel marking, if worthwhile.
+        **
+        **   Produces the number of threads marking (1 if serial).
+        **   Until u3a_mark_shut(), u3a_mark_noun() uses them all.
+        */
+          c3_w
+          u3a_mark_open(void);
+
+        /* u3a_mark_shut(): stop parallel marking.
+        */
+          void
+          u3a_mark_shut(void);
+
         /* u3a_mark_road(): mark ad-hoc persistent road structures.
         */
           u3m_quac*
@@ -672,6 +740,11 @@
           c3_w
           u3a_sweep(void);
 
+        /* u3a_sweep_quac(): sweep a fully marked road, producing a timed report.
+        */
+          u3m_quac*
+          u3a_sweep_quac(void);
+
         /* u3a_pack_seek(): sweep the heap, modifying boxes to record new addresses.
         */
           void
@@ -682,6 +755,16 @@
           void
           u3a_pack_move(u3a_road* rod_u);
 
+        /* u3a_pack_down(): move sole-owned [som] below [lim_p], or u3_none.
+        */
+          u3_weak
+          u3a_pack_down(u3_noun som, u3_post lim_p);
+
+        /* u3a_pack_live(): count in-use words in boxes above [lim_p].
+        */
+          c3_w
+          u3a_pack_live(u3_post lim_p);
+
         /* u3a_sane(): check allocator sanity.
         */
           void
@@ -373,6 +373,8 @@ const c_source_files = [_][]const u8{
     "v3/hashtable.c",
     "v3/manage.c",
     "v4/manage.c",
+    "v5/manage.c",
+    "v6/manage.c",
     "vortex.c",
     "xtract.c",
     "zave.c",
@@ -419,6 +421,8 @@ const install_headers = [_][]const u8{
     "v3/nock.h",
     "v3/vortex.h",
     "v4/manage.h",
+    "v5/manage.h",
+    "v6/manage.h",
     "version.h",
     "vortex.h",
     "xtract.h",
@@ -35,6 +35,18 @@
 //!     in the free space of the current road. if the guard page cannot be
 //!     recentered, then memory exhaustion has occurred.
 //!
+//! #### soft-dirty tracking (linux, u3o_soft_dirty)
+//!
+//!   - optionally, the kernel tracks stores instead: clean pages are mapped
+//!     read/write, and the per-pte soft-dirty bits are reset after each save
+//!     (via /proc/self/clear_refs).
+//!   - at save, the soft-dirty bits of clean pages are read from
+//!     /proc/self/pagemap and folded into the same bitmap.
+//!   - stores into clean pages still take a (minor, in-kernel) fault, but no
+//!     signal is delivered and no protections are changed from userspace.
+//!   - the guard page is unaffected.
+//!   - falls back to protections if unsupported, or with an ephemeral file.
+//!
 //! ### updates (u3e_save())
 //!
 //!   - all updates to a snapshot are made through a patch.
@@ -50,10 +62,37 @@
 //!   - segments are fsync'd; patch files are deleted.
 //!   - memory protections (and file-backed mappings) are re-established.
 //!
+//! #### background saves (u3o_save_async)
+//!
+//!   - the process forks after the watermarks are established; the child
+//!     composes, writes, applies, and syncs the patch from its copy-on-write
+//!     view of the loom, and exits.
+//!   - the parent immediately re-establishes protections, as if the save
+//!     had completed, and keeps computing.
+//!   - file-backed mappings are re-established for still-clean pages once
+//!     the child has been reaped (u3e_wait()); a failed child is fatal.
+//!   - at most one save is in flight; u3e_save() and u3e_stop() wait.
+//!   - the child dies with its parent; an interrupted patch is reapplied
+//!     on restart, as with any crash.
+//!   - incompatible with an ephemeral file (shared with the child).
+//!
+//! #### loom placement (u3o_huge_page, u3o_numa_node)
+//!
+//!   - anonymous loom pages (the free middle and the south segment) may be
+//!     backed by transparent huge pages, via madvise(MADV_HUGEPAGE); the
+//!     advice is renewed whenever pages are remapped anonymous.
+//!   - the file-backed north segment is left at system page granularity.
+//!   - protection changes split huge pages as necessary; with soft-dirty
+//!     tracking, clean pages are not protected, and stay huge.
+//!   - the loom (and the process) may be bound to a single NUMA node,
+//!     both its memory (MPOL_BIND) and its CPUs.
+//!   - both are linux only, and incompatible with an ephemeral file.
+//!
 //! ### invariants
 //!
 //!  definitions:
 //!    - a clean page is PROT_READ and 0 in the bitmap
+//!      (or read/write and not soft-dirty, if the kernel is tracking stores)
 //!    - a dirty page is (PROT_READ|PROT_WRITE) and 1 in the bitmap
 //!    - the guard page is PROT_NONE and 1 in the bitmap
 //!
@@ -66,7 +105,7 @@
 //!    - loaded from a snapshot during initialization
 //!    - present in a snapshot after save
 //!  - clean pages only become dirty by being:
-//!    - modified (and caught by the fault handler)
+//!    - modified (and caught by the fault handler or soft-dirty scan)
 //!    - orphaned due to segment truncation (explicitly dirtied)
 //!  - at points of quiescence (initialization, after save)
 //!    - all pages of the north and south segments are clean
@@ -88,6 +127,7 @@
 //! ### enhancements
 //!
 //!   - use platform specific page fault mechanism (mach rpc, userfaultfd, &c).
+//!     (soft-dirty bits cover linux, but still cost a minor fault per page)
 //!   - parallelism (conflicts with demand paging)
 //!
 
@@ -96,6 +136,14 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/wait.h>
+
+#if defined(U3_OS_linux)
+#include <sched.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#endif
 
 #include "log.h"
 #include "manage.h"
@@ -107,14 +155,39 @@
 ** _ce_len_words: word length of pages
 ** _ce_page:      byte length of a single page
 ** _ce_ptr:       void pointer to a page
+** _ce_pure:      protections for a clean page
 */
 #define _ce_len(i)        ((size_t)(i) << (u3a_page + 2))
 #define _ce_len_words(i)  ((size_t)(i) << u3a_page)
 #define _ce_page          _ce_len(1)
 #define _ce_ptr(i)        ((void *)((c3_c*)u3_Loom + _ce_len(i)))
+#define _ce_pure          ( (0 <= u3P.pam_i) ? (PROT_READ | PROT_WRITE) : PROT_READ )
+
+/* _ce_soft_bit: soft-dirty flag in a pagemap entry.
+*/
+#define _ce_soft_bit      ((c3_d)1 << 55)
+
+/* _ce_io_pages: pages per buffered read (4MB).
+** _ce_io_vecs:  page runs per vectored write.
+*/
+#define _ce_io_pages      256
+#define _ce_io_vecs       256
+
+/* _ce_iov: a vectored write in progress, to consecutive pages of a file.
+*/
+typedef struct _ce_iov {
+  c3_i         fid_i;                     //  file
+  c3_w         pgc_w;                     //  file offset (in pages)
+  c3_w         len_w;                     //  pages batched
+  c3_i         cnt_i;                     //  runs batched
+  struct iovec vec_u[_ce_io_vecs];        //  runs of contiguous memory
+} _ce_iov;
 
 /// Snapshotting system.
-u3e_pool u3e_Pool;
+u3e_pool u3e_Pool = { .pam_i = -1, .cer_i = -1 };
+
+/// I/O syscalls in the current save (for verbose reporting).
+static c3_d _ce_sys_d;
 
 static c3_l
 _ce_mug_page(void* ptr_v)
@@ -324,6 +397,172 @@ u3e_fault(u3_post low_p, u3_post hig_p, u3_post off_p)
   return u3e_flaw_good;
 }
 
+/* _ce_soft_clear(): reset soft-dirty bits (process-wide).
+*/
+static c3_i
+_ce_soft_clear(void)
+{
+  if ( 1 != write(u3P.cer_i, "4", 1) ) {
+    fprintf(stderr, "loom: soft-dirty clear: %s\r\n", strerror(errno));
+    return 1;
+  }
+
+  return 0;
+}
+
+/* _ce_soft_peek(): read the pagemap entry for the system page at [ptr_v].
+*/
+static c3_i
+_ce_soft_peek(void* ptr_v, c3_d* pam_d)
+{
+  size_t sys_i = sysconf(_SC_PAGESIZE);
+  off_t  off_i = ((c3_p)ptr_v / sys_i) * sizeof(c3_d);
+
+  if ( sizeof(c3_d) != pread(u3P.pam_i, pam_d, sizeof(c3_d), off_i) ) {
+    fprintf(stderr, "loom: soft-dirty peek: %s\r\n", strerror(errno));
+    return 1;
+  }
+
+  return 0;
+}
+
+/* _ce_soft_shut(): stop soft-dirty tracking.
+*/
+static void
+_ce_soft_shut(void)
+{
+  if ( 0 <= u3P.pam_i ) {
+    close(u3P.pam_i);
+    u3P.pam_i = -1;
+  }
+
+  if ( 0 <= u3P.cer_i ) {
+    close(u3P.cer_i);
+    u3P.cer_i = -1;
+  }
+}
+
+/* _ce_soft_open(): start soft-dirty tracking, if supported.
+*/
+static c3_o
+_ce_soft_open(void)
+{
+#if defined(U3_OS_linux)
+  volatile c3_y* pag_y;
+  c3_d           pam_d;
+  c3_o           sof_o = c3n;
+
+  if ( u3C.wag_w & u3o_swap ) {
+    fprintf(stderr, "loom: soft-dirty: incompatible with ephemeral file\r\n");
+    return c3n;
+  }
+
+  if (  (-1 == (u3P.pam_i = open("/proc/self/pagemap", O_RDONLY)))
+     || (-1 == (u3P.cer_i = open("/proc/self/clear_refs", O_WRONLY))) )
+  {
+    fprintf(stderr, "loom: soft-dirty: %s\r\n", strerror(errno));
+    _ce_soft_shut();
+    return c3n;
+  }
+
+  //  a written page must be clean after a reset, and dirty after a store
+  //  (kernels without CONFIG_MEM_SOFT_DIRTY accept the reset, but never
+  //  set the bit)
+  //
+  pag_y = mmap(0, _ce_page, (PROT_READ | PROT_WRITE),
+                            (MAP_ANON | MAP_PRIVATE), -1, 0);
+
+  if ( MAP_FAILED == pag_y ) {
+    fprintf(stderr, "loom: soft-dirty: probe: %s\r\n", strerror(errno));
+  }
+  else {
+    pag_y[0] = 1;
+
+    if (  !_ce_soft_clear()
+       && !_ce_soft_peek((void*)pag_y, &pam_d)
+       && !(pam_d & _ce_soft_bit) )
+    {
+      pag_y[0] = 2;
+
+      if (  !_ce_soft_peek((void*)pag_y, &pam_d)
+         && (pam_d & _ce_soft_bit) )
+      {
+        sof_o = c3y;
+      }
+    }
+
+    munmap((void*)pag_y, _ce_page);
+  }
+
+  if ( c3n == sof_o ) {
+    fprintf(stderr, "loom: soft-dirty: unsupported by kernel\r\n");
+    _ce_soft_shut();
+  }
+
+  return sof_o;
+#else
+  fprintf(stderr, "loom: soft-dirty: unsupported on this platform\r\n");
+  return c3n;
+#endif
+}
+
+/* _ce_soft_scan(): dirty [len_w] clean pages from [pag_w], if soft-dirty.
+*/
+static c3_w
+_ce_soft_scan(c3_w pag_w, c3_w len_w)
+{
+  //  NB: 32KB of entries; 512 pages at a time with 4KB system pages
+  //
+  static c3_d pam_d[4096];
+
+  size_t sys_i = sysconf(_SC_PAGESIZE);
+  c3_w   rat_w = _ce_page / sys_i;
+  c3_w   max_w = (sizeof(pam_d) / sizeof(c3_d)) / rat_w;
+  c3_w   dit_w = 0;
+  c3_w   i_w, j_w, num_w;
+  size_t siz_i;
+  off_t  off_i;
+  c3_zs  ret_zs;
+
+  while ( len_w ) {
+    num_w = c3_min(len_w, max_w);
+    siz_i = (size_t)num_w * rat_w * sizeof(c3_d);
+    off_i = ((c3_p)_ce_ptr(pag_w) / sys_i) * sizeof(c3_d);
+
+    if ( siz_i != (ret_zs = pread(u3P.pam_i, pam_d, siz_i, off_i)) ) {
+      if ( 0 < ret_zs ) {
+        fprintf(stderr, "loom: soft-dirty partial read: %"PRIc3_zs"\r\n",
+                        ret_zs);
+      }
+      else {
+        fprintf(stderr, "loom: soft-dirty read: %s\r\n", strerror(errno));
+      }
+      u3_assert(0);
+    }
+
+    for ( i_w = 0; i_w < num_w; i_w++, pag_w++ ) {
+      c3_w blk_w = pag_w >> 5;
+      c3_w bit_w = pag_w & 31;
+
+      if ( u3P.dit_w[blk_w] & ((c3_w)1 << bit_w) ) {
+        continue;
+      }
+
+      for ( j_w = 0; j_w < rat_w; j_w++ ) {
+        if ( pam_d[(i_w * rat_w) + j_w] & _ce_soft_bit ) {
+          u3P.dit_w[blk_w] |= ((c3_w)1 << bit_w);
+          dit_w++;
+          break;
+        }
+      }
+    }
+
+    len_w -= num_w;
+  }
+
+  return dit_w;
+}
+
 typedef enum {
   _ce_img_good = 0,
   _ce_img_fail = 1,
@@ -418,6 +657,94 @@ _ce_image_open(u3e_image* img_u, c3_c* ful_c)
   return _ce_image_stat(img_u, &img_u->pgs_w);
 }
 
+/* _ce_io_writev(): write [cnt_i] buffers at [off_z], resuming partial writes.
+*/
+static c3_i
+_ce_io_writev(c3_i fid_i, struct iovec* vec_u, c3_i cnt_i, c3_z off_z)
+{
+  c3_zs ret_zs;
+
+  while ( cnt_i ) {
+    _ce_sys_d++;
+
+    if ( 0 > (ret_zs = pwritev(fid_i, vec_u, cnt_i, off_z)) ) {
+      if ( EINTR == errno ) {
+        continue;
+      }
+      return -1;
+    }
+    else if ( !ret_zs ) {
+      errno = ENOSPC;
+      return -1;
+    }
+
+    off_z += ret_zs;
+
+    while ( cnt_i && (ret_zs >= (c3_zs)vec_u->iov_len) ) {
+      ret_zs -= vec_u->iov_len;
+      vec_u++;
+      cnt_i--;
+    }
+
+    if ( cnt_i ) {
+      vec_u->iov_base  = (c3_y*)vec_u->iov_base + ret_zs;
+      vec_u->iov_len  -= ret_zs;
+    }
+  }
+
+  return 0;
+}
+
+/* _ce_io_write(): write [len_z] bytes at [off_z], resuming partial writes.
+*/
+static c3_i
+_ce_io_write(c3_i fid_i, void* buf_v, c3_z len_z, c3_z off_z)
+{
+  struct iovec vec_u = { .iov_base = buf_v, .iov_len = len_z };
+  return _ce_io_writev(fid_i, &vec_u, 1, off_z);
+}
+
+/* _ce_io_read(): read [len_z] bytes at [off_z], resuming partial reads.
+*/
+static c3_i
+_ce_io_read(c3_i fid_i, void* buf_v, c3_z len_z, c3_z off_z)
+{
+  c3_y* buf_y = buf_v;
+  c3_zs ret_zs;
+
+  while ( len_z ) {
+    _ce_sys_d++;
+
+    if ( 0 > (ret_zs = pread(fid_i, buf_y, len_z, off_z)) ) {
+      if ( EINTR == errno ) {
+        continue;
+      }
+      return -1;
+    }
+    else if ( !ret_zs ) {
+      errno = EIO;  //  unexpected EOF
+      return -1;
+    }
+
+    buf_y += ret_zs;
+    off_z += ret_zs;
+    len_z -= ret_zs;
+  }
+
+  return 0;
+}
+
+/* _ce_io_ahead(): advise that [len_z] bytes at [off_z] will be read soon.
+*/
+static void
+_ce_io_ahead(c3_i fid_i, c3_z len_z, c3_z off_z)
+{
+#if defined(U3_OS_linux)
+  _ce_sys_d++;
+  posix_fadvise(fid_i, (off_t)off_z, (off_t)len_z, POSIX_FADV_WILLNEED);
+#endif
+}
+
 /* _ce_patch_write_control(): write control block file.
 */
 static void
@@ -427,6 +754,8 @@ _ce_patch_write_control(u3_ce_patch* pat_u)
   c3_w    len_w = sizeof(u3e_control) +
                   (pat_u->con_u->pgs_w * sizeof(u3e_line));
 
+  _ce_sys_d++;
+
   if ( len_w != (ret_i = write(pat_u->ctl_i, pat_u->con_u, len_w)) ) {
     if ( 0 < ret_i ) {
       fprintf(stderr, "loom: patch ctl partial write: %zu\r\n", (size_t)ret_i);
@@ -523,9 +852,8 @@ _ce_patch_delete(void)
 static c3_o
 _ce_patch_verify(u3_ce_patch* pat_u)
 {
-  c3_w  pag_w, mug_w;
-  c3_y  buf_y[_ce_page];
-  c3_zs ret_zs;
+  c3_w  pag_w, mug_w, pgs_w = pat_u->con_u->pgs_w;
+  c3_y* buf_y = 0;
   c3_o  sou_o = c3n;  // south seen
 
   if ( U3P_VERLAT != pat_u->con_u->ver_w ) {
@@ -541,29 +869,43 @@ _ce_patch_verify(u3_ce_patch* pat_u)
     return c3n;
   }
 
-  for ( c3_z i_z = 0; i_z < pat_u->con_u->pgs_w; i_z++ ) {
+  //  read in batches, with the next batch read ahead while mugging
+  //
+  for ( c3_z i_z = 0; i_z < pgs_w; i_z++ ) {
+    c3_z bat_z = i_z % _ce_io_pages;
+
     pag_w = pat_u->con_u->mem_u[i_z].pag_w;
     mug_w = pat_u->con_u->mem_u[i_z].mug_w;
 
-    if ( _ce_page !=
-         (ret_zs = pread(pat_u->mem_i, buf_y, _ce_page, _ce_len(i_z))) )
-    {
-      if ( 0 < ret_zs ) {
-        fprintf(stderr, "loom: patch partial read: %"PRIc3_zs"\r\n", ret_zs);
+    if ( !bat_z ) {
+      c3_z num_z = c3_min(_ce_io_pages, pgs_w - i_z);
+      c3_z nex_z = i_z + num_z;
+
+      if ( !buf_y ) {
+        buf_y = c3_malloc(_ce_len(_ce_io_pages));
       }
-      else {
+
+      if ( _ce_io_read(pat_u->mem_i, buf_y, _ce_len(num_z), _ce_len(i_z)) ) {
         fprintf(stderr, "loom: patch read: fail %s\r\n", strerror(errno));
+        c3_free(buf_y);
+        return c3n;
+      }
+
+      if ( nex_z < pgs_w ) {
+        _ce_io_ahead(pat_u->mem_i,
+                     _ce_len(c3_min(_ce_io_pages, pgs_w - nex_z)),
+                     _ce_len(nex_z));
       }
-      return c3n;
     }
 
     {
-      c3_w nug_w = _ce_mug_page(buf_y);
+      c3_w nug_w = _ce_mug_page(buf_y + _ce_len(bat_z));
 
       if ( mug_w != nug_w ) {
         fprintf(stderr, "loom: patch mug mismatch"
                         " %"PRIc3_w"/%"PRIc3_z"; (%"PRIxc3_w", %"PRIxc3_w")\r\n",
                         pag_w, i_z, mug_w, nug_w);
+        c3_free(buf_y);
         return c3n;
       }
 #if 0
@@ -579,10 +921,13 @@ _ce_patch_verify(u3_ce_patch* pat_u)
       }
       else {
         fprintf(stderr, "loom: patch multiple south pages\r\n");
+        c3_free(buf_y);
         return c3n;
       }
     }
   }
+
+  c3_free(buf_y);
   return c3y;
 }
 
@@ -645,29 +990,51 @@ _ce_patch_open(void)
   return pat_u;
 }
 
-/* _ce_patch_write_page(): write a page of patch memory.
+/* _ce_patch_write_flush(): write batched pages of patch memory.
 */
 static void
-_ce_patch_write_page(u3_ce_patch* pat_u,
-                     c3_w         pgc_w,
-                     c3_w*        mem_w)
+_ce_patch_write_flush(_ce_iov* iov_u)
 {
-  c3_zs ret_zs;
-
-  if ( _ce_page !=
-       (ret_zs = pwrite(pat_u->mem_i, mem_w, _ce_page, _ce_len(pgc_w))) )
-  {
-    if ( 0 < ret_zs ) {
-      fprintf(stderr, "loom: patch partial write: %"PRIc3_zs"\r\n", ret_zs);
-    }
-    else {
+  if ( iov_u->cnt_i ) {
+    if ( _ce_io_writev(iov_u->fid_i, iov_u->vec_u, iov_u->cnt_i,
+                       _ce_len(iov_u->pgc_w)) )
+    {
       fprintf(stderr, "loom: patch write: fail: %s\r\n", strerror(errno));
+      fprintf(stderr, "info: you probably have insufficient disk space");
+      u3_assert(0);
     }
-    fprintf(stderr, "info: you probably have insufficient disk space");
-    u3_assert(0);
+
+    iov_u->pgc_w += iov_u->len_w;
+    iov_u->len_w  = 0;
+    iov_u->cnt_i  = 0;
   }
 }
 
+/* _ce_patch_write_page(): batch a page of patch memory,
+**                         coalescing runs of adjacent loom pages.
+*/
+static void
+_ce_patch_write_page(_ce_iov* iov_u,
+                     c3_w*    mem_w)
+{
+  struct iovec* vec_u = iov_u->cnt_i ? &iov_u->vec_u[iov_u->cnt_i - 1] : 0;
+
+  if ( vec_u && ((c3_y*)vec_u->iov_base + vec_u->iov_len == (c3_y*)mem_w) ) {
+    vec_u->iov_len += _ce_page;
+  }
+  else {
+    if ( _ce_io_vecs == iov_u->cnt_i ) {
+      _ce_patch_write_flush(iov_u);
+    }
+
+    vec_u = &iov_u->vec_u[iov_u->cnt_i++];
+    vec_u->iov_base = mem_w;
+    vec_u->iov_len  = _ce_page;
+  }
+
+  iov_u->len_w++;
+}
+
 /* _ce_patch_count_page(): count a page, producing new counter.
 */
 static c3_w
@@ -687,6 +1054,7 @@ _ce_patch_count_page(c3_w pag_w,
 */
 static c3_w
 _ce_patch_save_page(u3_ce_patch* pat_u,
+                    _ce_iov*     iov_u,
                     c3_w         pag_w,
                     c3_w         pgc_w)
 {
@@ -703,57 +1071,67 @@ _ce_patch_save_page(u3_ce_patch* pat_u,
     fprintf(stderr, "loom: save page %d %x\r\n",
                     pag_w, pat_u->con_u->mem_u[pgc_w].mug_w);
 #endif
-    _ce_patch_write_page(pat_u, pgc_w, mem_w);
+    _ce_patch_write_page(iov_u, mem_w);
 
     pgc_w += 1;
   }
   return pgc_w;
 }
 
+/* _ce_patch_count(): count dirty pages.
+*/
+static c3_w
+_ce_patch_count(c3_w nor_w, c3_w sou_w)
+{
+  c3_w i_w, pgs_w = 0;
+
+  for ( i_w = 0; i_w < nor_w; i_w++ ) {
+    pgs_w = _ce_patch_count_page(i_w, pgs_w);
+  }
+  for ( i_w = 0; i_w < sou_w; i_w++ ) {
+    pgs_w = _ce_patch_count_page((u3P.pag_w - (i_w + 1)), pgs_w);
+  }
+
+  return pgs_w;
+}
+
 /* _ce_patch_compose(): make and write current patch.
 */
 static u3_ce_patch*
 _ce_patch_compose(c3_w nor_w, c3_w sou_w)
 {
-  c3_w pgs_w = 0;
+  c3_w pgs_w = _ce_patch_count(nor_w, sou_w);
 
 #ifdef U3_SNAPSHOT_VALIDATION
   u3K.nor_w = nor_w;
   u3K.sou_w = sou_w;
 #endif
 
-  /* Count dirty pages.
-  */
-  {
-    c3_w i_w;
-
-    for ( i_w = 0; i_w < nor_w; i_w++ ) {
-      pgs_w = _ce_patch_count_page(i_w, pgs_w);
-    }
-    for ( i_w = 0; i_w < sou_w; i_w++ ) {
-      pgs_w = _ce_patch_count_page((u3P.pag_w - (i_w + 1)), pgs_w);
-    }
-  }
-
   if ( !pgs_w ) {
     return 0;
   }
   else {
     u3_ce_patch* pat_u = c3_malloc(sizeof(u3_ce_patch));
+    _ce_iov*     iov_u = c3_calloc(sizeof(*iov_u));
     c3_w i_w, pgc_w;
 
     _ce_patch_create(pat_u);
     pat_u->con_u = c3_malloc(sizeof(u3e_control) + (pgs_w * sizeof(u3e_line)));
     pat_u->con_u->ver_w = U3P_VERLAT;
+    iov_u->fid_i = pat_u->mem_i;
     pgc_w = 0;
 
     for ( i_w = 0; i_w < nor_w; i_w++ ) {
-      pgc_w = _ce_patch_save_page(pat_u, i_w, pgc_w);
+      pgc_w = _ce_patch_save_page(pat_u, iov_u, i_w, pgc_w);
     }
     for ( i_w = 0; i_w < sou_w; i_w++ ) {
-      pgc_w = _ce_patch_save_page(pat_u, (u3P.pag_w - (i_w + 1)), pgc_w);
+      pgc_w = _ce_patch_save_page(pat_u, iov_u,
+                                  (u3P.pag_w - (i_w + 1)), pgc_w);
     }
 
+    _ce_patch_write_flush(iov_u);
+    c3_free(iov_u);
+
     u3_assert( pgc_w == pgs_w );
 
     pat_u->con_u->nor_w = nor_w;
@@ -770,6 +1148,8 @@ _ce_patch_compose(c3_w nor_w, c3_w sou_w)
 static void
 _ce_patch_sync(u3_ce_patch* pat_u)
 {
+  _ce_sys_d += 2;
+
   if ( -1 == c3_sync(pat_u->ctl_i) ) {
     fprintf(stderr, "loom: control file sync failed: %s\r\n",
                     strerror(errno));
@@ -788,6 +1168,8 @@ _ce_patch_sync(u3_ce_patch* pat_u)
 static c3_o
 _ce_image_sync(u3e_image* img_u)
 {
+  _ce_sys_d++;
+
   if ( -1 == c3_sync(img_u->fid_i) ) {
     fprintf(stderr, "loom: image (%s) sync failed: %s\r\n",
                     img_u->nam_c, strerror(errno));
@@ -813,6 +1195,8 @@ _ce_image_resize(u3e_image* img_u, c3_w pgs_w)
       u3_assert(0);
     }
 
+    _ce_sys_d++;
+
     if ( ftruncate(img_u->fid_i, off_i) ) {
       fprintf(stderr, "loom: image (%s) truncate: %s\r\n",
                       img_u->nam_c, strerror(errno));
@@ -828,70 +1212,74 @@ _ce_image_resize(u3e_image* img_u, c3_w pgs_w)
 static void
 _ce_patch_apply(u3_ce_patch* pat_u)
 {
-  c3_zs ret_zs;
-  c3_w     i_w;
+  c3_w  pgs_w = pat_u->con_u->pgs_w;
+  c3_w  nor_w = pat_u->con_u->nor_w;
+  u3e_line* mem_u = pat_u->con_u->mem_u;
+  c3_y* buf_y;
+  c3_w  i_w, j_w, k_w, num_w;
 
   //  resize images
   //
-  _ce_image_resize(&u3P.nor_u, pat_u->con_u->nor_w);
+  _ce_image_resize(&u3P.nor_u, nor_w);
   _ce_image_resize(&u3P.sou_u, pat_u->con_u->sou_w);
 
-  //  seek to begining of patch
-  //
-  if ( -1 == lseek(pat_u->mem_i, 0, SEEK_SET) ) {
-    fprintf(stderr, "loom: patch apply seek: %s\r\n", strerror(errno));
-    u3_assert(0);
+  if ( !pgs_w ) {
+    return;
   }
 
-  //  write patch pages into the appropriate image
+  buf_y = c3_malloc(_ce_len(c3_min(_ce_io_pages, pgs_w)));
+
+  //  write patch pages into the appropriate image, a batch at a time,
+  //  coalescing runs of adjacent north pages
   //
-  for ( i_w = 0; i_w < pat_u->con_u->pgs_w; i_w++ ) {
-    c3_w pag_w = pat_u->con_u->mem_u[i_w].pag_w;
-    c3_y buf_y[_ce_page];
-    c3_i fid_i;
-    c3_z off_z;
-
-    if ( pag_w < pat_u->con_u->nor_w ) {
-      fid_i = u3P.nor_u.fid_i;
-      off_z = _ce_len(pag_w);
-    }
-    //  NB: this assumes that there never more than one south page,
-    //  as enforced by _ce_patch_verify()
-    //
-    else {
-      fid_i = u3P.sou_u.fid_i;
-      off_z = 0;
+  for ( i_w = 0; i_w < pgs_w; i_w += num_w ) {
+    num_w = c3_min(_ce_io_pages, pgs_w - i_w);
+
+    if ( _ce_io_read(pat_u->mem_i, buf_y, _ce_len(num_w), _ce_len(i_w)) ) {
+      fprintf(stderr, "loom: patch apply read: %s\r\n", strerror(errno));
+      u3_assert(0);
     }
 
-    if ( _ce_page != (ret_zs = read(pat_u->mem_i, buf_y, _ce_page)) ) {
-      if ( 0 < ret_zs ) {
-        fprintf(stderr, "loom: patch apply partial read: %"PRIc3_zs"\r\n",
-                        ret_zs);
+    for ( j_w = 0; j_w < num_w; j_w = k_w ) {
+      c3_w pag_w = mem_u[i_w + j_w].pag_w;
+      c3_i fid_i;
+      c3_z off_z;
+
+      k_w = j_w + 1;
+
+      if ( pag_w < nor_w ) {
+        fid_i = u3P.nor_u.fid_i;
+        off_z = _ce_len(pag_w);
+
+        while (  (k_w < num_w)
+              && (mem_u[i_w + k_w].pag_w == (pag_w + (k_w - j_w)))
+              && (mem_u[i_w + k_w].pag_w < nor_w) )
+        {
+          k_w++;
+        }
       }
+      //  NB: this assumes that there never more than one south page,
+      //  as enforced by _ce_patch_verify()
+      //
       else {
-        fprintf(stderr, "loom: patch apply read: %s\r\n", strerror(errno));
+        fid_i = u3P.sou_u.fid_i;
+        off_z = 0;
       }
-      u3_assert(0);
-    }
-    else {
-      if ( _ce_page !=
-           (ret_zs = pwrite(fid_i, buf_y, _ce_page, off_z)) )
+
+      if ( _ce_io_write(fid_i, buf_y + _ce_len(j_w),
+                        _ce_len(k_w - j_w), off_z) )
       {
-        if ( 0 < ret_zs ) {
-          fprintf(stderr, "loom: patch apply partial write: %"PRIc3_zs"\r\n",
-                          ret_zs);
-        }
-        else {
-          fprintf(stderr, "loom: patch apply write: %s\r\n", strerror(errno));
-        }
+        fprintf(stderr, "loom: patch apply write: %s\r\n", strerror(errno));
         fprintf(stderr, "info: you probably have insufficient disk space");
         u3_assert(0);
       }
-    }
 #if 0
-    u3l_log("apply: %d, %x", pag_w, _ce_mug_page(buf_y));
+      u3l_log("apply: %d (%d pages)", pag_w, k_w - j_w);
 #endif
+    }
   }
+
+  c3_free(buf_y);
 }
 
 /* _ce_loom_track_sane(): quiescent page state invariants.
@@ -993,7 +1381,7 @@ _ce_loom_protect_north(c3_w pgs_w, c3_w old_w)
   c3_w dif_w = 0;
 
   if ( pgs_w ) {
-    if ( 0 != mprotect(_ce_ptr(0), _ce_len(pgs_w), PROT_READ) ) {
+    if ( 0 != mprotect(_ce_ptr(0), _ce_len(pgs_w), _ce_pure) ) {
       fprintf(stderr, "loom: pure north (%u pages): %s\r\n",
                       pgs_w, strerror(errno));
       u3_assert(0);
@@ -1037,7 +1425,7 @@ _ce_loom_protect_south(c3_w pgs_w, c3_w old_w)
   if ( pgs_w ) {
     if ( 0 != mprotect(_ce_ptr(u3P.pag_w - pgs_w),
                        _ce_len(pgs_w),
-                       PROT_READ) )
+                       _ce_pure) )
     {
       fprintf(stderr, "loom: pure south (%u pages): %s\r\n",
                       pgs_w, strerror(errno));
@@ -1090,31 +1478,28 @@ _ce_loom_mapf_ephemeral(void)
   }
 }
 
-/* _ce_loom_mapf_north(): map [pgs_w] of [fid_i] into the bottom of memory
-**                        (and ephemeralize [old_w - pgs_w] after if needed).
-**
-**   NB: _ce_loom_mapf_south() is possible, but it would make separate mappings
-**       for each page since the south segment is reversed on disk.
-**       in practice, the south segment is a single page (and always dirty);
-**       a file-backed mapping for it is just not worthwhile.
+/* _ce_loom_huge(): advise huge pages for [len_w] anonymous pages at [pag_w].
 */
 static void
-_ce_loom_mapf_north(c3_i fid_i, c3_w pgs_w, c3_w old_w)
+_ce_loom_huge(c3_w pag_w, c3_w len_w)
 {
-  c3_w dif_w = 0;
-
-  if ( pgs_w ) {
-    if ( MAP_FAILED == mmap(_ce_ptr(0),
-                            _ce_len(pgs_w),
-                            PROT_READ,
-                            (MAP_FIXED | MAP_PRIVATE),
-                            fid_i, 0) )
-    {
-      fprintf(stderr, "loom: file-backed mmap failed (%u pages): %s\r\n",
-                      pgs_w, strerror(errno));
-      u3_assert(0);
+#ifdef MADV_HUGEPAGE
+  if ( (u3C.wag_w & u3o_huge_page) && len_w ) {
+    if ( -1 == madvise(_ce_ptr(pag_w), _ce_len(len_w), MADV_HUGEPAGE) ) {
+      fprintf(stderr, "loom: madv_hugepage failed (%u pages at %u): %s\r\n",
+                      len_w, pag_w, strerror(errno));
     }
   }
+#endif
+}
+
+/* _ce_loom_anon_north(): ephemeralize [old_w - pgs_w] pages after [pgs_w],
+**                        producing the count.
+*/
+static c3_w
+_ce_loom_anon_north(c3_w pgs_w, c3_w old_w)
+{
+  c3_w dif_w = 0;
 
   if ( old_w > pgs_w ) {
     dif_w = old_w - pgs_w;
@@ -1142,6 +1527,8 @@ _ce_loom_mapf_north(c3_i fid_i, c3_w pgs_w, c3_w old_w)
                         pgs_w, old_w, strerror(errno));
         u3_assert(0);
       }
+
+      _ce_loom_huge(pgs_w, dif_w);
     }
 
 #ifdef U3_GUARD_PAGE
@@ -1156,7 +1543,80 @@ _ce_loom_mapf_north(c3_i fid_i, c3_w pgs_w, c3_w old_w)
 #endif
   }
 
-  _ce_loom_track_north(pgs_w, dif_w);
+  return dif_w;
+}
+
+/* _ce_loom_mapf_north(): map [pgs_w] of [fid_i] into the bottom of memory
+**                        (and ephemeralize [old_w - pgs_w] after if needed).
+**
+**   NB: _ce_loom_mapf_south() is possible, but it would make separate mappings
+**       for each page since the south segment is reversed on disk.
+**       in practice, the south segment is a single page (and always dirty);
+**       a file-backed mapping for it is just not worthwhile.
+*/
+static void
+_ce_loom_mapf_north(c3_i fid_i, c3_w pgs_w, c3_w old_w)
+{
+  if ( pgs_w ) {
+    if ( MAP_FAILED == mmap(_ce_ptr(0),
+                            _ce_len(pgs_w),
+                            _ce_pure,
+                            (MAP_FIXED | MAP_PRIVATE),
+                            fid_i, 0) )
+    {
+      fprintf(stderr, "loom: file-backed mmap failed (%u pages): %s\r\n",
+                      pgs_w, strerror(errno));
+      u3_assert(0);
+    }
+  }
+
+  _ce_loom_track_north(pgs_w, _ce_loom_anon_north(pgs_w, old_w));
+}
+
+/* _ce_loom_mapf_clean(): map clean runs of [pgs_w] of [fid_i] into the
+**                        bottom of memory, leaving dirty pages in place.
+*/
+static void
+_ce_loom_mapf_clean(c3_i fid_i, c3_w pgs_w)
+{
+  c3_w i_w = 0, j_w;
+
+  //  collect stores first, as new mappings are wholly soft-dirty
+  //
+  if ( 0 <= u3P.pam_i ) {
+    _ce_soft_scan(0, pgs_w);
+    _ce_soft_scan(u3P.pag_w - u3P.sou_u.pgs_w, u3P.sou_u.pgs_w);
+  }
+
+  while ( i_w < pgs_w ) {
+    if ( u3P.dit_w[i_w >> 5] & ((c3_w)1 << (i_w & 31)) ) {
+      i_w++;
+      continue;
+    }
+
+    for ( j_w = i_w + 1; j_w < pgs_w; j_w++ ) {
+      if ( u3P.dit_w[j_w >> 5] & ((c3_w)1 << (j_w & 31)) ) {
+        break;
+      }
+    }
+
+    if ( MAP_FAILED == mmap(_ce_ptr(i_w),
+                            _ce_len(j_w - i_w),
+                            _ce_pure,
+                            (MAP_FIXED | MAP_PRIVATE),
+                            fid_i, _ce_len(i_w)) )
+    {
+      fprintf(stderr, "loom: file-backed remap failed (%u pages at %u): %s\r\n",
+                      j_w - i_w, i_w, strerror(errno));
+      u3_assert(0);
+    }
+
+    i_w = j_w;
+  }
+
+  if ( 0 <= u3P.pam_i ) {
+    u3_assert( !_ce_soft_clear() );
+  }
 }
 
 /* _ce_loom_blit_north(): apply pages, in order, from the bottom of memory.
@@ -1288,62 +1748,41 @@ _ce_loom_fine(void)
 static c3_o
 _ce_image_copy(u3e_image* fom_u, u3e_image* tou_u)
 {
-  ssize_t ret_i;
-  c3_w      i_w;
+  c3_y* buf_y;
+  c3_w  i_w, num_w;
 
   //  resize images
   //
   _ce_image_resize(tou_u, fom_u->pgs_w);
 
-  //  seek to begining of patch and images
-  //
-  if (  (-1 == lseek(fom_u->fid_i, 0, SEEK_SET))
-     || (-1 == lseek(tou_u->fid_i, 0, SEEK_SET)) )
-  {
-    fprintf(stderr, "loom: image (%s) copy seek: %s\r\n",
-                    fom_u->nam_c,
-                    strerror(errno));
-    return c3n;
+  if ( !fom_u->pgs_w ) {
+    return c3y;
   }
 
-  //  copy pages into destination image
+  buf_y = c3_malloc(_ce_len(c3_min(_ce_io_pages, fom_u->pgs_w)));
+
+  //  copy pages into destination image, a batch at a time
   //
-  for ( i_w = 0; i_w < fom_u->pgs_w; i_w++ ) {
-    c3_y buf_y[_ce_page];
-    c3_w off_w = i_w;
-
-    if ( _ce_page != (ret_i = read(fom_u->fid_i, buf_y, _ce_page)) ) {
-      if ( 0 < ret_i ) {
-        fprintf(stderr, "loom: image (%s) copy partial read: %zu\r\n",
-                        fom_u->nam_c, (size_t)ret_i);
-      }
-      else {
-        fprintf(stderr, "loom: image (%s) copy read: %s\r\n",
-                        fom_u->nam_c, strerror(errno));
-      }
+  for ( i_w = 0; i_w < fom_u->pgs_w; i_w += num_w ) {
+    num_w = c3_min(_ce_io_pages, fom_u->pgs_w - i_w);
+
+    if ( _ce_io_read(fom_u->fid_i, buf_y, _ce_len(num_w), _ce_len(i_w)) ) {
+      fprintf(stderr, "loom: image (%s) copy read: %s\r\n",
+                      fom_u->nam_c, strerror(errno));
+      c3_free(buf_y);
       return c3n;
     }
-    else {
-      if ( -1 == lseek(tou_u->fid_i, _ce_len(off_w), SEEK_SET) ) {
-        fprintf(stderr, "loom: image (%s) copy seek: %s\r\n",
-                        tou_u->nam_c, strerror(errno));
-        return c3n;
-      }
-      if ( _ce_page != (ret_i = write(tou_u->fid_i, buf_y, _ce_page)) ) {
-        if ( 0 < ret_i ) {
-          fprintf(stderr, "loom: image (%s) copy partial write: %zu\r\n",
-                          tou_u->nam_c, (size_t)ret_i);
-        }
-        else {
-          fprintf(stderr, "loom: image (%s) copy write: %s\r\n",
-                          tou_u->nam_c, strerror(errno));
-        }
-        fprintf(stderr, "info: you probably have insufficient disk space");
-        return c3n;
-      }
+
+    if ( _ce_io_write(tou_u->fid_i, buf_y, _ce_len(num_w), _ce_len(i_w)) ) {
+      fprintf(stderr, "loom: image (%s) copy write: %s\r\n",
+                      tou_u->nam_c, strerror(errno));
+      fprintf(stderr, "info: you probably have insufficient disk space");
+      c3_free(buf_y);
+      return c3n;
     }
   }
 
+  c3_free(buf_y);
   return c3y;
 }
 
@@ -1427,6 +1866,126 @@ u3e_backup(c3_c* pux_c, c3_c* pax_c, c3_o ovw_o)
   return c3y;
 }
 
+/* _ce_save_report(): print snapshot wall time and syscall count.
+*/
+static void
+_ce_save_report(struct timeval* b4)
+{
+  struct timeval f2, d0;
+  c3_d mil_d;
+
+  gettimeofday(&f2, 0);
+  timersub(&f2, b4, &d0);
+  mil_d = ((c3_d)d0.tv_sec * 1000) + (d0.tv_usec / 1000);
+
+  fprintf(stderr, "sync: save: %" PRIu64 " ms, %" PRIu64 " syscalls\r\n",
+                  mil_d, _ce_sys_d);
+}
+
+/* _ce_save_chld(): write, apply, and sync a patch, in a forked child.
+*/
+static void
+_ce_save_chld(pid_t par_i, c3_w nor_w, c3_w sou_w)
+{
+  u3_ce_patch* pat_u;
+  struct timeval b4;
+
+#if defined(U3_OS_linux)
+  //  don't outlive the parent (see u3e_live() for recovery)
+  //
+  if ( prctl(PR_SET_PDEATHSIG, SIGKILL) || (getppid() != par_i) ) {
+    _exit(1);
+  }
+#endif
+
+  _ce_sys_d = 0;
+  gettimeofday(&b4, 0);
+
+  pat_u = _ce_patch_compose(nor_w, sou_w);
+
+  _ce_patch_sync(pat_u);
+
+  if ( c3n == _ce_patch_verify(pat_u) ) {
+    fprintf(stderr, "loom: background save failed\r\n");
+    _exit(1);
+  }
+
+  _ce_patch_apply(pat_u);
+
+  if (  (c3n == _ce_image_sync(&u3P.nor_u))
+     || (c3n == _ce_image_sync(&u3P.sou_u)) )
+  {
+    _exit(1);
+  }
+
+  _ce_patch_free(pat_u);
+  _ce_patch_delete();
+
+  if ( u3C.wag_w & u3o_verbose ) {
+    _ce_save_report(&b4);
+  }
+
+  _exit(0);
+}
+
+/* _ce_save_back(): save [nor_w] and [sou_w] pages in the background,
+**                  from [nod_w] and [sod_w]. c3n if not started.
+*/
+static c3_o
+_ce_save_back(c3_w nor_w, c3_w sou_w, c3_w nod_w, c3_w sod_w)
+{
+  c3_w  pgs_w = _ce_patch_count(nor_w, sou_w);
+  pid_t par_i = getpid();
+  pid_t pid_i;
+
+  if ( !pgs_w ) {
+    return c3n;
+  }
+
+  //  attempt to avoid propagating anything insane to disk
+  //
+  //    NB: checked here so that it also bails here, not in the child
+  //
+  u3a_loom_sane();
+
+  if ( -1 == (pid_i = fork()) ) {
+    fprintf(stderr, "loom: save fork: %s\r\n", strerror(errno));
+    return c3n;
+  }
+  else if ( !pid_i ) {
+    _ce_save_chld(par_i, nor_w, sou_w);
+  }
+
+  if ( u3C.wag_w & u3o_verbose ) {
+    u3a_print_memory(stderr, "sync: save (background)", pgs_w << u3a_page);
+  }
+
+  u3P.pid_i = pid_i;
+
+  //  the images are resized by the child; track as if already done
+  //
+  u3P.nor_u.pgs_w = nor_w;
+  u3P.sou_u.pgs_w = sou_w;
+
+  _ce_loom_protect_south(sou_w, sod_w);
+
+  //  NB: file-backed mappings are restored by u3e_wait()
+  //
+  if ( u3C.wag_w & u3o_no_demand ) {
+    _ce_loom_protect_north(nor_w, nod_w);
+  }
+  else {
+    _ce_loom_protect_north(nor_w, 0);
+    _ce_loom_track_north(nor_w, _ce_loom_anon_north(nor_w, nod_w));
+  }
+
+  if ( 0 <= u3P.pam_i ) {
+    u3_assert( !_ce_soft_clear() );
+  }
+
+  return c3y;
+}
+
 /*
   u3e_save(): save current changes.
 
@@ -1442,34 +2001,60 @@ u3e_backup(c3_c* pux_c, c3_c* pax_c, c3_o ovw_o)
   - Sync the image file.
   - Delete the patchfile and free it.
 
-  Once we've written the dirty pages to disk (and have reset their dirty bits
-  and protection flags), we *could* handle the rest of the checkpointing
-  process in a separate thread, but we'd need to wait until that finishes
-  before we try to make another snapshot.
+  With u3o_save_async, all of that happens in a forked child instead
+  (see _ce_save_back()), and we only wait for it before the next snapshot.
 */
 void
 u3e_save(u3_post low_p, u3_post hig_p)
 {
   u3_ce_patch* pat_u;
-  c3_w nod_w = u3P.nor_u.pgs_w;
-  c3_w sod_w = u3P.sou_u.pgs_w;
+  c3_w nod_w, sod_w, nor_w, sou_w;
+  struct timeval b4;
 
   if ( u3C.wag_w & u3o_dryrun ) {
     return;
   }
 
+  //  one snapshot at a time
+  //
+  u3e_wait(c3y);
+
+  nod_w = u3P.nor_u.pgs_w;
+  sod_w = u3P.sou_u.pgs_w;
+
   {
     c3_w nop_w = (low_p >> u3a_page);
-    c3_w nor_w = (low_p + (_ce_len_words(1) - 1)) >> u3a_page;
     c3_w sop_w = hig_p >> u3a_page;
 
+    nor_w = (low_p + (_ce_len_words(1) - 1)) >> u3a_page;
+    sou_w = u3P.pag_w - sop_w;
+
     u3_assert( (u3P.gar_w > nop_w) && (u3P.gar_w < sop_w) );
 
-    if ( !(pat_u = _ce_patch_compose(nor_w, u3P.pag_w - sop_w)) ) {
-      return;
+    //  collect stores to clean pages (only pages of the old segments)
+    //
+    if ( 0 <= u3P.pam_i ) {
+      c3_w sox_w = c3_min(sou_w, sod_w);
+
+      _ce_soft_scan(0, c3_min(nor_w, nod_w));
+      _ce_soft_scan(u3P.pag_w - sox_w, sox_w);
     }
   }
 
+  if (  (u3C.wag_w & u3o_save_async)
+     && (c3y == _ce_save_back(nor_w, sou_w, nod_w, sod_w)) )
+  {
+    u3e_toss(low_p, hig_p);
+    return;
+  }
+
+  _ce_sys_d = 0;
+  gettimeofday(&b4, 0);
+
+  if ( !(pat_u = _ce_patch_compose(nor_w, sou_w)) ) {
+    return;
+  }
+
   //  attempt to avoid propagating anything insane to disk
   //
   u3a_loom_sane();
@@ -1498,6 +2083,10 @@ u3e_save(u3_post low_p, u3_post hig_p)
   _ce_patch_free(pat_u);
   _ce_patch_delete();
 
+  if ( u3C.wag_w & u3o_verbose ) {
+    _ce_save_report(&b4);
+  }
+
 #ifdef U3_SNAPSHOT_VALIDATION
   {
     c3_w pgs_w;
@@ -1532,6 +2121,12 @@ u3e_save(u3_post low_p, u3_post hig_p)
     _ce_loom_mapf_north(u3P.nor_u.fid_i, u3P.nor_u.pgs_w, nod_w);
   }
 
+  //  NB: after any remapping, as new mappings are wholly soft-dirty
+  //
+  if ( 0 <= u3P.pam_i ) {
+    u3_assert( !_ce_soft_clear() );
+  }
+
   u3e_toss(low_p, hig_p);
 }
 
@@ -1560,6 +2155,94 @@ u3e_toss(u3_post low_p, u3_post hig_p)
   _ce_toss_pages(nor_w, sou_w);
 }
 
+/* _ce_loom_numa(): bind the loom (and this process) to NUMA node [nod_w].
+*/
+static c3_o
+_ce_loom_numa(c3_w nod_w)
+{
+#if defined(U3_OS_linux) && defined(SYS_set_mempolicy)
+  //  MPOL_BIND, from <linux/mempolicy.h>
+  //
+  const c3_i pol_i = 2;
+  c3_d       nod_d[16] = {0};
+  c3_c       pax_c[64];
+  c3_c       cpu_c[4096];
+  cpu_set_t  cpu_u;
+  FILE*      fil_u;
+
+  if ( nod_w >= (8 * sizeof(nod_d)) ) {
+    fprintf(stderr, "loom: numa: bad node %u\r\n", nod_w);
+    return c3n;
+  }
+
+  snprintf(pax_c, sizeof(pax_c), "/sys/devices/system/node/node%u/cpulist",
+                                 nod_w);
+
+  if (  !(fil_u = fopen(pax_c, "r"))
+     || !fgets(cpu_c, sizeof(cpu_c), fil_u) )
+  {
+    fprintf(stderr, "loom: numa: node %u: %s\r\n", nod_w,
+                    fil_u ? "no cpus" : strerror(errno));
+    if ( fil_u ) {
+      fclose(fil_u);
+    }
+    return c3n;
+  }
+
+  fclose(fil_u);
+
+  //  parse the node's cpu list ("0-7,16-23")
+  //
+  {
+    c3_c* cur_c = cpu_c;
+    c3_w  lo_w, hi_w;
+    c3_i  len_i;
+
+    CPU_ZERO(&cpu_u);
+
+    while ( 1 == sscanf(cur_c, "%u%n", &lo_w, &len_i) ) {
+      cur_c += len_i;
+      hi_w   = lo_w;
+
+      if (  ('-' == *cur_c)
+         && (1 == sscanf(cur_c + 1, "%u%n", &hi_w, &len_i)) )
+      {
+        cur_c += len_i + 1;
+      }
+
+      for ( ; (lo_w <= hi_w) && (lo_w < CPU_SETSIZE); lo_w++ ) {
+        CPU_SET(lo_w, &cpu_u);
+      }
+
+      if ( ',' != *cur_c ) {
+        break;
+      }
+      cur_c++;
+    }
+  }
+
+  //  NB: before any loom pages are touched, and inherited by any children
+  //
+  nod_d[nod_w >> 6] = (c3_d)1 << (nod_w & 63);
+
+  if ( syscall(SYS_set_mempolicy, pol_i, nod_d, (8 * sizeof(nod_d)) + 1) ) {
+    fprintf(stderr, "loom: numa: mempolicy (node %u): %s\r\n",
+                    nod_w, strerror(errno));
+    return c3n;
+  }
+
+  if ( sched_setaffinity(0, sizeof(cpu_u), &cpu_u) ) {
+    fprintf(stderr, "loom: numa: affinity (node %u): %s\r\n",
+                    nod_w, strerror(errno));
+  }
+
+  return c3y;
+#else
+  fprintf(stderr, "loom: numa: unsupported on this platform\r\n");
+  return c3n;
+#endif
+}
+
 /* u3e_live(): start the checkpointing system.
 */
 c3_o
@@ -1600,6 +2283,36 @@ u3e_live(c3_o nuu_o, c3_c* dir_c)
       }
     }
 
+    //  Background saves share the ephemeral file with the child.
+    //
+    if ( (u3C.wag_w & u3o_save_async) && (u3C.wag_w & u3o_swap) ) {
+      fprintf(stderr, "loom: background save incompatible with swap\r\n");
+      u3C.wag_w &= ~u3o_save_async;
+    }
+
+    //  Huge pages and NUMA placement assume an anonymous loom.
+    //
+    if (  (u3C.wag_w & u3o_swap)
+       && (u3C.wag_w & (u3o_huge_page | u3o_numa_node)) )
+    {
+      fprintf(stderr, "loom: huge pages and numa incompatible with swap\r\n");
+      u3C.wag_w &= ~(u3o_huge_page | u3o_numa_node);
+    }
+
+    if ( u3C.wag_w & u3o_numa_node ) {
+      if ( c3y == _ce_loom_numa(u3C.nod_w) ) {
+        u3l_log("boot: loom bound to numa node %u", u3C.nod_w);
+      }
+    }
+
+    //  Start soft-dirty tracking, if requested.
+    //
+    if ( u3C.wag_w & u3o_soft_dirty ) {
+      if ( c3y == _ce_soft_open() ) {
+        u3l_log("boot: soft-dirty page tracking");
+      }
+    }
+
     //  Open image files.
     //
     c3_c chk_c[8193];
@@ -1658,6 +2371,10 @@ u3e_live(c3_o nuu_o, c3_c* dir_c)
           _ce_loom_mapf_north(u3P.nor_u.fid_i, nor_w, 0);
         }
 
+        //  NB: before the south segment is faulted in
+        //
+        _ce_loom_huge(nor_w, u3P.pag_w - nor_w);
+
         _ce_loom_blit_south(u3P.sou_u.fid_i, sou_w);
 
         u3l_log("boot: protected loom");
@@ -1680,17 +2397,60 @@ u3e_live(c3_o nuu_o, c3_c* dir_c)
 #ifdef U3_GUARD_PAGE
       u3_assert( !_ce_ward_post(nor_w, u3P.pag_w - sou_w) );
 #endif
+
+      if ( 0 <= u3P.pam_i ) {
+        u3_assert( !_ce_soft_clear() );
+      }
     }
   }
 
   return nuu_o;
 }
 
+/* u3e_wait(): finish a background save, blocking if [blo_o].
+**             c3y if none remains.
+*/
+c3_o
+u3e_wait(c3_o blo_o)
+{
+  pid_t pid_i;
+  c3_i  sat_i;
+
+  if ( !u3P.pid_i ) {
+    return c3y;
+  }
+
+  do {
+    pid_i = waitpid(u3P.pid_i, &sat_i, _(blo_o) ? 0 : WNOHANG);
+  }
+  while ( (-1 == pid_i) && (EINTR == errno) );
+
+  if ( !pid_i ) {
+    return c3n;
+  }
+
+  //  pages have already been marked clean; the snapshot must be replayed
+  //
+  if ( (-1 == pid_i) || !WIFEXITED(sat_i) || WEXITSTATUS(sat_i) ) {
+    u3_assert(!"loom: background save failed");
+  }
+
+  u3P.pid_i = 0;
+
+  if ( !(u3C.wag_w & u3o_no_demand) ) {
+    _ce_loom_mapf_clean(u3P.nor_u.fid_i, u3P.nor_u.pgs_w);
+  }
+
+  return c3y;
+}
+
 /* u3e_stop(): gracefully stop the persistence system.
 */
 void
 u3e_stop(void)
 {
+  u3e_wait(c3y);
+
   if ( u3P.eph_i ) {
     _ce_toss_pages(u3P.nor_u.pgs_w, u3P.sou_u.pgs_w);
     close(u3P.eph_i);
@@ -1699,6 +2459,8 @@ u3e_stop(void)
 
   close(u3P.sou_u.fid_i);
   close(u3P.sou_u.fid_i);
+
+  _ce_soft_shut();
 }
 
 /* u3e_yolo(): disable dirty page tracking, read/write whole loom.
@@ -1731,6 +2493,36 @@ u3e_foul(void)
   memset((void*)u3P.dit_w, 0xff, sizeof(u3P.dit_w));
 }
 
+/* u3e_soil(): dirty the pages in [low_p, hig_p), ahead of off-thread writes.
+**
+**  Faults are handled (and the dirty bitmap updated) on one thread only,
+**  so memory written concurrently must be dirtied up front.
+*/
+void
+u3e_soil(u3_post low_p, u3_post hig_p)
+{
+  c3_w pag_w = low_p >> u3a_page;
+  c3_w end_w = (hig_p + ((1 << u3a_page) - 1)) >> u3a_page;
+
+  for ( ; pag_w < end_w; pag_w++ ) {
+    c3_w blk_w = pag_w >> 5;
+    c3_w bit_w = pag_w & 31;
+
+#ifdef U3_GUARD_PAGE
+    if ( pag_w == u3P.gar_w ) {
+      continue;
+    }
+#endif
+
+    //  write to the page, taking the usual fault if it's clean
+    //
+    if ( !(u3P.dit_w[blk_w] & ((c3_w)1 << bit_w)) ) {
+      volatile c3_w* wor_w = _ce_ptr(pag_w);
+      *wor_w = *wor_w;
+    }
+  }
+}
+
 /* u3e_init(): initialize guard page tracking, dirty loom
 */
 void
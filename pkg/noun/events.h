@@ -50,6 +50,9 @@
         c3_w      dit_w[u3a_pages >> 5];     //  touched since last save
         c3_w      pag_w;                     //  number of pages (<= u3a_pages)
         c3_w      gar_w;                     //  guard page
+        c3_i      pam_i;                     //  soft-dirty: pagemap, or -1
+        c3_i      cer_i;                     //  soft-dirty: clear_refs, or -1
+        c3_i      pid_i;                     //  background save, or 0
         u3e_image nor_u;                     //  north segment
         u3e_image sou_u;                     //  south segment
       } u3e_pool;
@@ -90,6 +93,12 @@
       void
       u3e_save(u3_post low_p, u3_post hig_p);
 
+    /* u3e_wait(): finish a background save, blocking if [blo_o].
+    **             c3y if none remains.
+    */
+      c3_o
+      u3e_wait(c3_o blo_o);
+
     /* u3e_toss(): discard ephemeral pages.
     */
       void
@@ -115,6 +124,11 @@
       void
       u3e_foul(void);
 
+    /* u3e_soil(): dirty pages in [low_p, hig_p), ahead of off-thread writes.
+    */
+      void
+      u3e_soil(u3_post low_p, u3_post hig_p);
+
     /* u3e_init(): initialize guard page tracking.
     */
       void
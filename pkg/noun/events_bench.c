@@ -0,0 +1,355 @@
+/// @file
+
+#include "noun.h"
+#include "events.h"
+#include "vortex.h"
+
+#include <sys/wait.h>
+
+/* _bench_mic(): microseconds since [b4].
+*/
+static c3_d
+_bench_mic(struct timeval* b4)
+{
+  struct timeval f2, d0;
+
+  gettimeofday(&f2, 0);
+  timersub(&f2, b4, &d0);
+  return ((c3_d)d0.tv_sec * 1000000) + d0.tv_usec;
+}
+
+/* _bench_touch(): store into [tou_w] pages of [buf_w], strided.
+*/
+static void
+_bench_touch(c3_w* buf_w, c3_w pgs_w, c3_w tou_w, c3_w rnd_w)
+{
+  c3_w i_w;
+
+  for ( i_w = 0; i_w < tou_w; i_w++ ) {
+    c3_w pag_w = (c3_w)((((c3_d)i_w * 7919) + rnd_w) % pgs_w);
+    buf_w[(size_t)pag_w << u3a_page] += 1;
+  }
+}
+
+/* _bench_pier(): remove a scratch pier.
+*/
+static void
+_bench_pier(c3_c* dir_c)
+{
+  c3_c pax_c[8193];
+
+  snprintf(pax_c, 8192, "%s/.urb/chk/north.bin", dir_c);
+  unlink(pax_c);
+  snprintf(pax_c, 8192, "%s/.urb/chk/south.bin", dir_c);
+  unlink(pax_c);
+  snprintf(pax_c, 8192, "%s/.urb/chk", dir_c);
+  rmdir(pax_c);
+  snprintf(pax_c, 8192, "%s/.urb", dir_c);
+  rmdir(pax_c);
+  rmdir(dir_c);
+}
+
+/* _bench_back(): time the first event after a snapshot, in a scratch pier.
+**
+**   the "event" stores into [tou_w] pages of a [pgs_w]-page working set,
+**   all of which are clean after the preceding save.
+*/
+static void
+_bench_back(c3_c* cap_c, c3_w wag_w, c3_w tou_w)
+{
+  c3_c dir_c[] = "/tmp/events-bench-XXXXXX";
+  c3_w pgs_w = 4096, max_w = 16;
+  c3_d eve_d = 0, hot_d = 0, sav_d = 0;
+  struct timeval b4;
+  c3_w  i_w, *buf_w;
+
+  if ( !mkdtemp(dir_c) ) {
+    fprintf(stderr, "events-bench: mkdtemp: %s\r\n", strerror(errno));
+    exit(1);
+  }
+
+  u3C.wag_w |= wag_w;
+  u3m_boot(dir_c, (size_t)1 << 30);
+
+  if ( (wag_w & u3o_soft_dirty) && (0 > u3P.pam_i) ) {
+    fprintf(stderr, "  %s: unavailable, skipped\r\n", cap_c);
+    u3m_stop();
+    _bench_pier(dir_c);
+    return;
+  }
+
+  //  page-aligned, so that each touch dirties exactly one page
+  //
+  buf_w = u3a_walloc((pgs_w + 1) << u3a_page);
+  buf_w = c3_align(buf_w, (size_t)1 << (u3a_page + 2), C3_ALGHI);
+  memset(buf_w, 0, (size_t)pgs_w << (u3a_page + 2));
+  u3m_save();
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    gettimeofday(&b4, 0);
+    _bench_touch(buf_w, pgs_w, tou_w, i_w);
+    eve_d += _bench_mic(&b4);
+
+    gettimeofday(&b4, 0);
+    _bench_touch(buf_w, pgs_w, tou_w, i_w);
+    hot_d += _bench_mic(&b4);
+
+    gettimeofday(&b4, 0);
+    u3m_save();
+    sav_d += _bench_mic(&b4);
+  }
+
+  fprintf(stderr, "  %s (%u of %u pages, %u rounds):\r\n",
+                  cap_c, tou_w, pgs_w, max_w);
+  fprintf(stderr, "    first event  %6" PRIu64 " us  (%" PRIu64 " ns/page)\r\n",
+                  eve_d / max_w, (eve_d * 1000) / ((c3_d)max_w * tou_w));
+  fprintf(stderr, "    next event   %6" PRIu64 " us\r\n", hot_d / max_w);
+  fprintf(stderr, "    save         %6" PRIu64 " us\r\n", sav_d / max_w);
+
+  u3m_stop();
+  _bench_pier(dir_c);
+}
+
+/* _bench_cmp(): compare latencies, for qsort().
+*/
+static int
+_bench_cmp(const void* a_v, const void* b_v)
+{
+  c3_d a_d = *(const c3_d*)a_v;
+  c3_d b_d = *(const c3_d*)b_v;
+
+  return ( a_d < b_d ) ? -1 : ( a_d > b_d );
+}
+
+/* _bench_spin(): compute for [mic_w] microseconds.
+*/
+static void
+_bench_spin(c3_w mic_w)
+{
+  struct timeval b4;
+
+  gettimeofday(&b4, 0);
+  while ( _bench_mic(&b4) < mic_w );
+}
+
+/* _bench_tail(): time events across periodic snapshots, in a scratch pier.
+**
+**   events each compute for [spn_w] microseconds and store into [tou_w]
+**   pages of a [pgs_w]-page working set; every [per_w]th is preceded by
+**   a save, which it waits behind.
+*/
+static void
+_bench_tail(c3_c* cap_c, c3_w wag_w, c3_w tou_w)
+{
+  c3_c  dir_c[] = "/tmp/events-bench-XXXXXX";
+  c3_w  pgs_w = 4096, max_w = 1000, per_w = 50, spn_w = 2000;
+  c3_d* lat_d = c3_malloc(sizeof(c3_d) * max_w);
+  c3_d  sav_d = 0;
+  struct timeval b4;
+  c3_w  i_w, *buf_w;
+
+  if ( !mkdtemp(dir_c) ) {
+    fprintf(stderr, "events-bench: mkdtemp: %s\r\n", strerror(errno));
+    exit(1);
+  }
+
+  u3C.wag_w |= wag_w;
+  u3m_boot(dir_c, (size_t)1 << 30);
+
+  buf_w = u3a_walloc((pgs_w + 1) << u3a_page);
+  buf_w = c3_align(buf_w, (size_t)1 << (u3a_page + 2), C3_ALGHI);
+  memset(buf_w, 0, (size_t)pgs_w << (u3a_page + 2));
+  u3m_save();
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    gettimeofday(&b4, 0);
+
+    if ( i_w && !(i_w % per_w) ) {
+      u3m_save();
+      sav_d = _bench_mic(&b4);
+    }
+
+    //  as in the serf, after each event
+    //
+    _bench_spin(spn_w);
+    _bench_touch(buf_w, pgs_w, tou_w, i_w * 104729);
+    u3e_wait(c3n);
+
+    lat_d[i_w] = _bench_mic(&b4);
+  }
+
+  u3e_wait(c3y);
+  qsort(lat_d, max_w, sizeof(c3_d), _bench_cmp);
+
+  fprintf(stderr, "  %s (%u events of %u us and %u pages, save every %u):\r\n",
+                  cap_c, max_w, spn_w, tou_w, per_w);
+  fprintf(stderr, "    p50 %6" PRIu64 " us  p99 %6" PRIu64 " us"
+                  "  max %6" PRIu64 " us  (last save %" PRIu64 " us)\r\n",
+                  lat_d[max_w / 2], lat_d[(max_w * 99) / 100],
+                  lat_d[max_w - 1], sav_d);
+
+  c3_free(lat_d);
+  u3m_stop();
+  _bench_pier(dir_c);
+}
+
+/* _bench_tree(): build a balanced tree of [len_w] cells from [cel].
+*/
+static u3_noun
+_bench_tree(u3_noun* cel, c3_w len_w)
+{
+  if ( 1 == len_w ) {
+    return cel[0];
+  }
+  else {
+    c3_w lef_w = len_w >> 1;
+    return u3nc(_bench_tree(cel, lef_w),
+                _bench_tree(cel + lef_w, len_w - lef_w));
+  }
+}
+
+/* _bench_walk(): chase each leaf cell of [tre].
+*/
+static c3_w
+_bench_walk(u3_noun tre)
+{
+  u3_noun hed = u3h(tre);
+
+  if ( c3y == u3a_is_atom(hed) ) {
+    return hed ^ u3t(tre);
+  }
+  else {
+    return _bench_walk(hed) + _bench_walk(u3t(tre));
+  }
+}
+
+/* _bench_pack(): time traversal and u3m_pack() of a kernel, in a scratch pier.
+**
+**   the "kernel" is a tree of [cel_w] cells in random order, each allocated
+**   beside discarded cells; traversal reads every cell, and compaction
+**   reclaims the rest.  no events are run: this measures loom placement
+**   under pointer-chasing, not replay.
+*/
+static void
+_bench_pack(c3_c* cap_c, c3_w wag_w, c3_w cel_w)
+{
+  c3_c     dir_c[] = "/tmp/events-bench-XXXXXX";
+  c3_w     max_w = 4, rnd_w = 1, sum_w = 0;
+  u3_noun* cel   = c3_malloc(sizeof(u3_noun) * cel_w);
+  c3_d     wak_d = 0, pak_d, wap_d = 0;
+  struct timeval b4;
+  c3_w     i_w;
+
+  if ( !mkdtemp(dir_c) ) {
+    fprintf(stderr, "events-bench: mkdtemp: %s\r\n", strerror(errno));
+    exit(1);
+  }
+
+  u3C.wag_w |= wag_w;
+  u3m_boot(dir_c, (size_t)1 << 31);
+
+  for ( i_w = 0; i_w < cel_w; i_w++ ) {
+    u3z(u3nc(i_w, u3_nul));
+    cel[i_w] = u3nc(i_w, i_w + 1);
+    u3z(u3nc(i_w, u3_nul));
+  }
+
+  //  shuffle
+  //
+  for ( i_w = cel_w - 1; i_w > 0; i_w-- ) {
+    c3_w    j_w;
+    u3_noun tmp;
+
+    rnd_w = (rnd_w * 1103515245) + 12345;
+    j_w   = rnd_w % (i_w + 1);
+    tmp   = cel[i_w];
+    cel[i_w] = cel[j_w];
+    cel[j_w] = tmp;
+  }
+
+  u3A->roc = _bench_tree(cel, cel_w);
+  c3_free(cel);
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    gettimeofday(&b4, 0);
+    sum_w += _bench_walk(u3A->roc);
+    wak_d += _bench_mic(&b4);
+  }
+
+  gettimeofday(&b4, 0);
+  u3m_pack();
+  pak_d = _bench_mic(&b4);
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    gettimeofday(&b4, 0);
+    sum_w += _bench_walk(u3A->roc);
+    wap_d += _bench_mic(&b4);
+  }
+
+  fprintf(stderr, "  %s (%u cells):\r\n", cap_c, cel_w);
+  fprintf(stderr, "    traverse     %6" PRIu64 " us  (%" PRIu64 " ns/cell)\r\n",
+                  wak_d / max_w, (wak_d * 1000) / ((c3_d)max_w * cel_w));
+  fprintf(stderr, "    pack         %6" PRIu64 " us\r\n", pak_d);
+  fprintf(stderr, "    after pack   %6" PRIu64 " us  (%x)\r\n",
+                  wap_d / max_w, sum_w);
+
+  u3m_stop();
+  _bench_pier(dir_c);
+}
+
+/* _bench_fork(): run a backend in its own process (and loom).
+*/
+static void
+_bench_fork(void (*fun_f)(c3_c*, c3_w, c3_w), c3_c* cap_c, c3_w wag_w,
+            c3_w tou_w)
+{
+  pid_t pid_i = fork();
+  c3_i  sat_i;
+
+  if ( -1 == pid_i ) {
+    fprintf(stderr, "events-bench: fork: %s\r\n", strerror(errno));
+    exit(1);
+  }
+  else if ( !pid_i ) {
+    fun_f(cap_c, wag_w, tou_w);
+    exit(0);
+  }
+  else if (  (-1 == waitpid(pid_i, &sat_i, 0))
+          || !WIFEXITED(sat_i)
+          || WEXITSTATUS(sat_i) )
+  {
+    fprintf(stderr, "events-bench: %s failed\r\n", cap_c);
+    exit(1);
+  }
+}
+
+/* main(): compare dirty page tracking backends and snapshot modes,
+**         at the given page counts; then time kernel traversal and
+**         compaction under each loom placement.
+*/
+int
+main(int argc, char* argv[])
+{
+  c3_w tou_w[] = { 64, 1024, 4096 };
+  c3_i   i_i, num_i = sizeof(tou_w) / sizeof(*tou_w);
+
+  fprintf(stderr, "events benchmark:\r\n");
+
+  for ( i_i = 0; i_i < ((argc > 1) ? (argc - 1) : num_i); i_i++ ) {
+    c3_w len_w = ( argc > 1 ) ? (c3_w)atoi(argv[i_i + 1]) : tou_w[i_i];
+
+    _bench_fork(_bench_back, "mprotect", 0, len_w);
+    _bench_fork(_bench_back, "soft-dirty", u3o_soft_dirty, len_w);
+    _bench_fork(_bench_tail, "save", 0, len_w);
+    _bench_fork(_bench_tail, "save-async", u3o_save_async, len_w);
+  }
+
+  fprintf(stderr, "kernel traversal and pack:\r\n");
+
+  _bench_fork(_bench_pack, "small pages", 0, 1 << 21);
+  _bench_fork(_bench_pack, "huge pages", u3o_huge_page, 1 << 21);
+  _bench_fork(_bench_pack, "huge pages, numa node 0",
+              u3o_huge_page | u3o_numa_node, 1 << 21);
+
+  return 0;
+}
@@ -473,7 +473,7 @@ _ch_trim_node(u3h_root* har_u, u3h_slot* sot_w, c3_w lef_w, c3_w rem_w)
 
   if ( !BIT_SET(map_w, bit_w) ) {
     har_u->arm_u.mug_w = _ch_skip_slot(har_u->arm_u.mug_w, lef_w);
-    return c3n;
+    return u3_none;
   }
 
   rem_w = CUT_END(rem_w, lef_w);
@@ -1398,3 +1398,591 @@ u3h_wyt(u3p(u3h_root) har_p)
   u3h_root* har_u = u3to(u3h_root, har_p);
   return har_u->use_w;
 }
+
+/**  Open-addressed variant.
+**/
+
+/* control bytes: empty, deleted, or a 7-bit hash tag.
+*/
+#define _CH_WIDE_EMPTY  0x80
+#define _CH_WIDE_DEAD   0xfe
+#define _CH_WIDE_LOBS   0x0101010101010101ULL
+#define _CH_WIDE_HIBS   0x8080808080808080ULL
+
+/* _ch_wide_mix(): 64-bit finalizer (murmur3 fmix64).
+*/
+static inline c3_d
+_ch_wide_mix(c3_d has_d)
+{
+  has_d ^= has_d >> 33;
+  has_d *= 0xff51afd7ed558ccdULL;
+  has_d ^= has_d >> 33;
+  has_d *= 0xc4ceb9fe1a85ec53ULL;
+  has_d ^= has_d >> 33;
+  return has_d;
+}
+
+/* _ch_wide_hash(): 64-bit hash of [key].
+*/
+static inline c3_d
+_ch_wide_hash(u3_noun key)
+{
+  if ( c3y == u3a_is_cat(key) ) {
+    return _ch_wide_mix(key);
+  }
+  else if ( c3y == u3a_is_cell(key) ) {
+    u3a_cell* cel_u = u3a_to_ptr(key);
+    return _ch_wide_mix(  ((c3_d)u3r_mug(cel_u->hed) << 32)
+                        ^ u3r_mug(cel_u->tel)
+                        ^ 0x1ULL << 63 );
+  }
+  else {
+    u3a_atom* vat_u = u3a_to_ptr(key);
+    return _ch_wide_mix(  ((c3_d)u3r_mug(key) << 32)
+                        ^ ((c3_d)vat_u->len_w << 16)
+                        ^ vat_u->buf_w[0] );
+  }
+}
+
+/* _ch_wide_ctl(): control bytes of [har_u].
+*/
+static inline c3_y*
+_ch_wide_ctl(u3h_wide* har_u)
+{
+  return (c3_y*)(u3to(c3_w, har_u->sot_p) + har_u->len_w);
+}
+
+/* _ch_wide_group(): load group [gop_w] of control bytes.
+*/
+static inline c3_d
+_ch_wide_group(c3_y* ctl_y, c3_w gop_w)
+{
+  c3_d ctl_d;
+  memcpy(&ctl_d, ctl_y + ((c3_d)gop_w << 3), 8);
+  return ctl_d;
+}
+
+/* _ch_wide_match(): bytes of [ctl_d] equal to [tag_y], as high bits.
+**
+**   may have false positives (following a true one), never negatives.
+*/
+static inline c3_d
+_ch_wide_match(c3_d ctl_d, c3_y tag_y)
+{
+  c3_d cmp_d = ctl_d ^ (_CH_WIDE_LOBS * tag_y);
+  return (cmp_d - _CH_WIDE_LOBS) & ~cmp_d & _CH_WIDE_HIBS;
+}
+
+/* _ch_wide_empty(): empty bytes of [ctl_d], as high bits.
+*/
+static inline c3_d
+_ch_wide_empty(c3_d ctl_d)
+{
+  return ctl_d & ~(ctl_d << 6) & _CH_WIDE_HIBS;
+}
+
+/* _ch_wide_free(): empty or deleted bytes of [ctl_d], as high bits.
+*/
+static inline c3_d
+_ch_wide_free(c3_d ctl_d)
+{
+  return ctl_d & _CH_WIDE_HIBS;
+}
+
+/* _ch_wide_data(): allocate slots and control bytes.
+*/
+static c3_w*
+_ch_wide_data(c3_w len_w)
+{
+  c3_w* sot_w = u3a_walloc(len_w + (len_w >> 2));
+
+  memset(sot_w, 0, len_w * sizeof(c3_w));
+  memset(sot_w + len_w, _CH_WIDE_EMPTY, len_w);
+  return sot_w;
+}
+
+/* _ch_wide_find(): slot index of [key], or [len_w] if absent.
+*/
+static c3_w
+_ch_wide_find(u3h_wide* har_u, u3_noun key, c3_d has_d)
+{
+  c3_w* sot_w = u3to(c3_w, har_u->sot_p);
+  c3_y* ctl_y = (c3_y*)(sot_w + har_u->len_w);
+  c3_w  msk_w = (har_u->len_w >> 3) - 1;
+  c3_w  gop_w = (c3_w)(has_d >> 7) & msk_w;
+  c3_y  tag_y = has_d & 0x7f;
+  c3_w  i_w;
+
+  for ( i_w = 1; ; i_w++ ) {
+    c3_d ctl_d = _ch_wide_group(ctl_y, gop_w);
+    c3_d mat_d = _ch_wide_match(ctl_d, tag_y);
+
+    while ( mat_d ) {
+      c3_w inx_w = (gop_w << 3) + (c3_tz_d(mat_d) >> 3);
+      u3_noun kev = u3h_slot_to_noun(sot_w[inx_w]);
+
+      if ( (tag_y == ctl_y[inx_w]) && (c3y == u3r_sing(key, u3h(kev))) ) {
+        return inx_w;
+      }
+      mat_d &= mat_d - 1;
+    }
+
+    if ( _ch_wide_empty(ctl_d) ) {
+      return har_u->len_w;
+    }
+
+    //  triangular probing visits every group
+    //
+    gop_w = (gop_w + i_w) & msk_w;
+  }
+}
+
+/* _ch_wide_hole(): index of first empty or deleted slot for [has_d].
+*/
+static c3_w
+_ch_wide_hole(c3_y* ctl_y, c3_w len_w, c3_d has_d)
+{
+  c3_w msk_w = (len_w >> 3) - 1;
+  c3_w gop_w = (c3_w)(has_d >> 7) & msk_w;
+  c3_w i_w;
+
+  for ( i_w = 1; ; i_w++ ) {
+    c3_d fre_d = _ch_wide_free(_ch_wide_group(ctl_y, gop_w));
+
+    if ( fre_d ) {
+      return (gop_w << 3) + (c3_tz_d(fre_d) >> 3);
+    }
+    gop_w = (gop_w + i_w) & msk_w;
+  }
+}
+
+/* _ch_wide_grow(): rehash into [len_w] slots, dropping tombstones.
+*/
+static void
+_ch_wide_grow(u3h_wide* har_u, c3_w len_w)
+{
+  c3_w* sot_w = u3to(c3_w, har_u->sot_p);
+  c3_y* ctl_y = _ch_wide_ctl(har_u);
+  c3_w* tos_w = _ch_wide_data(len_w);
+  c3_y* ltc_y = (c3_y*)(tos_w + len_w);
+  c3_w  i_w;
+
+  for ( i_w = 0; i_w < har_u->len_w; i_w++ ) {
+    if ( !(ctl_y[i_w] & 0x80) ) {
+      u3_noun kev   = u3h_slot_to_noun(sot_w[i_w]);
+      c3_d    has_d = _ch_wide_hash(u3h(kev));
+      c3_w    inx_w = _ch_wide_hole(ltc_y, len_w, has_d);
+
+      tos_w[inx_w] = sot_w[i_w];
+      ltc_y[inx_w] = has_d & 0x7f;
+    }
+  }
+
+  u3a_wfree(sot_w);
+  har_u->sot_p = u3of(c3_w, tos_w);
+  har_u->len_w = len_w;
+  har_u->tom_w = 0;
+  har_u->arm_w = 0;
+}
+
+/* _ch_wide_kill(): clear slot [inx_w], producing its entry.
+*/
+static u3_noun
+_ch_wide_kill(u3h_wide* har_u, c3_w inx_w)
+{
+  c3_w* sot_w = u3to(c3_w, har_u->sot_p);
+  c3_y* ctl_y = (c3_y*)(sot_w + har_u->len_w);
+  u3_noun kev = u3h_slot_to_noun(sot_w[inx_w]);
+
+  //  if this group has an empty slot, no probe has ever passed
+  //  through it, and the slot can be emptied outright.
+  //
+  if ( _ch_wide_empty(_ch_wide_group(ctl_y, inx_w >> 3)) ) {
+    ctl_y[inx_w] = _CH_WIDE_EMPTY;
+  }
+  else {
+    ctl_y[inx_w] = _CH_WIDE_DEAD;
+    har_u->tom_w++;
+  }
+
+  sot_w[inx_w] = 0;
+  har_u->use_w--;
+  return kev;
+}
+
+/* _ch_wide_trim(): evict one entry by clock, producing it.
+*/
+static u3_noun
+_ch_wide_trim(u3h_wide* har_u)
+{
+  c3_w* sot_w = u3to(c3_w, har_u->sot_p);
+  c3_y* ctl_y = (c3_y*)(sot_w + har_u->len_w);
+
+  u3_assert( har_u->use_w );
+
+  while ( 1 ) {
+    c3_w inx_w = har_u->arm_w;
+
+    har_u->arm_w = (inx_w + 1) & (har_u->len_w - 1);
+
+    if ( !(ctl_y[inx_w] & 0x80) ) {
+      if ( c3y == u3h_slot_is_warm(sot_w[inx_w]) ) {
+        sot_w[inx_w] = u3h_noun_be_cold(sot_w[inx_w]);
+      }
+      else {
+        return _ch_wide_kill(har_u, inx_w);
+      }
+    }
+  }
+}
+
+/* u3h_wide_new_cache(): create open-addressed hashtable with bounded size.
+*/
+u3p(u3h_wide)
+u3h_wide_new_cache(c3_w max_w)
+{
+  u3h_wide* har_u = u3a_walloc(c3_wiseof(u3h_wide));
+
+  har_u->max_w = max_w;
+  har_u->use_w = 0;
+  har_u->tom_w = 0;
+  har_u->len_w = 8;
+  har_u->arm_w = 0;
+  har_u->sot_p = u3of(c3_w, _ch_wide_data(har_u->len_w));
+
+  return u3of(u3h_wide, har_u);
+}
+
+/* u3h_wide_new(): create open-addressed hashtable.
+*/
+u3p(u3h_wide)
+u3h_wide_new(void)
+{
+  return u3h_wide_new_cache(0);
+}
+
+/* u3h_wide_put_get(): insert in hashtable, returning deleted entry.
+**
+** `key` is RETAINED; `val` is transferred.
+*/
+u3_weak
+u3h_wide_put_get(u3p(u3h_wide) har_p, u3_noun key, u3_noun val)
+{
+  u3h_wide* har_u = u3to(u3h_wide, har_p);
+  u3_noun   kev   = u3nc(u3k(key), val);
+  c3_d      has_d = _ch_wide_hash(key);
+  c3_w      inx_w = _ch_wide_find(har_u, key, has_d);
+  c3_w*     sot_w;
+
+  if ( inx_w < har_u->len_w ) {
+    sot_w = u3to(c3_w, har_u->sot_p);
+    u3z(u3h_slot_to_noun(sot_w[inx_w]));
+    sot_w[inx_w] = u3h_noun_be_warm(u3h_noun_to_slot(kev));
+    return u3_none;
+  }
+
+  //  keep load (with tombstones) under 7/8, growing at 7/16
+  //
+  if ( ((c3_d)har_u->use_w + har_u->tom_w + 1) * 8 > (c3_d)har_u->len_w * 7 ) {
+    c3_w len_w = har_u->len_w;
+
+    if ( ((c3_d)har_u->use_w + 1) * 16 > (c3_d)len_w * 7 ) {
+      u3_assert( len_w < (1U << 31) );
+      len_w <<= 1;
+    }
+    _ch_wide_grow(har_u, len_w);
+  }
+
+  {
+    c3_y* ctl_y = _ch_wide_ctl(har_u);
+
+    sot_w = u3to(c3_w, har_u->sot_p);
+    inx_w = _ch_wide_hole(ctl_y, har_u->len_w, has_d);
+
+    if ( _CH_WIDE_DEAD == ctl_y[inx_w] ) {
+      har_u->tom_w--;
+    }
+    ctl_y[inx_w] = has_d & 0x7f;
+    sot_w[inx_w] = u3h_noun_be_warm(u3h_noun_to_slot(kev));
+    har_u->use_w++;
+  }
+
+  if ( har_u->max_w && (har_u->use_w > har_u->max_w) ) {
+    return _ch_wide_trim(har_u);
+  }
+
+  return u3_none;
+}
+
+/* u3h_wide_put(): insert in hashtable.
+**
+** `key` is RETAINED; `val` is transferred.
+*/
+void
+u3h_wide_put(u3p(u3h_wide) har_p, u3_noun key, u3_noun val)
+{
+  u3_weak del = u3h_wide_put_get(har_p, key, val);
+
+  if ( u3_none != del ) {
+    u3z(del);
+  }
+}
+
+/* u3h_wide_git(): read from hashtable, retaining result.
+**
+** `key` is RETAINED; result is RETAINED.
+*/
+u3_weak
+u3h_wide_git(u3p(u3h_wide) har_p, u3_noun key)
+{
+  u3h_wide* har_u = u3to(u3h_wide, har_p);
+  c3_w      inx_w = _ch_wide_find(har_u, key, _ch_wide_hash(key));
+
+  if ( inx_w == har_u->len_w ) {
+    return u3_none;
+  }
+  else {
+    c3_w* sot_w = u3to(c3_w, har_u->sot_p);
+
+    sot_w[inx_w] = u3h_noun_be_warm(sot_w[inx_w]);
+    return u3t(u3h_slot_to_noun(sot_w[inx_w]));
+  }
+}
+
+/* u3h_wide_get(): read from hashtable.
+**
+** `key` is RETAINED; result is PRODUCED.
+*/
+u3_weak
+u3h_wide_get(u3p(u3h_wide) har_p, u3_noun key)
+{
+  u3_weak pro = u3h_wide_git(har_p, key);
+
+  if ( u3_none != pro ) {
+    u3k(pro);
+  }
+  return pro;
+}
+
+/* u3h_wide_del(): delete from hashtable.
+**
+** `key` is RETAINED.
+*/
+void
+u3h_wide_del(u3p(u3h_wide) har_p, u3_noun key)
+{
+  u3h_wide* har_u = u3to(u3h_wide, har_p);
+  c3_w      inx_w = _ch_wide_find(har_u, key, _ch_wide_hash(key));
+
+  if ( inx_w < har_u->len_w ) {
+    u3z(_ch_wide_kill(har_u, inx_w));
+  }
+}
+
+/* u3h_wide_trim_with(): trim to n key-value pairs, with deletion callback.
+*/
+void
+u3h_wide_trim_with(u3p(u3h_wide) har_p, c3_w n_w, void (*del_cb)(u3_noun))
+{
+  u3h_wide* har_u = u3to(u3h_wide, har_p);
+
+  while ( har_u->use_w > n_w ) {
+    del_cb(_ch_wide_trim(har_u));
+  }
+}
+
+/* u3h_wide_trim_to(): trim to n key-value pairs.
+*/
+void
+u3h_wide_trim_to(u3p(u3h_wide) har_p, c3_w n_w)
+{
+  u3h_wide_trim_with(har_p, n_w, u3a_lose);
+}
+
+/* u3h_wide_walk_with(): traverse hashtable with key, value fn and data
+**                       argument; RETAINS.
+*/
+void
+u3h_wide_walk_with(u3p(u3h_wide) har_p,
+                   void        (*fun_f)(u3_noun, void*),
+                   void*         wit)
+{
+  u3h_wide* har_u = u3to(u3h_wide, har_p);
+  c3_w*     sot_w = u3to(c3_w, har_u->sot_p);
+  c3_y*     ctl_y = _ch_wide_ctl(har_u);
+  c3_w        i_w;
+
+  for ( i_w = 0; i_w < har_u->len_w; i_w++ ) {
+    if ( !(ctl_y[i_w] & 0x80) ) {
+      fun_f(u3h_slot_to_noun(sot_w[i_w]), wit);
+    }
+  }
+}
+
+/* u3h_wide_walk(): u3h_wide_walk_with, but with no data argument.
+*/
+void
+u3h_wide_walk(u3p(u3h_wide) har_p, void (*fun_f)(u3_noun))
+{
+  u3h_wide_walk_with(har_p, _ch_walk_plain, (void *)fun_f);
+}
+
+/* _ch_wide_free_with(): u3h_wide_walk_with() cb for u3h_wide_free().
+*/
+static void
+_ch_wide_free_with(u3_noun kev, void* wit)
+{
+  u3z(kev);
+}
+
+/* u3h_wide_free(): free hashtable.
+*/
+void
+u3h_wide_free(u3p(u3h_wide) har_p)
+{
+  u3h_wide* har_u = u3to(u3h_wide, har_p);
+
+  u3h_wide_walk_with(har_p, _ch_wide_free_with, 0);
+  u3a_wfree(u3to(c3_w, har_u->sot_p));
+  u3a_wfree(har_u);
+}
+
+/* _ch_wide_mark_with(): u3h_wide_walk_with() cb for u3h_wide_mark().
+*/
+static void
+_ch_wide_mark_with(u3_noun kev, void* wit)
+{
+  c3_w* tot_w = wit;
+  *tot_w += u3a_mark_noun(kev);
+}
+
+/* u3h_wide_mark(): mark hashtable for gc.
+*/
+c3_w
+u3h_wide_mark(u3p(u3h_wide) har_p)
+{
+  u3h_wide* har_u = u3to(u3h_wide, har_p);
+  c3_w      tot_w = 0;
+
+  u3h_wide_walk_with(har_p, _ch_wide_mark_with, &tot_w);
+  tot_w += u3a_mark_ptr(u3to(c3_w, har_u->sot_p));
+  tot_w += u3a_mark_ptr(har_u);
+
+  return tot_w;
+}
+
+/* _ch_wide_count_with(): u3h_wide_walk_with() cb for u3h_wide_count().
+*/
+static void
+_ch_wide_count_with(u3_noun kev, void* wit)
+{
+  c3_w* tot_w = wit;
+  *tot_w += u3a_count_noun(kev);
+}
+
+/* u3h_wide_count(): count hashtable for gc.
+*/
+c3_w
+u3h_wide_count(u3p(u3h_wide) har_p)
+{
+  u3h_wide* har_u = u3to(u3h_wide, har_p);
+  c3_w      tot_w = 0;
+
+  u3h_wide_walk_with(har_p, _ch_wide_count_with, &tot_w);
+  tot_w += u3a_count_ptr(u3to(c3_w, har_u->sot_p));
+  tot_w += u3a_count_ptr(har_u);
+
+  return tot_w;
+}
+
+/* _ch_wide_discount_with(): u3h_wide_walk_with() cb for u3h_wide_discount().
+*/
+static void
+_ch_wide_discount_with(u3_noun kev, void* wit)
+{
+  c3_w* tot_w = wit;
+  *tot_w += u3a_discount_noun(kev);
+}
+
+/* u3h_wide_discount(): discount hashtable for gc.
+*/
+c3_w
+u3h_wide_discount(u3p(u3h_wide) har_p)
+{
+  u3h_wide* har_u = u3to(u3h_wide, har_p);
+  c3_w      tot_w = 0;
+
+  u3h_wide_walk_with(har_p, _ch_wide_discount_with, &tot_w);
+  tot_w += u3a_discount_ptr(u3to(c3_w, har_u->sot_p));
+  tot_w += u3a_discount_ptr(har_u);
+
+  return tot_w;
+}
+
+/* u3h_wide_rewrite(): rewrite pointers during compaction.
+*/
+void
+u3h_wide_rewrite(u3p(u3h_wide) har_p)
+{
+  u3h_wide* har_u = u3to(u3h_wide, har_p);
+  c3_w*     sot_w = u3to(c3_w, har_u->sot_p);
+  c3_y*     ctl_y = _ch_wide_ctl(har_u);
+  c3_w        i_w;
+
+  if ( c3n == u3a_rewrite_ptr(har_u) ) return;
+
+  for ( i_w = 0; i_w < har_u->len_w; i_w++ ) {
+    if ( !(ctl_y[i_w] & 0x80) ) {
+      u3_noun kev = u3h_slot_to_noun(sot_w[i_w]);
+      sot_w[i_w]  = u3h_noun_to_slot(u3a_rewritten_noun(kev));
+
+      u3a_rewrite_noun(kev);
+    }
+  }
+
+  u3a_rewrite_ptr(sot_w);
+  har_u->sot_p = u3a_rewritten(har_u->sot_p);
+}
+
+/* u3h_wide_take_with(): gain hashtable, copying junior keys
+** and calling [fun_f] on values.
+*/
+u3p(u3h_wide)
+u3h_wide_take_with(u3p(u3h_wide) har_p, u3_funk fun_f)
+{
+  u3h_wide*     har_u = u3to(u3h_wide, har_p);
+  c3_w*         sot_w = u3to(c3_w, har_u->sot_p);
+  c3_y*         ctl_y = _ch_wide_ctl(har_u);
+  u3h_wide*     rah_u = u3a_walloc(c3_wiseof(u3h_wide));
+  c3_w*         tos_w = _ch_wide_data(har_u->len_w);
+  c3_w            i_w;
+
+  *rah_u = *har_u;
+  rah_u->sot_p = u3of(c3_w, tos_w);
+  memcpy(tos_w + har_u->len_w, ctl_y, har_u->len_w);
+
+  for ( i_w = 0; i_w < har_u->len_w; i_w++ ) {
+    if ( !(ctl_y[i_w] & 0x80) ) {
+      tos_w[i_w] = _ch_take_noun(sot_w[i_w], fun_f);
+    }
+  }
+
+  return u3of(u3h_wide, rah_u);
+}
+
+/* u3h_wide_take(): gain hashtable, copying junior nouns.
+*/
+u3p(u3h_wide)
+u3h_wide_take(u3p(u3h_wide) har_p)
+{
+  return u3h_wide_take_with(har_p, u3a_take);
+}
+
+/* u3h_wide_wyt(): number of entries.
+*/
+c3_w
+u3h_wide_wyt(u3p(u3h_wide) har_p)
+{
+  u3h_wide* har_u = u3to(u3h_wide, har_p);
+  return har_u->use_w;
+}
@@ -59,6 +59,33 @@
           u3h_slot sot_w[];   // filled slots
         } u3h_buck;
 
+    /**  Open-addressed variant, keyed by a 64-bit hash.
+    ***
+    ***  Selected per table, with u3h_wide_new() and friends.  For
+    ***  large tables, where the HAMT costs a cache miss per level
+    ***  and collides in the 31-bit mug space.
+    ***
+    ***  The hash of a cell combines the mugs of its head and tail,
+    ***  that of a direct atom is the atom itself; both are nearly
+    ***  free given cached mugs.  Slots are grouped by 8, and each has
+    ***  a control byte: empty, deleted, or the low 7 bits of the hash.
+    ***  A probe matches all 8 control bytes of a group at once (as a
+    ***  64-bit word), and compares keys only where the tags match.
+    ***
+    ***  Entries are u3h_slots, so bounded tables use the same
+    ***  clock reclamation policy as the HAMT.
+    **/
+      /* u3h_wide: open-addressed hashtable.
+      */
+        typedef struct {
+          c3_w      max_w;    // max entries (0 for no trimming)
+          c3_w      use_w;    // live entries
+          c3_w      tom_w;    // deleted entries (tombstones)
+          c3_w      len_w;    // slots (power of 2, at least 8)
+          c3_w      arm_w;    // clock arm (slot index)
+          u3p(c3_w) sot_p;    // [len_w] slots, then [len_w] control bytes
+        } u3h_wide;
+
     /**  HAMT macros.
     ***
     ***  Coordinate with u3_noun definition!
@@ -203,4 +230,117 @@
         c3_w
         u3h_wyt(u3p(u3h_root) har_p);
 
+    /**  Open-addressed variant: as above, but for u3h_wide.
+    **/
+      /* u3h_wide_new_cache(): create open-addressed hashtable with bounded size.
+      */
+        u3p(u3h_wide)
+        u3h_wide_new_cache(c3_w max_w);
+
+      /* u3h_wide_new(): create open-addressed hashtable.
+      */
+        u3p(u3h_wide)
+        u3h_wide_new(void);
+
+      /* u3h_wide_put(): insert in hashtable.
+      **
+      ** `key` is RETAINED; `val` is transferred.
+      */
+        void
+        u3h_wide_put(u3p(u3h_wide) har_p, u3_noun key, u3_noun val);
+
+      /* u3h_wide_put_get(): insert in hashtable, returning deleted entry.
+      **
+      ** `key` is RETAINED; `val` is transferred.
+      */
+        u3_weak
+        u3h_wide_put_get(u3p(u3h_wide) har_p, u3_noun key, u3_noun val);
+
+      /* u3h_wide_get(): read from hashtable.
+      **
+      ** `key` is RETAINED; result is PRODUCED.
+      */
+        u3_weak
+        u3h_wide_get(u3p(u3h_wide) har_p, u3_noun key);
+
+      /* u3h_wide_git(): read from hashtable, retaining result.
+      **
+      ** `key` is RETAINED; result is RETAINED.
+      */
+        u3_weak
+        u3h_wide_git(u3p(u3h_wide) har_p, u3_noun key);
+
+      /* u3h_wide_del(): delete from hashtable.
+      **
+      ** `key` is RETAINED.
+      */
+        void
+        u3h_wide_del(u3p(u3h_wide) har_p, u3_noun key);
+
+      /* u3h_wide_trim_with(): trim to n key-value pairs, with deletion callback.
+      */
+        void
+        u3h_wide_trim_with(u3p(u3h_wide) har_p,
+                           c3_w          n_w,
+                           void        (*del_cb)(u3_noun));
+
+      /* u3h_wide_trim_to(): trim to n key-value pairs.
+      */
+        void
+        u3h_wide_trim_to(u3p(u3h_wide) har_p, c3_w n_w);
+
+      /* u3h_wide_free(): free hashtable.
+      */
+        void
+        u3h_wide_free(u3p(u3h_wide) har_p);
+
+      /* u3h_wide_mark(): mark hashtable for gc.
+      */
+        c3_w
+        u3h_wide_mark(u3p(u3h_wide) har_p);
+
+      /* u3h_wide_rewrite(): rewrite hashtable for compaction.
+      */
+        void
+        u3h_wide_rewrite(u3p(u3h_wide) har_p);
+
+      /* u3h_wide_count(): count hashtable for gc.
+      */
+        c3_w
+        u3h_wide_count(u3p(u3h_wide) har_p);
+
+      /* u3h_wide_discount(): discount hashtable for gc.
+      */
+        c3_w
+        u3h_wide_discount(u3p(u3h_wide) har_p);
+
+      /* u3h_wide_walk_with(): traverse hashtable with key, value fn and data
+      **                       argument; RETAINS.
+      */
+        void
+        u3h_wide_walk_with(u3p(u3h_wide) har_p,
+                           void        (*fun_f)(u3_noun, void*),
+                           void*         wit);
+
+      /* u3h_wide_walk(): u3h_wide_walk_with, but with no data argument.
+      */
+        void
+        u3h_wide_walk(u3p(u3h_wide) har_p, void (*fun_f)(u3_noun));
+
+      /* u3h_wide_take_with(): gain hashtable, copying junior keys
+      ** and calling [fun_f] on values.
+      */
+        u3p(u3h_wide)
+        u3h_wide_take_with(u3p(u3h_wide) har_p, u3_funk fun_f);
+
+      /* u3h_wide_take(): gain hashtable, copying junior nouns.
+      */
+        u3p(u3h_wide)
+        u3h_wide_take(u3p(u3h_wide) har_p);
+
+      /* u3h_wide_wyt(): number of entries.
+      */
+        c3_w
+        u3h_wide_wyt(u3p(u3h_wide) har_p);
+
 #endif /* ifndef U3_HASHTABLE_H */
@@ -0,0 +1,140 @@
+/// @file
+
+#include "noun.h"
+
+/* _setup(): prepare for benchmarks.
+*/
+static void
+_setup(void)
+{
+  u3m_init((size_t)1 << 32);
+  u3m_pave(c3y);
+}
+
+/* _bench_key(): the [i_w]th key.
+*/
+static u3_noun
+_bench_key(c3_w i_w)
+{
+  return u3nc(i_w, i_w ^ 0x5a5a5a5);
+}
+
+/* _bench_rate(): report throughput.
+*/
+static void
+_bench_rate(c3_c* cap_c, c3_w len_w, struct timeval* b4)
+{
+  struct timeval f2, d0;
+  c3_d           mic_d;
+
+  gettimeofday(&f2, 0);
+  timersub(&f2, b4, &d0);
+  mic_d = ((c3_d)d0.tv_sec * 1000000) + d0.tv_usec;
+
+  fprintf(stderr, "    %-5s %6" PRIu64 " ms  %6.2f Mops/s\r\n",
+                  cap_c, mic_d / 1000, (double)len_w / c3_max(1, mic_d));
+}
+
+/* _bench_hamt(): put, get, and miss in the HAMT.
+*/
+static void
+_bench_hamt(c3_w len_w)
+{
+  u3p(u3h_root) har_p = u3h_new();
+  struct timeval b4;
+  c3_w  i_w, hit_w = 0;
+
+  fprintf(stderr, "  u3h (HAMT), %u entries:\r\n", len_w);
+
+  gettimeofday(&b4, 0);
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    u3_noun key = _bench_key(i_w);
+    u3h_put(har_p, key, i_w);
+    u3z(key);
+  }
+  _bench_rate("put", len_w, &b4);
+
+  gettimeofday(&b4, 0);
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    u3_noun key = _bench_key((c3_w)(((c3_d)i_w * 1000003) % len_w));
+    hit_w += ( u3_none != u3h_git(har_p, key) );
+    u3z(key);
+  }
+  _bench_rate("get", len_w, &b4);
+
+  gettimeofday(&b4, 0);
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    u3_noun key = _bench_key(len_w + i_w);
+    hit_w += ( u3_none != u3h_git(har_p, key) );
+    u3z(key);
+  }
+  _bench_rate("miss", len_w, &b4);
+
+  u3_assert( hit_w == len_w );
+  u3h_free(har_p);
+}
+
+/* _bench_wide(): put, get, and miss in the open-addressed table.
+*/
+static void
+_bench_wide(c3_w len_w)
+{
+  u3p(u3h_wide) har_p = u3h_wide_new();
+  struct timeval b4;
+  c3_w  i_w, hit_w = 0;
+
+  fprintf(stderr, "  u3h_wide (open-addressed), %u entries:\r\n", len_w);
+
+  gettimeofday(&b4, 0);
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    u3_noun key = _bench_key(i_w);
+    u3h_wide_put(har_p, key, i_w);
+    u3z(key);
+  }
+  _bench_rate("put", len_w, &b4);
+
+  gettimeofday(&b4, 0);
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    u3_noun key = _bench_key((c3_w)(((c3_d)i_w * 1000003) % len_w));
+    hit_w += ( u3_none != u3h_wide_git(har_p, key) );
+    u3z(key);
+  }
+  _bench_rate("get", len_w, &b4);
+
+  gettimeofday(&b4, 0);
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    u3_noun key = _bench_key(len_w + i_w);
+    hit_w += ( u3_none != u3h_wide_git(har_p, key) );
+    u3z(key);
+  }
+  _bench_rate("miss", len_w, &b4);
+
+  u3_assert( hit_w == len_w );
+  u3h_wide_free(har_p);
+}
+
+/* main(): run hashtable benchmarks, at the given sizes in millions.
+*/
+int
+main(int argc, char* argv[])
+{
+  c3_w len_w[] = { 1, 10 };
+  c3_i   i_i, num_i = sizeof(len_w) / sizeof(*len_w);
+
+  _setup();
+
+  fprintf(stderr, "hashtable benchmark:\r\n");
+
+  for ( i_i = 0; i_i < ((argc > 1) ? (argc - 1) : num_i); i_i++ ) {
+    c3_w mil_w = ( argc > 1 ) ? (c3_w)atoi(argv[i_i + 1]) : len_w[i_i];
+
+    _bench_hamt(mil_w * 1000000);
+    _bench_wide(mil_w * 1000000);
+  }
+
+  //  GC
+  //
+  u3m_grab(u3_none);
+
+  return 0;
+}
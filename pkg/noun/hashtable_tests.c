@@ -264,6 +264,121 @@ _test_cache_replace_value(void)
   return ret_i;
 }
 
+/* _test_wide_put_del(): open-addressed put, get, replace, and delete.
+*/
+static c3_i
+_test_wide_put_del(void)
+{
+  u3p(u3h_wide) har_p = u3h_wide_new();
+  c3_i ret_i = 1;
+  c3_w  i_w;
+
+  //  atoms and cells, sharing mugs with each other
+  //
+  for ( i_w = 0; i_w < TEST_SIZE; i_w++ ) {
+    u3_noun key = ( i_w & 1 ) ? u3nc(i_w, u3i_chub(~0ULL - i_w))
+                              : u3i_chub(0x100000000ULL * i_w + i_w);
+    u3h_wide_put(har_p, key, u3nc(u3_nul, u3k(key)));
+    u3z(key);
+  }
+
+  if ( TEST_SIZE != u3h_wide_wyt(har_p) ) {
+    fprintf(stderr, "wide put_del: wrong size\r\n");
+    ret_i = 0;
+  }
+
+  for ( i_w = 0; i_w < TEST_SIZE; i_w++ ) {
+    u3_noun key = ( i_w & 1 ) ? u3nc(i_w, u3i_chub(~0ULL - i_w))
+                              : u3i_chub(0x100000000ULL * i_w + i_w);
+    u3_weak val = u3h_wide_get(har_p, key);
+
+    if ( (u3_none == val) || (c3n == u3r_sing(key, u3t(val))) ) {
+      fprintf(stderr, "wide put_del: failed insert %u\r\n", i_w);
+      ret_i = 0;
+    }
+
+    if ( 0 == (i_w % 3) ) {
+      u3h_wide_del(har_p, key);
+    }
+    else {
+      u3h_wide_put(har_p, key, i_w);
+    }
+
+    u3z(key);
+    u3z(val);
+  }
+
+  for ( i_w = 0; i_w < TEST_SIZE; i_w++ ) {
+    u3_noun key = ( i_w & 1 ) ? u3nc(i_w, u3i_chub(~0ULL - i_w))
+                              : u3i_chub(0x100000000ULL * i_w + i_w);
+    u3_weak val = u3h_wide_get(har_p, key);
+
+    if ( (0 == (i_w % 3)) ? (u3_none != val) : (i_w != val) ) {
+      fprintf(stderr, "wide put_del: failed delete/replace %u\r\n", i_w);
+      ret_i = 0;
+    }
+
+    u3z(key);
+    u3z(val);
+  }
+
+  if ( (TEST_SIZE - ((TEST_SIZE + 2) / 3)) != u3h_wide_wyt(har_p) ) {
+    fprintf(stderr, "wide put_del: wrong size after delete\r\n");
+    ret_i = 0;
+  }
+
+  u3h_wide_free(har_p);
+  return ret_i;
+}
+
+/* _test_wide_cache_trimming(): ensure a bounded open-addressed table
+**                              removes stale items.
+*/
+static c3_i
+_test_wide_cache_trimming(void)
+{
+  c3_i ret_i = 1;
+  c3_w max_w = 2000000;
+  c3_w i_w, fil_w = max_w / 10;
+
+  u3p(u3h_wide) har_p = u3h_wide_new_cache(fil_w);
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    u3_noun cel = u3nc(i_w, i_w);
+    u3h_wide_put(har_p, cel, cel);
+  }
+
+  {
+    c3_w  las_w = max_w - 1;
+    u3_noun key = u3nc(las_w, las_w);
+    u3_noun val = u3h_wide_get(har_p, key);
+    u3z(key);
+
+    if ( (u3_none == val) || (las_w != u3t(val)) ) {
+      fprintf(stderr, "wide cache_trimming (a): fail\r\n");
+      ret_i = 0;
+    }
+
+    if ( fil_w != u3h_wide_wyt(har_p) ) {
+      fprintf(stderr, "wide cache_trimming (b): fail %u != %u\r\n",
+              fil_w, u3h_wide_wyt(har_p));
+      ret_i = 0;
+    }
+
+    u3z(val);
+  }
+
+  u3h_wide_trim_to(har_p, 10);
+
+  if ( 10 != u3h_wide_wyt(har_p) ) {
+    fprintf(stderr, "wide cache_trimming (c): fail\r\n");
+    ret_i = 0;
+  }
+
+  u3h_wide_free(har_p);
+  return ret_i;
+}
+
 static c3_i
 _test_hashtable(void)
 {
@@ -275,6 +390,8 @@ _test_hashtable(void)
   ret_i &= _test_cache_trimming();
   ret_i &= _test_cache_replace_value();
   ret_i &= _test_put_del();
+  ret_i &= _test_wide_put_del();
+  ret_i &= _test_wide_cache_trimming();
 
   return ret_i;
 }
@@ -1148,7 +1148,8 @@ _cj_hank_fill(u3j_hank* han_u, u3_noun tam, u3_noun cor)
     return u3m_bail(c3__fail);
   }
 
-  sit_u->bas = u3_none;
+  sit_u->bas   = u3_none;
+  sit_u->pic_p = 0;
   if ( u3_none == (col = loc = _cj_spot(cor, NULL)) ) {
     u3l_log("fail in _cj_hank_fill (_cj_spot(cor, NULL))");
     return u3m_bail(c3__fail);
@@ -1398,6 +1399,169 @@ u3j_rite_merge(u3j_rite* dst_u, u3j_rite* src_u)
   }
 }
 
+//  pic_p fills what was tail padding, leaving program layout unchanged
+//
+STATIC_ASSERT( (sizeof(u3j_site) == ((8 * sizeof(c3_w)) +
+                                     (2 * sizeof(void*)) +
+                                     (2 * sizeof(c3_w)))),
+               "u3j_site layout" );
+
+/* _cj_pice_init(): initialize an empty spare.
+*/
+static void
+_cj_pice_init(u3j_pice* pic_u)
+{
+  pic_u->pog_p = 0;
+  pic_u->bat   = u3_none;
+  pic_u->loc   = u3_none;
+  pic_u->jet_o = c3n;
+  pic_u->fon_o = c3n;
+  pic_u->lab   = u3_none;
+  pic_u->cop_u = NULL;
+  pic_u->ham_u = NULL;
+  pic_u->fin_p = 0;
+}
+
+/* _cj_pice_lose(): lose references of a spare (but do not free).
+*/
+static void
+_cj_pice_lose(u3j_pice* pic_u)
+{
+  if ( u3_none != pic_u->bat ) {
+    u3z(pic_u->bat);
+  }
+  if ( u3_none != pic_u->loc ) {
+    u3z(pic_u->loc);
+    u3z(pic_u->lab);
+    if ( c3y == pic_u->fon_o ) {
+      _cj_fink_free(pic_u->fin_p);
+    }
+  }
+}
+
+/* _cj_pice_fine(): check that a spare targets core. RETAIN.
+*/
+static c3_o
+_cj_pice_fine(u3_noun cor, u3j_pice* pic_u)
+{
+  if ( u3_none != pic_u->loc ) {
+    return _cj_fine(cor, pic_u->fin_p);
+  }
+  else {
+    return __( (u3_none != pic_u->bat) &&
+               (c3y == u3r_sing(pic_u->bat, u3h(cor))) );
+  }
+}
+
+/* _cj_site_swap(): exchange the target of a site with a spare.
+*/
+static void
+_cj_site_swap(u3j_site* sit_u, u3j_pice* pic_u)
+{
+  u3j_pice tmp_u = *pic_u;
+
+  pic_u->pog_p = sit_u->pog_p;
+  pic_u->bat   = sit_u->bat;
+  pic_u->loc   = sit_u->loc;
+  pic_u->jet_o = sit_u->jet_o;
+  pic_u->fon_o = sit_u->fon_o;
+  pic_u->lab   = sit_u->lab;
+  pic_u->cop_u = sit_u->cop_u;
+  pic_u->ham_u = sit_u->ham_u;
+  pic_u->fin_p = sit_u->fin_p;
+
+  sit_u->pog_p = tmp_u.pog_p;
+  sit_u->bat   = tmp_u.bat;
+  sit_u->loc   = tmp_u.loc;
+  sit_u->jet_o = tmp_u.jet_o;
+  sit_u->fon_o = tmp_u.fon_o;
+  sit_u->lab   = tmp_u.lab;
+  sit_u->cop_u = tmp_u.cop_u;
+  sit_u->ham_u = tmp_u.ham_u;
+  sit_u->fin_p = tmp_u.fin_p;
+}
+
+/* _cj_site_pics_free(): release a site's spares.
+*/
+static void
+_cj_site_pics_free(u3j_site* sit_u)
+{
+  u3j_pice* pic_u = u3to(u3j_pice, sit_u->pic_p);
+  c3_w      i_w;
+
+  for ( i_w = 0; i_w < u3j_pice_len; i_w++ ) {
+    _cj_pice_lose(&(pic_u[i_w]));
+  }
+  u3a_wfree(pic_u);
+  sit_u->pic_p = 0;
+}
+
+/* _cj_site_pics(): produce a site's spares, allocating if needed.
+*/
+static u3j_pice*
+_cj_site_pics(u3j_site* sit_u)
+{
+  if ( sit_u->pic_p ) {
+    return u3to(u3j_pice, sit_u->pic_p);
+  }
+  else {
+    u3j_pice* pic_u = u3a_walloc(u3j_pice_len * c3_wiseof(u3j_pice));
+    c3_w      i_w;
+
+    for ( i_w = 0; i_w < u3j_pice_len; i_w++ ) {
+      _cj_pice_init(&(pic_u[i_w]));
+    }
+    sit_u->pic_p = u3of(u3j_pice, pic_u);
+    return pic_u;
+  }
+}
+
+/* _cj_site_push(): add a spare as most recent, evicting the least.
+**                  references in [new_u] are TRANSFERRED.
+*/
+static void
+_cj_site_push(u3j_site* sit_u, u3j_pice* new_u)
+{
+  u3j_pice* pic_u = _cj_site_pics(sit_u);
+  u3j_pice* las_u = &(pic_u[u3j_pice_len - 1]);
+
+  if ( (u3_none != las_u->loc) || (u3_none != las_u->bat) ) {
+    u3t_Site.eve_d++;
+    _cj_pice_lose(las_u);
+  }
+
+  memmove(&(pic_u[1]), &(pic_u[0]), (u3j_pice_len - 1) * sizeof(u3j_pice));
+  pic_u[0] = *new_u;
+}
+
+/* u3j_site_lend(): give a leech site its senior's located spares.
+**
+**   like the site itself after _n_prog_old(), the copies borrow the
+**   senior's references and finks, and have no program.
+*/
+void
+u3j_site_lend(u3j_site* sit_u)
+{
+  if ( sit_u->pic_p ) {
+    u3j_pice* sen_u = u3to(u3j_pice, sit_u->pic_p);
+    u3j_pice* pic_u;
+    c3_w      i_w, j_w;
+
+    sit_u->pic_p = 0;
+    pic_u = _cj_site_pics(sit_u);
+
+    for ( i_w = 0, j_w = 0; i_w < u3j_pice_len; i_w++ ) {
+      if ( u3_none != sen_u[i_w].loc ) {
+        pic_u[j_w]       = sen_u[i_w];
+        pic_u[j_w].pog_p = 0;
+        pic_u[j_w].bat   = u3_none;
+        pic_u[j_w].fon_o = c3n;
+        j_w++;
+      }
+    }
+  }
+}
+
 /* u3j_site_take(): copy junior site references. [dst_u] is uninitialized
 */
 void
@@ -1407,6 +1571,35 @@ u3j_site_take(u3j_site* dst_u, u3j_site* src_u)
   dst_u->bat   = u3_none;
   dst_u->bas   = u3_none;
   dst_u->pog_p = 0;
+  dst_u->pic_p = 0;
+
+  //  only keep spares located on the junior road; those it
+  //  borrowed (see u3j_site_lend()) are still in the senior
+  //
+  if ( src_u->pic_p ) {
+    u3j_pice* pic_u = u3to(u3j_pice, src_u->pic_p);
+    c3_w      i_w;
+
+    for ( i_w = u3j_pice_len; i_w-- > 0; ) {
+      u3j_pice* pac_u = &(pic_u[i_w]);
+
+      if ( (u3_none != pac_u->loc) && (c3y == pac_u->fon_o) ) {
+        u3j_pice new_u = {
+          .pog_p = 0,
+          .bat   = u3_none,
+          .loc   = u3a_take(pac_u->loc),
+          .jet_o = pac_u->jet_o,
+          .fon_o = c3y,
+          .lab   = u3a_take(pac_u->lab),
+          .cop_u = pac_u->cop_u,
+          .ham_u = pac_u->ham_u,
+          .fin_p = u3of(u3j_fink,
+                        _cj_fink_take(u3to(u3j_fink, pac_u->fin_p))),
+        };
+        _cj_site_push(dst_u, &new_u);
+      }
+    }
+  }
 
   if ( u3_none == src_u->loc ) {
     dst_u->loc   = u3_none;
@@ -1444,7 +1637,61 @@ u3j_site_merge(u3j_site* dst_u, u3j_site* src_u)
   u3z(dst_u->axe);
   dst_u->axe = src_u->axe;
 
-  if ( u3_none != src_u->loc ) {
+  //  a new target borrowed from one of our spares takes its fink
+  //  (the spare is otherwise a duplicate, so it goes)
+  //
+  if (  (u3_none != src_u->loc)
+     && (c3n == src_u->fon_o)
+     && (dst_u->fin_p != src_u->fin_p)
+     && dst_u->pic_p )
+  {
+    u3j_pice* pic_u = u3to(u3j_pice, dst_u->pic_p);
+    c3_w      i_w;
+
+    for ( i_w = 0; i_w < u3j_pice_len; i_w++ ) {
+      u3j_pice* pac_u = &(pic_u[i_w]);
+
+      if ( (u3_none != pac_u->loc) && (pac_u->fin_p == src_u->fin_p) ) {
+        src_u->fon_o = pac_u->fon_o;
+        pac_u->fon_o = c3n;
+        _cj_pice_lose(pac_u);
+        memmove(pac_u, pac_u + 1,
+                (u3j_pice_len - i_w - 1) * sizeof(u3j_pice));
+        _cj_pice_init(&(pic_u[u3j_pice_len - 1]));
+        break;
+      }
+    }
+  }
+
+  if (  (u3_none != src_u->loc)
+     && (u3_none != dst_u->loc)
+     && (dst_u->fin_p != src_u->fin_p)
+     && !(u3C.wag_w & u3o_no_poly) )
+  {
+    //  keep the displaced target as a spare
+    //
+    u3j_pice old_u = {
+      .pog_p = 0,
+      .bat   = u3_none,
+      .loc   = dst_u->loc,
+      .jet_o = dst_u->jet_o,
+      .fon_o = dst_u->fon_o,
+      .lab   = dst_u->lab,
+      .cop_u = dst_u->cop_u,
+      .ham_u = dst_u->ham_u,
+      .fin_p = dst_u->fin_p,
+    };
+    _cj_site_push(dst_u, &old_u);
+
+    dst_u->loc   = src_u->loc;
+    dst_u->lab   = src_u->lab;
+    dst_u->cop_u = src_u->cop_u;
+    dst_u->ham_u = src_u->ham_u;
+    dst_u->jet_o = src_u->jet_o;
+    dst_u->fin_p = src_u->fin_p;
+    dst_u->fon_o = src_u->fon_o;
+  }
+  else if ( u3_none != src_u->loc ) {
     u3z(dst_u->loc);  //  XX these may be u3_none
     u3z(dst_u->lab);
     dst_u->loc   = src_u->loc;
@@ -1462,6 +1709,20 @@ u3j_site_merge(u3j_site* dst_u, u3j_site* src_u)
       dst_u->fon_o = src_u->fon_o;
     }
   }
+
+  //  spares located on the junior road are the most recent
+  //
+  if ( src_u->pic_p ) {
+    u3j_pice* pic_u = u3to(u3j_pice, src_u->pic_p);
+    c3_w      i_w;
+
+    for ( i_w = u3j_pice_len; i_w-- > 0; ) {
+      if ( u3_none != pic_u[i_w].loc ) {
+        _cj_site_push(dst_u, &(pic_u[i_w]));
+      }
+    }
+    u3a_wfree(pic_u);
+  }
 }
 
 /* u3j_site_ream(): refresh u3j_site after restoring from checkpoint
@@ -1469,6 +1730,12 @@ u3j_site_merge(u3j_site* dst_u, u3j_site* src_u)
 void
 u3j_site_ream(u3j_site* sit_u)
 {
+  //  spares are cheap to refill, so drop them rather than renail
+  //
+  if ( sit_u->pic_p ) {
+    _cj_site_pics_free(sit_u);
+  }
+
   if ( u3_none != sit_u->loc ) {
     u3z(sit_u->lab);
     sit_u->jet_o = _cj_nail(sit_u->loc, sit_u->axe,
@@ -1476,6 +1743,64 @@ u3j_site_ream(u3j_site* sit_u)
   }
 }
 
+/* _cj_site_poly(): make the site's target the one matching [cor],
+**                  if any spare has it; otherwise, move the target
+**                  into the spares, leaving the site empty.
+**
+**   spares are kept most-recent first, so a hit at [i_w] rotates
+**   the site and spares 0..i_w by one. produces yes on hit.
+*/
+static c3_o
+_cj_site_poly(u3_noun cor, u3j_site* sit_u)
+{
+  u3j_pice* pic_u;
+  c3_w      i_w, j_w;
+
+  if ( c3n == u3du(cor) ) {
+    return c3n;
+  }
+
+  //  an unlocated target is still good for its battery
+  //
+  if ( u3_none == sit_u->loc ) {
+    if ( u3_none == sit_u->bat ) {
+      return c3n;
+    }
+    else if ( c3y == u3r_sing(sit_u->bat, u3h(cor)) ) {
+      return c3y;
+    }
+  }
+
+  pic_u = _cj_site_pics(sit_u);
+
+  for ( i_w = 0; i_w < u3j_pice_len; i_w++ ) {
+    u3j_pice* pac_u = &(pic_u[i_w]);
+
+    if ( (u3_none == pac_u->loc) && (u3_none == pac_u->bat) ) {
+      break;
+    }
+    else if ( c3y == _cj_pice_fine(cor, pac_u) ) {
+      u3t_Site.hit_d++;
+
+      for ( j_w = 0; j_w <= i_w; j_w++ ) {
+        _cj_site_swap(sit_u, &(pic_u[j_w]));
+      }
+      return c3y;
+    }
+  }
+
+  u3t_Site.mis_d++;
+
+  {
+    u3j_pice old_u;
+
+    _cj_pice_init(&old_u);
+    _cj_site_swap(sit_u, &old_u);
+    _cj_site_push(sit_u, &old_u);
+  }
+  return c3n;
+}
+
 /* _cj_site_lock(): ensure site has a valid program pointer
  */
 static void
@@ -1574,6 +1899,15 @@ _cj_site_kick(u3_noun cor, u3j_site* sit_u)
     }
   }
 
+  if (  (u3_none == loc)
+     && !(u3C.wag_w & u3o_no_poly)
+     && (c3y == _cj_site_poly(cor, sit_u))
+     && (u3_none != sit_u->loc) )
+  {
+    loc = sit_u->loc;
+    pro = _cj_site_kick_hot(loc, cor, sit_u, c3y);
+  }
+
   if ( u3_none == loc ) {
     loc = _cj_spot(cor, &(sit_u->bas));
     if ( u3_none != loc ) {
@@ -1683,6 +2017,7 @@ u3j_gate_prep(u3j_site* sit_u, u3_noun cor)
     return;
   }
   sit_u->bas   = u3_none;
+  sit_u->pic_p = 0;
   sit_u->axe   = 2;
   sit_u->bat   = cor; // a lie, this isn't really the battery!
   sit_u->loc   = loc = _cj_spot(cor, &(sit_u->bas));
@@ -2161,7 +2496,11 @@ _cj_warm_tap(u3_noun kev, void* wit)
 static void
 _cj_ream_hank(u3_noun kev)
 {
-  u3j_site_ream(&(u3to(u3j_hank, u3t(kev))->sit_u));
+  u3j_hank* han_u = u3to(u3j_hank, u3t(kev));
+
+  if ( u3_none != han_u->hax ) {
+    u3j_site_ream(&(han_u->sit_u));
+  }
 }
 
 /* u3j_ream(): rebuild warm state
@@ -2241,6 +2580,9 @@ u3j_site_lose(u3j_site* sit_u)
       _cj_fink_free(sit_u->fin_p);
     }
   }
+  if ( sit_u->pic_p ) {
+    _cj_site_pics_free(sit_u);
+  }
 }
 
 /* u3j_rite_lose(): lose references of u3j_rite (but do not free).
@@ -2267,6 +2609,26 @@ u3j_rite_mark(u3j_rite* rit_u)
   return tot_w;
 }
 
+/* _cj_pice_mark(): mark a spare for gc.
+*/
+static c3_w
+_cj_pice_mark(u3j_pice* pic_u)
+{
+  c3_w tot_w = 0;
+
+  if ( u3_none != pic_u->bat ) {
+    tot_w += u3a_mark_noun(pic_u->bat);
+  }
+  if ( u3_none != pic_u->loc ) {
+    tot_w += u3a_mark_noun(pic_u->loc);
+    tot_w += u3a_mark_noun(pic_u->lab);
+    if ( c3y == pic_u->fon_o ) {
+      tot_w += _cj_fink_mark(u3to(u3j_fink, pic_u->fin_p));
+    }
+  }
+  return tot_w;
+}
+
 /* u3j_site_mark(): mark u3j_site for gc.
 */
 c3_w
@@ -2286,6 +2648,15 @@ u3j_site_mark(u3j_site* sit_u)
       tot_w += _cj_fink_mark(u3to(u3j_fink, sit_u->fin_p));
     }
   }
+  if ( sit_u->pic_p ) {
+    u3j_pice* pic_u = u3to(u3j_pice, sit_u->pic_p);
+    c3_w      i_w;
+
+    tot_w += u3a_mark_ptr(pic_u);
+    for ( i_w = 0; i_w < u3j_pice_len; i_w++ ) {
+      tot_w += _cj_pice_mark(&(pic_u[i_w]));
+    }
+  }
   return tot_w;
 }
 
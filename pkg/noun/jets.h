@@ -109,9 +109,29 @@
         u3p(u3j_fink) fin_p;          //  fine check
       } u3j_rite;
 
-    /* u3j_site: site of a kick (nock 9), used to cache call target.
+    /* u3j_pice: spare call target of a polymorphic u3j_site.
     */
       struct _u3n_prog;
+      typedef struct {
+        u3p(struct _u3n_prog) pog_p;  //  program for formula
+        u3_weak       bat;            //  battery (for verification)
+        u3_weak       loc;            //  location
+        c3_o          jet_o;          //  have jet driver?
+        c3_o          fon_o;          //  entry owns fink?
+        u3_weak       lab;            //  label (for tracing)
+        u3j_core*     cop_u;          //  jet core
+        u3j_harm*     ham_u;          //  jet arm
+        u3p(u3j_fink) fin_p;          //  fine check
+      } u3j_pice;
+
+#     define u3j_pice_len  3          //  spares per site (plus primary)
+
+    /* u3j_site: site of a kick (nock 9), used to cache call target.
+    **
+    **   the site itself holds the most recent target; older targets
+    **   are kept, most recent first, in a lazily allocated array
+    **   of u3j_pice_len spares at pic_p.
+    */
       typedef struct {
         u3p(struct _u3n_prog) pog_p;  //  program for formula
         u3_noun       axe;            //  axis
@@ -124,6 +144,7 @@
         u3j_core*     cop_u;          //  jet core
         u3j_harm*     ham_u;          //  jet arm
         u3p(u3j_fink) fin_p;          //  fine check
+        u3p(u3j_pice) pic_p;          //  spare targets (or 0)
       } u3j_site;
 
       /* u3j_hank: cached hook information.
@@ -249,6 +270,11 @@
         void
         u3j_site_merge(u3j_site* dst_u, u3j_site* src_u);
 
+      /* u3j_site_lend(): give a leech site its senior's located spares.
+      */
+        void
+        u3j_site_lend(u3j_site* sit_u);
+
       /* u3j_site_ream(): refresh u3j_site after restoring from checkpoint
       */
         void
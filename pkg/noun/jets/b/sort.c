@@ -5,84 +5,220 @@
 
 #include "noun.h"
 
+//  +sort as a natural merge sort
+//
+//    the hoon is a quicksort on the head of the list, placing [c]
+//    before the pivot [p] iff (b c p). for a comparator that orders
+//    its inputs (strictly, like +lth, or not, like +lte), that is the
+//    same as a merge taking the right element first iff (b r l): equal
+//    elements keep their order under +lth and reverse it under +lte,
+//    exactly as in hoon. but the merge needs no stack, and no more
+//    than n log n comparisons, where the quicksort needs n^2 on the
+//    presorted lists it is usually given.
+//
+//    as in timsort, the input is first cut into runs, each either
+//    ascending (never (b next prev)) or descending (always), the latter
+//    reversed in place; these are then merged in passes. a sorted or
+//    reversed list costs n-1 comparisons.
+//
+//    the list is read into arrays on the loom, so that they are freed
+//    with the road if the comparator bails.
+//
 
-  // like skid, except its callback is $-([* *] ?) and it takes the second
-  // argument so that it calls its callback with [i.list, second]
-  //
-  // all args are RETAINED
-  static u3_noun
-  _split_in(u3j_site* sit_u,
-            u3_noun a,
-            u3_noun second)
-  {
-    if ( 0 == a ) {
-      return u3nc(u3_nul, u3_nul);
-    }
-    else if ( c3n == u3du(a) ) {
-      return u3m_bail(c3__exit);
-    } else {
-      u3_noun acc = _split_in(sit_u, u3t(a), second);
-      u3_noun hoz = u3j_gate_slam(sit_u, u3nc(u3k(u3h(a)), u3k(second)));
-      u3_noun nex;
-
-      if ( c3y == hoz ) {
-        nex = u3nc(u3nc(u3k(u3h(a)), u3k(u3h(acc))), u3k(u3t(acc)));
+/* _sort_less(): (b c d), a loobean.
+*/
+static c3_o
+_sort_less(u3j_site* sit_u, u3_noun c, u3_noun d)
+{
+  u3_noun hoz = u3j_gate_slam(sit_u, u3nc(u3k(c), u3k(d)));
+
+  if ( (c3y != hoz) && (c3n != hoz) ) {
+    return u3m_bail(c3__exit);
+  }
+
+  return hoz;
+}
+
+/* _sort_runs(): cut [a_u] into runs, producing their bounds in [run_w].
+*/
+static c3_w
+_sort_runs(u3j_site* sit_u, u3_noun* a_u, c3_w len_w, c3_w* run_w)
+{
+  c3_w num_w = 0;
+  c3_w beg_w = 0;
+
+  while ( beg_w < len_w ) {
+    c3_w end_w = beg_w + 1;
+
+    run_w[num_w++] = beg_w;
+
+    if ( end_w < len_w ) {
+      if ( c3y == _sort_less(sit_u, a_u[end_w], a_u[beg_w]) ) {
+        do {
+          end_w++;
+        }
+        while (  (end_w < len_w)
+              && (c3y == _sort_less(sit_u, a_u[end_w], a_u[end_w - 1])) );
+
+        //  reverse a descending run
+        //
+        {
+          c3_w i_w = beg_w, j_w = end_w - 1;
+
+          while ( i_w < j_w ) {
+            u3_noun tmp = a_u[i_w];
+            a_u[i_w++]  = a_u[j_w];
+            a_u[j_w--]  = tmp;
+          }
+        }
       }
       else {
-        nex = u3nc(u3k(u3h(acc)), u3nc(u3k(u3h(a)), u3k(u3t(acc))));
+        do {
+          end_w++;
+        }
+        while (  (end_w < len_w)
+              && (c3n == _sort_less(sit_u, a_u[end_w], a_u[end_w - 1])) );
       }
-      u3z(hoz);
-      u3z(acc);
+    }
 
-      return nex;
+    beg_w = end_w;
+  }
+
+  run_w[num_w] = len_w;
+
+  return num_w;
+}
+
+/* _sort_merge(): merge sorted [beg_w, mid_w) and [mid_w, end_w)
+**                of [src_u] into [dst_u].
+*/
+static void
+_sort_merge(u3j_site* sit_u,
+            u3_noun*  src_u,
+            u3_noun*  dst_u,
+            c3_w      beg_w,
+            c3_w      mid_w,
+            c3_w      end_w)
+{
+  c3_w i_w = beg_w, j_w = mid_w, k_w = beg_w;
+
+  while ( (i_w < mid_w) && (j_w < end_w) ) {
+    if ( c3y == _sort_less(sit_u, src_u[j_w], src_u[i_w]) ) {
+      dst_u[k_w++] = src_u[j_w++];
+    }
+    else {
+      dst_u[k_w++] = src_u[i_w++];
     }
   }
 
-  static u3_noun
-  _sort_in(u3j_site* sit_u, u3_noun list)
+  while ( i_w < mid_w ) {
+    dst_u[k_w++] = src_u[i_w++];
+  }
+
+  while ( j_w < end_w ) {
+    dst_u[k_w++] = src_u[j_w++];
+  }
+}
+
+u3_noun
+u3qb_sort(u3_noun a,
+          u3_noun b)
+{
+  u3_noun  pro;
+  u3_noun* lit = &pro;
+  c3_w     len_w = 0;
+
+  //  measure and check the list
+  //
   {
-    if ( 0 == list ) {
-      return u3_nul;
-    }
-    else if ( c3n == u3du(list) ) {
-      return u3m_bail(c3__exit);
-    } else {
-      u3_noun hed, tal;
-      u3x_cell(list, &hed, &tal);
-
-      u3_noun split = _split_in(sit_u, tal, hed);
-      u3_noun lhs = _sort_in(sit_u, u3h(split));
-      u3_noun rhs = u3nc(u3k(hed), _sort_in(sit_u, u3t(split)));
-
-      u3_noun ret = u3qb_weld(lhs, rhs);
-      u3z(lhs);
-      u3z(rhs);
-      u3z(split);
-
-      return ret;
+    u3_noun t = a;
+
+    while ( u3_nul != t ) {
+      if ( c3n == u3du(t) ) {
+        return u3m_bail(c3__exit);
+      }
+      len_w++;
+      t = u3t(t);
     }
   }
 
-  u3_noun
-  u3qb_sort(u3_noun a,
-            u3_noun b)
+  if ( 2 > len_w ) {
+    return u3k(a);
+  }
+
   {
-    u3_noun  pro;
+    u3_noun* a_u   = u3a_malloc(len_w * sizeof(u3_noun));
+    u3_noun* b_u   = u3a_malloc(len_w * sizeof(u3_noun));
+    c3_w*    run_w = u3a_malloc((len_w + 1) * sizeof(c3_w));
+    u3_noun  t     = a;
+    c3_w     num_w, i_w;
     u3j_site sit_u;
+
+    for ( i_w = 0; i_w < len_w; i_w++ ) {
+      a_u[i_w] = u3h(t);
+      t = u3t(t);
+    }
+
     u3j_gate_prep(&sit_u, u3k(b));
-    pro = _sort_in(&sit_u, a);
+
+    num_w = _sort_runs(&sit_u, a_u, len_w, run_w);
+
+    //  merge adjacent runs, halving them in each pass
+    //
+    while ( 1 < num_w ) {
+      c3_w j_w = 0;
+
+      for ( i_w = 0; (i_w + 1) < num_w; i_w += 2 ) {
+        _sort_merge(&sit_u, a_u, b_u,
+                    run_w[i_w], run_w[i_w + 1], run_w[i_w + 2]);
+        run_w[j_w++] = run_w[i_w];
+      }
+
+      if ( i_w < num_w ) {
+        memcpy(b_u + run_w[i_w], a_u + run_w[i_w],
+               (len_w - run_w[i_w]) * sizeof(u3_noun));
+        run_w[j_w++] = run_w[i_w];
+      }
+
+      run_w[j_w] = len_w;
+      num_w = j_w;
+
+      {
+        u3_noun* tmp_u = a_u;
+        a_u = b_u;
+        b_u = tmp_u;
+      }
+    }
+
     u3j_gate_lose(&sit_u);
-    return pro;
-  }
-  u3_noun
-  u3wb_sort(u3_noun cor)
-  {
-    u3_noun a, b;
 
-    if ( c3n == u3r_mean(cor, u3x_sam_2, &a, u3x_sam_3, &b, 0) ) {
-      return u3m_bail(c3__exit);
-    } else {
-      return u3qb_sort(a, b);
+    for ( i_w = 0; i_w < len_w; i_w++ ) {
+      u3_noun* hed;
+      u3_noun* tel;
+
+      *lit = u3i_defcons(&hed, &tel);
+      *hed = u3k(a_u[i_w]);
+      lit  = tel;
     }
+
+    *lit = u3_nul;
+
+    u3a_free(run_w);
+    u3a_free(b_u);
+    u3a_free(a_u);
   }
 
+  return pro;
+}
+
+u3_noun
+u3wb_sort(u3_noun cor)
+{
+  u3_noun a, b;
+
+  if ( c3n == u3r_mean(cor, u3x_sam_2, &a, u3x_sam_3, &b, 0) ) {
+    return u3m_bail(c3__exit);
+  } else {
+    return u3qb_sort(a, b);
+  }
+}
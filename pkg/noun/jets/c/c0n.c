@@ -18,14 +18,12 @@
       return 0;
     }
     else {
-      c3_w     len_w = c3_max(lna_w, lnb_w);
-      c3_w       i_w;
-      u3i_slab sab_u;
+      c3_w        len_w = c3_max(lna_w, lnb_w);
+      const c3_w* buf_w = u3r_word_buf(&b, &lnb_w);
+      u3i_slab    sab_u;
       u3i_slab_from(&sab_u, a, 5, len_w);
 
-      for ( i_w = 0; i_w < lnb_w; i_w++ ) {
-        sab_u.buf_w[i_w] |= u3r_word(i_w, b);
-      }
+      u3r_con_words(lnb_w, sab_u.buf_w, buf_w);
 
       return u3i_slab_mint(&sab_u);
     }
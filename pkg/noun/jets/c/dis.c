@@ -13,18 +13,18 @@
     c3_w lna_w = u3r_met(5, a);
     c3_w lnb_w = u3r_met(5, b);
 
-    if ( (lna_w == 0) && (lnb_w == 0) ) {
+    if ( (lna_w == 0) || (lnb_w == 0) ) {
       return 0;
     }
     else {
-      c3_w     len_w = c3_max(lna_w, lnb_w);
-      c3_w       i_w;
-      u3i_slab sab_u;
+      //  the product is no longer than either
+      //
+      c3_w        len_w = c3_min(lna_w, lnb_w);
+      const c3_w* buf_w = u3r_word_buf(&b, &lnb_w);
+      u3i_slab    sab_u;
       u3i_slab_from(&sab_u, a, 5, len_w);
 
-      for ( i_w = 0; i_w < len_w; i_w++ ) {
-        sab_u.buf_w[i_w] &= u3r_word(i_w, b);
-      }
+      u3r_dis_words(len_w, sab_u.buf_w, buf_w);
 
       return u3i_slab_mint(&sab_u);
     }
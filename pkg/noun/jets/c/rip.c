@@ -107,6 +107,8 @@ _block_rip(u3_atom bloq, u3_atom b)
     c3_w met_w   = u3r_met(bloq_g, b);                  //  num blocks in atom
     c3_w nbits_w = 1 << bloq_g;                         //  block size in bits
     c3_w bmask_w = (1 << nbits_w) - 1;                  //  result mask
+    c3_w len_w;
+    const c3_w* buf_w = u3r_word_buf(&b, &len_w);       //  words of atom
 
     for ( c3_w i_w = 0; i_w < met_w; i_w++ ) {          //  `i_w` is block index
       c3_w nex_w = i_w + 1;                             //  next block
@@ -114,7 +116,7 @@ _block_rip(u3_atom bloq, u3_atom b)
       c3_w bit_w = pat_w << bloq_g;                     //  bits left after this
       c3_w wor_w = bit_w >> 5;                          //  wrds left after this
       c3_w sif_w = bit_w & 31;                          //  bits left in word
-      c3_w src_w = u3r_word(wor_w, b);                  //  find word by index
+      c3_w src_w = buf_w[wor_w];                        //  find word by index
       c3_w rip_w = (src_w >> sif_w) & bmask_w;          //  get item from word
 
       acc = u3nc(rip_w, acc);
@@ -135,14 +137,11 @@ _block_rip(u3_atom bloq, u3_atom b)
     c3_w     pat_w = (met_w - (i_w + 1));
     c3_w     wut_w = (pat_w << san_g);
     c3_w     sap_w = ((0 == i_w) ? tub_w : san_w);
-    c3_w       j_w;
     u3_atom    rip;
     u3i_slab sab_u;
     u3i_slab_bare(&sab_u, 5, sap_w);
 
-    for ( j_w = 0; j_w < sap_w; j_w++ ) {
-      sab_u.buf_w[j_w] = u3r_word(wut_w + j_w, b);
-    }
+    u3r_words(wut_w, sap_w, sab_u.buf_w, b);
 
     rip = u3i_slab_mint(&sab_u);
     acc = u3nc(rip, acc);
@@ -6,6 +6,50 @@
 
 #include "noun.h"
 
+/* _swp_bytes(): reverse [len_w] bloqs of [wid_w] bytes, [wid_w] >= 1,
+**              from the [byt_i] bytes of [src_y] into [dst_y].
+**
+**   NB: only the most significant bloq can be short of [src_y]
+*/
+static void
+_swp_bytes(c3_w   len_w,
+           c3_w   wid_w,
+           size_t byt_i,
+           c3_y*  dst_y,
+     const c3_y*  src_y)
+{
+  size_t i_i, j_i;
+
+  switch ( wid_w ) {
+    case 1: {
+      for ( i_i = 0, j_i = len_w - 1; i_i < len_w; i_i++, j_i-- ) {
+        dst_y[j_i] = src_y[i_i];
+      }
+    } break;
+
+    case 2: {
+      for ( i_i = 0, j_i = len_w - 1; i_i < len_w; i_i++, j_i-- ) {
+        memcpy(dst_y + (j_i << 1), src_y + (i_i << 1), 2);
+      }
+    } break;
+
+    case 4: {
+      for ( i_i = 0, j_i = len_w - 1; i_i < len_w; i_i++, j_i-- ) {
+        memcpy(dst_y + (j_i << 2), src_y + (i_i << 2), 4);
+      }
+    } break;
+
+    default: {
+      for ( i_i = 0, j_i = len_w - 1; i_i < len_w; i_i++, j_i-- ) {
+        size_t off_i = i_i * wid_w;
+
+        memcpy(dst_y + (j_i * wid_w), src_y + off_i,
+               c3_min(wid_w, byt_i - off_i));
+      }
+    } break;
+  }
+}
+
 u3_noun
 u3qc_swp(u3_atom a,
          u3_atom b)
@@ -14,10 +58,24 @@ u3qc_swp(u3_atom a,
   u3i_slab sab_u;
   u3i_slab_init(&sab_u, a, len_w);
 
-  for (c3_w i = 0; i < len_w; i++) {
-    u3r_chop(a, i, 1, len_w - i - 1, sab_u.buf_w, b);
+  //  bloqs of whole bytes are copied directly
+  //
+  if (  len_w
+     && (3 <= a)
+     && (a < 32) )
+  {
+    c3_w        wor_w;
+    const c3_w* buf_w = u3r_word_buf(&b, &wor_w);
+
+    _swp_bytes(len_w, (c3_w)1 << (a - 3), (size_t)wor_w << 2,
+               (c3_y*)sab_u.buf_w, (const c3_y*)buf_w);
+  }
+  else {
+    for (c3_w i = 0; i < len_w; i++) {
+      u3r_chop(a, i, 1, len_w - i - 1, sab_u.buf_w, b);
+    }
   }
-         
+
   return u3i_slab_mint(&sab_u);
 }
 
@@ -10,17 +10,20 @@ u3_noun
 u3qdb_gas(u3_noun a,
           u3_noun b)
 {
+  //  see in_gas.c
+  //
   if ( u3_nul == b ) {
     return u3k(a);
   }
   else {
-    u3_noun i_b,  t_b,
-            pi_b, qi_b;
-    u3x_cell(b, &i_b, &t_b);
-    u3x_cell(i_b, &pi_b, &qi_b);
+    u3_noun c = u3qdi_knit(b, c3y);
+    u3_noun d;
 
-    u3_noun c = u3qdb_put(a, pi_b, qi_b);
-    u3_noun d = u3qdb_gas(c, t_b);
+    if ( u3_nul == a ) {
+      return c;
+    }
+
+    d = u3qdb_uni(a, c);
     u3z(c);
     return d;
   }
@@ -6,6 +6,220 @@
 
 #include "noun.h"
 
+//  +gas by bulk construction
+//
+//    a treap is determined by its keys alone: +gor orders them, and
+//    +mor ranks them, both totally. so rather than +put each item in
+//    turn, the items are sorted by +gor (stably, so that the last of
+//    a duplicate key wins, as with +put), ranked by +mor, and knit
+//    into the one treap they admit, in a single pass. the result is
+//    then merged into the existing tree with +uni, which prefers the
+//    new values, again as +put.
+//
+
+#define _KNIT_NONE  0xffffffff
+
+/* _knit_item: a treap node under construction.
+*/
+typedef struct _knit_item {
+  u3_noun nod;                          //  node, key or [key value]
+  u3_noun key;                          //  key
+  c3_w    gor_w;                        //  (mug key)
+  c3_w    mor_w;                        //  (mug (mug key))
+} _knit_item;
+
+/* _knit_gor(): c3y if [a_u] sorts strictly before [b_u].
+*/
+static c3_o
+_knit_gor(const _knit_item* a_u, const _knit_item* b_u)
+{
+  if ( a_u->gor_w != b_u->gor_w ) {
+    return ( a_u->gor_w < b_u->gor_w ) ? c3y : c3n;
+  }
+
+  return ( c3n == u3qc_dor(b_u->key, a_u->key) ) ? c3y : c3n;
+}
+
+/* _knit_mor(): (mor a b) for [a_u] and [b_u].
+*/
+static c3_o
+_knit_mor(const _knit_item* a_u, const _knit_item* b_u)
+{
+  if ( a_u->mor_w != b_u->mor_w ) {
+    return ( a_u->mor_w < b_u->mor_w ) ? c3y : c3n;
+  }
+
+  return u3qc_dor(a_u->key, b_u->key);
+}
+
+/* _knit_sort(): stable bottom-up merge sort by +gor.
+*/
+static _knit_item*
+_knit_sort(_knit_item* src_u, _knit_item* dst_u, c3_w len_w)
+{
+  c3_w wid_w;
+
+  for ( wid_w = 1; wid_w < len_w; wid_w *= 2 ) {
+    c3_w beg_w;
+
+    for ( beg_w = 0; beg_w < len_w; beg_w += 2 * wid_w ) {
+      c3_w mid_w = c3_min(beg_w + wid_w, len_w);
+      c3_w end_w = c3_min(beg_w + (2 * wid_w), len_w);
+      c3_w i_w = beg_w, j_w = mid_w, k_w = beg_w;
+
+      while ( (i_w < mid_w) && (j_w < end_w) ) {
+        if ( c3y == _knit_gor(&src_u[j_w], &src_u[i_w]) ) {
+          dst_u[k_w++] = src_u[j_w++];
+        }
+        else {
+          dst_u[k_w++] = src_u[i_w++];
+        }
+      }
+
+      while ( i_w < mid_w ) {
+        dst_u[k_w++] = src_u[i_w++];
+      }
+
+      while ( j_w < end_w ) {
+        dst_u[k_w++] = src_u[j_w++];
+      }
+    }
+
+    {
+      _knit_item* tmp_u = src_u;
+      src_u = dst_u;
+      dst_u = tmp_u;
+    }
+  }
+
+  return src_u;
+}
+
+/* _knit_tree(): build the subtreap at [i_w].
+*/
+static u3_noun
+_knit_tree(_knit_item* itm_u, c3_w* lef_w, c3_w* rit_w, c3_w i_w)
+{
+  if ( _KNIT_NONE == i_w ) {
+    return u3_nul;
+  }
+
+  return u3nt(u3k(itm_u[i_w].nod),
+              _knit_tree(itm_u, lef_w, rit_w, lef_w[i_w]),
+              _knit_tree(itm_u, lef_w, rit_w, rit_w[i_w]));
+}
+
+/* u3qdi_knit(): treap of the list [b], of keys, or of [key value]
+**               if [map_o]; the last of a duplicate key wins.
+*/
+u3_noun
+u3qdi_knit(u3_noun b, c3_o map_o)
+{
+  c3_w        len_w = 0, i_w, j_w;
+  _knit_item* itm_u;
+  _knit_item* tmp_u;
+  c3_w*       lef_w;
+  c3_w*       rit_w;
+  c3_w*       stk_w;
+  c3_w        top_w = 0;
+  u3_noun     pro;
+
+  {
+    u3_noun t = b;
+
+    while ( u3_nul != t ) {
+      u3x_cell(t, 0, &t);
+      len_w++;
+    }
+  }
+
+  if ( !len_w ) {
+    return u3_nul;
+  }
+
+  //  on the loom, so as to be freed if we bail
+  //
+  itm_u = u3a_malloc(len_w * sizeof(*itm_u));
+  tmp_u = u3a_malloc(len_w * sizeof(*tmp_u));
+
+  {
+    u3_noun t = b;
+
+    for ( i_w = 0; i_w < len_w; i_w++ ) {
+      _knit_item* itm = &itm_u[i_w];
+
+      itm->nod = u3h(t);
+
+      if ( c3y == map_o ) {
+        u3x_cell(itm->nod, &itm->key, 0);
+      }
+      else {
+        itm->key = itm->nod;
+      }
+
+      itm->gor_w = u3r_mug(itm->key);
+      itm->mor_w = u3r_mug(itm->gor_w);
+      t = u3t(t);
+    }
+  }
+
+  //  sort, keeping the last of each key
+  //
+  {
+    _knit_item* srt_u = _knit_sort(itm_u, tmp_u, len_w);
+
+    for ( i_w = 0, j_w = 0; i_w < len_w; i_w++ ) {
+      if (  (j_w > 0)
+         && (srt_u[i_w].gor_w == tmp_u[j_w - 1].gor_w)
+         && (c3y == u3r_sing(srt_u[i_w].key, tmp_u[j_w - 1].key)) )
+      {
+        j_w--;
+      }
+
+      tmp_u[j_w++] = srt_u[i_w];
+    }
+
+    //  tmp_u may alias srt_u, but never overtakes it
+    //
+    len_w = j_w;
+  }
+
+  //  link as a cartesian tree by +mor, on a stack of right spines
+  //
+  lef_w = u3a_malloc(len_w * sizeof(c3_w));
+  rit_w = u3a_malloc(len_w * sizeof(c3_w));
+  stk_w = u3a_malloc(len_w * sizeof(c3_w));
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    c3_w las_w = _KNIT_NONE;
+
+    while (  top_w
+          && (c3y == _knit_mor(&tmp_u[i_w], &tmp_u[stk_w[top_w - 1]])) )
+    {
+      las_w = stk_w[--top_w];
+    }
+
+    lef_w[i_w] = las_w;
+    rit_w[i_w] = _KNIT_NONE;
+
+    if ( top_w ) {
+      rit_w[stk_w[top_w - 1]] = i_w;
+    }
+
+    stk_w[top_w++] = i_w;
+  }
+
+  pro = _knit_tree(tmp_u, lef_w, rit_w, stk_w[0]);
+
+  u3a_free(stk_w);
+  u3a_free(rit_w);
+  u3a_free(lef_w);
+  u3a_free(tmp_u);
+  u3a_free(itm_u);
+
+  return pro;
+}
+
 u3_noun
 u3qdi_gas(u3_noun a,
           u3_noun b)
@@ -14,11 +228,14 @@ u3qdi_gas(u3_noun a,
     return u3k(a);
   }
   else {
-    u3_noun i_b, t_b;
-    u3x_cell(b, &i_b, &t_b);
+    u3_noun c = u3qdi_knit(b, c3n);
+    u3_noun d;
+
+    if ( u3_nul == a ) {
+      return c;
+    }
 
-    u3_noun c = u3qdi_put(a, i_b);
-    u3_noun d = u3qdi_gas(c, t_b);
+    d = u3qdi_uni(a, c);
     u3z(c);
     return d;
   }
@@ -20,9 +20,13 @@
       return c3n;
     }
     else {
-      c3_y* dat_y = u3r_bytes_alloc(0, len_w, dat);
-      c3_t  val_t = urcrypt_ed_veri(dat_y, len_w, pub_y, sig_y);
-      u3a_free(dat_y);
+      c3_y*       fre_y;
+      const c3_y* dat_y = u3r_bytes_lend(len_w, &dat, &fre_y);
+      c3_t        val_t = urcrypt_ed_veri(dat_y, len_w, pub_y, sig_y);
+
+      if ( fre_y ) {
+        u3a_free(fre_y);
+      }
 
       return val_t ? c3y : c3n;
     }
@@ -59,10 +63,14 @@
       return c3n;
     }
     else {
-      c3_w  met_w;
-      c3_y* mes_y = u3r_bytes_all(&met_w, m);
-      c3_t  val_t = urcrypt_ed_veri(mes_y, met_w, pub_y, sig_y);
-      u3a_free(mes_y);
+      c3_w        met_w = u3r_met(3, m);
+      c3_y*       fre_y;
+      const c3_y* mes_y = u3r_bytes_lend(met_w, &m, &fre_y);
+      c3_t        val_t = urcrypt_ed_veri(mes_y, met_w, pub_y, sig_y);
+
+      if ( fre_y ) {
+        u3a_free(fre_y);
+      }
 
       return val_t ? c3y : c3n;
     }
@@ -10,15 +10,18 @@
   u3_atom \
   _kecc_##bits(c3_w len_w, u3_atom a) \
   { \
-    c3_y  out[byts]; \
-    c3_y* buf_y = u3r_bytes_alloc(0, len_w, a); \
+    c3_y        out[byts]; \
+    c3_y*       fre_y; \
+    const c3_y* buf_y = u3r_bytes_lend(len_w, &a, &fre_y); \
     if ( 0 != urcrypt_keccak_##bits(buf_y, len_w, out) ) { \
       /* urcrypt_keccac_##bits always succeeds when called correctly */ \
       return u3m_bail(c3__oops); \
     } \
     else { \
       u3_atom pro = u3i_bytes(byts, out); \
-      u3a_free(buf_y); \
+      if ( fre_y ) { \
+        u3a_free(fre_y); \
+      } \
       return pro; \
     } \
   } \
@@ -17,10 +17,13 @@
       return u3m_bail(c3__fail);
     }
     else {
-      c3_y  out_y[32];
-      c3_y* dat_y = u3r_bytes_alloc(0, len_w, dat);
+      c3_y        out_y[32];
+      c3_y*       fre_y;
+      const c3_y* dat_y = u3r_bytes_lend(len_w, &dat, &fre_y);
       urcrypt_shay(dat_y, len_w, out_y);
-      u3a_free(dat_y);
+      if ( fre_y ) {
+        u3a_free(fre_y);
+      }
       return u3i_bytes(32, out_y);
     }
   }
@@ -28,11 +31,14 @@
   static u3_atom
   _cqe_shax(u3_atom a)
   {
-    c3_w  len_w;
-    c3_y  out_y[32];
-    c3_y* dat_y = u3r_bytes_all(&len_w, a);
+    c3_w        len_w = u3r_met(3, a);
+    c3_y        out_y[32];
+    c3_y*       fre_y;
+    const c3_y* dat_y = u3r_bytes_lend(len_w, &a, &fre_y);
     urcrypt_shay(dat_y, len_w, out_y);
-    u3a_free(dat_y);
+    if ( fre_y ) {
+      u3a_free(fre_y);
+    }
     return u3i_bytes(32, out_y);
   }
 
@@ -45,10 +51,13 @@
       return u3m_bail(c3__fail);
     }
     else {
-      c3_y  out_y[64];
-      c3_y* dat_y = u3r_bytes_alloc(0, len_w, dat);
+      c3_y        out_y[64];
+      c3_y*       fre_y;
+      const c3_y* dat_y = u3r_bytes_lend(len_w, &dat, &fre_y);
       urcrypt_shal(dat_y, len_w, out_y);
-      u3a_free(dat_y);
+      if ( fre_y ) {
+        u3a_free(fre_y);
+      }
       return u3i_bytes(64, out_y);
     }
   }
@@ -117,6 +117,7 @@
     u3_noun u3qdi_gas(u3_noun, u3_noun);
     u3_noun u3qdi_has(u3_noun, u3_noun);
     u3_noun u3qdi_int(u3_noun, u3_noun);
+    u3_noun u3qdi_knit(u3_noun, c3_o);
     u3_noun u3qdi_put(u3_noun, u3_noun);
     u3_noun u3qdi_rep(u3_noun, u3_noun);
     u3_noun u3qdi_run(u3_noun, u3_noun);
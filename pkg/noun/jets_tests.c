@@ -925,6 +925,370 @@ _test_mas(void)
   return ret_i;
 }
 
+/* _sort_gate(): a gate ordering bit lists, most significant first,
+**               as +lth (or +lte if [lte_o]). the terminating atom
+**               is ignored, and so may tag equal keys.
+*/
+static u3_noun
+_sort_gate(c3_o lte_o)
+{
+  u3_noun nex = u3nt(9, 2, u3nt(10, u3nc(6, u3nc(u3nc(0, 25), u3nc(0, 27))),
+                               u3nc(0, 1)));
+  u3_noun dif = u3nt(5, u3nc(0, 24), u3nc(1, 0));
+  u3_noun bit = u3nq(6, u3nt(5, u3nc(0, 24), u3nc(0, 26)), nex, dif);
+  u3_noun fol = u3nq(6, u3nc(3, u3nc(0, 12)), bit,
+                        u3nc(1, ( c3y == lte_o ) ? c3y : c3n));
+
+  return u3nt(fol, u3nc(0, 0), 0);
+}
+
+/* _sort_key(): [key_w] as a [len_w]-bit list, ending with [tag_w].
+*/
+static u3_noun
+_sort_key(c3_w key_w, c3_w len_w, c3_w tag_w)
+{
+  u3_noun key = tag_w;
+  c3_w    i_w;
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    key = u3nc((key_w >> i_w) & 1, key);
+  }
+
+  return key;
+}
+
+/* _sort_hoon(): +sort as in hoon, a quicksort on the head.
+*/
+static u3_noun
+_sort_hoon(u3j_site* sit_u, u3_noun a)
+{
+  if ( u3_nul == a ) {
+    return u3_nul;
+  }
+  else {
+    u3_noun p = u3_nul, q = u3_nul, t, ret;
+
+    for ( t = u3t(a); u3_nul != t; t = u3t(t) ) {
+      if ( c3y == u3j_gate_slam(sit_u, u3nc(u3k(u3h(t)), u3k(u3h(a)))) ) {
+        p = u3nc(u3k(u3h(t)), p);
+      }
+      else {
+        q = u3nc(u3k(u3h(t)), q);
+      }
+    }
+
+    p = u3kb_flop(p);
+    q = u3kb_flop(q);
+
+    {
+      u3_noun lef = _sort_hoon(sit_u, p);
+      u3_noun rit = u3nc(u3k(u3h(a)), _sort_hoon(sit_u, q));
+
+      ret = u3qb_weld(lef, rit);
+      u3z(lef); u3z(rit);
+    }
+
+    u3z(p); u3z(q);
+    return ret;
+  }
+}
+
+/* _sort_same(): check +sort of [a] against the hoon, as +lth and +lte.
+*/
+static c3_i
+_sort_same(const c3_c* cap_c, u3_noun a)
+{
+  c3_i ret_i = 1;
+  c3_y i_y;
+
+  for ( i_y = 0; i_y < 2; i_y++ ) {
+    u3_noun  gat = _sort_gate(i_y ? c3y : c3n);
+    u3_noun  pro = u3qb_sort(a, gat);
+    u3_noun  exp;
+    u3j_site sit_u;
+
+    u3j_gate_prep(&sit_u, u3k(gat));
+    exp = _sort_hoon(&sit_u, a);
+    u3j_gate_lose(&sit_u);
+
+    if ( c3n == u3r_sing(exp, pro) ) {
+      fprintf(stderr, "test sort fail: %s (%s)\r\n",
+                      cap_c, i_y ? "lte" : "lth");
+      ret_i = 0;
+    }
+
+    u3z(exp); u3z(pro); u3z(gat);
+  }
+
+  u3z(a);
+  return ret_i;
+}
+
+static c3_i
+_test_sort(void)
+{
+  c3_i    ret_i = 1;
+  c3_w    len_w = 100, i_w;
+  u3_noun ran = u3_nul, asc = u3_nul, des = u3_nul, saw = u3_nul;
+  u3_noun one = u3_nul, dup = u3_nul;
+
+  //  tags are distinct, so order among equal keys is checked
+  //
+  for ( i_w = len_w; i_w-- > 0; ) {
+    ran = u3nc(_sort_key((i_w * 2654435761U) >> 27, 5, i_w + 2), ran);
+    asc = u3nc(_sort_key(i_w / 3, 8, i_w + 2), asc);
+    des = u3nc(_sort_key((len_w - i_w) / 3, 8, i_w + 2), des);
+    saw = u3nc(_sort_key(i_w % 17, 5, i_w + 2), saw);
+    dup = u3nc(_sort_key(7, 3, i_w + 2), dup);
+  }
+
+  one = u3nc(_sort_key(1, 2, 2), u3_nul);
+
+  ret_i &= _sort_same("nul", u3_nul);
+  ret_i &= _sort_same("one", one);
+  ret_i &= _sort_same("random", ran);
+  ret_i &= _sort_same("ascending", asc);
+  ret_i &= _sort_same("descending", des);
+  ret_i &= _sort_same("sawtooth", saw);
+  ret_i &= _sort_same("equal", dup);
+
+  return ret_i;
+}
+
+/* _gas_put(): +gas as a fold of +put, for reference.
+*/
+static u3_noun
+_gas_put(u3_noun a, u3_noun b, c3_o map_o)
+{
+  u3_noun pro = u3k(a);
+
+  for ( ; u3_nul != b; b = u3t(b) ) {
+    u3_noun nex = ( c3y == map_o )
+                  ? u3qdb_put(pro, u3h(u3h(b)), u3t(u3h(b)))
+                  : u3qdi_put(pro, u3h(b));
+    u3z(pro);
+    pro = nex;
+  }
+
+  return pro;
+}
+
+/* _gas_same(): check +gas of [b] into [a] against +put, as map and set.
+*/
+static c3_i
+_gas_same(const c3_c* cap_c, u3_noun a, u3_noun b)
+{
+  c3_i    ret_i = 1;
+  u3_noun key = u3_nul;
+  u3_noun set, exp, pro;
+
+  {
+    u3_noun t = b;
+
+    for ( ; u3_nul != t; t = u3t(t) ) {
+      key = u3nc(u3k(u3h(u3h(t))), key);
+    }
+
+    key = u3kb_flop(key);
+  }
+
+  exp = _gas_put(a, b, c3y);
+  pro = u3qdb_gas(a, b);
+
+  if ( c3n == u3r_sing(exp, pro) ) {
+    fprintf(stderr, "test gas fail: %s (by)\r\n", cap_c);
+    ret_i = 0;
+  }
+
+  u3z(exp); u3z(pro);
+
+  set = u3qdb_key(a);
+  exp = _gas_put(set, key, c3n);
+  pro = u3qdi_gas(set, key);
+
+  if ( c3n == u3r_sing(exp, pro) ) {
+    fprintf(stderr, "test gas fail: %s (in)\r\n", cap_c);
+    ret_i = 0;
+  }
+
+  u3z(exp); u3z(pro); u3z(set); u3z(key);
+  u3z(a); u3z(b);
+
+  return ret_i;
+}
+
+static c3_i
+_test_gas(void)
+{
+  c3_i    ret_i = 1;
+  u3_noun ran = u3_nul, dup = u3_nul, cel = u3_nul, old = u3_nul;
+  c3_w    i_w;
+
+  for ( i_w = 500; i_w-- > 0; ) {
+    c3_w key_w = (i_w * 2654435761U) >> 20;
+
+    ran = u3nc(u3nc(key_w, i_w), ran);
+    dup = u3nc(u3nc(key_w & 0x3f, i_w), dup);
+    cel = u3nc(u3nc(u3nc(key_w & 0xff, u3i_chub(~(c3_d)key_w)), i_w), cel);
+  }
+
+  for ( i_w = 0; i_w < 200; i_w++ ) {
+    old = u3nc(u3nc(i_w * 7, 0), old);
+  }
+
+  {
+    u3_noun map = _gas_put(u3_nul, old, c3y);
+
+    ret_i &= _gas_same("nul", u3_nul, u3_nul);
+    ret_i &= _gas_same("one", u3_nul, u3nc(u3nc(1, 2), u3_nul));
+    ret_i &= _gas_same("random", u3_nul, u3k(ran));
+    ret_i &= _gas_same("duplicates", u3_nul, u3k(dup));
+    ret_i &= _gas_same("cells", u3_nul, u3k(cel));
+    ret_i &= _gas_same("onto map", u3k(map), u3k(ran));
+    ret_i &= _gas_same("over map", u3k(map), u3k(old));
+    ret_i &= _gas_same("into map", u3k(map), u3k(dup));
+
+    u3z(map);
+  }
+
+  u3z(ran); u3z(dup); u3z(cel); u3z(old);
+
+  return ret_i;
+}
+
+/* _bits_atom(): pseudorandom atom of up to [len_w] words.
+*/
+static u3_atom
+_bits_atom(c3_w len_w, c3_d* sed_d)
+{
+  c3_w buf_w[64];
+  c3_w i_w;
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    *sed_d ^= *sed_d << 13;
+    *sed_d ^= *sed_d >> 7;
+    *sed_d ^= *sed_d << 17;
+    buf_w[i_w] = (c3_w)*sed_d;
+  }
+
+  //  sometimes direct
+  //
+  if ( (1 == len_w) && (*sed_d & 1) ) {
+    buf_w[0] &= 0x7fffffff;
+  }
+
+  return u3i_words(len_w, buf_w);
+}
+
+/* _bits_ref(): bitwise [a] op [b], word by word, for reference.
+*/
+static u3_atom
+_bits_ref(c3_c op_c, u3_atom a, u3_atom b)
+{
+  c3_w     len_w = c3_max(u3r_met(5, a), u3r_met(5, b));
+  c3_w     i_w;
+  u3i_slab sab_u;
+  u3i_slab_init(&sab_u, 5, len_w);
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    c3_w a_w = u3r_word(i_w, a);
+    c3_w b_w = u3r_word(i_w, b);
+
+    sab_u.buf_w[i_w] = ( '^' == op_c ) ? (a_w ^ b_w)
+                     : ( '|' == op_c ) ? (a_w | b_w)
+                     :                   (a_w & b_w);
+  }
+
+  return u3i_slab_mint(&sab_u);
+}
+
+/* _bits_swp(): +swp by bloqs, for reference.
+*/
+static u3_atom
+_bits_swp(c3_g a_g, u3_atom b)
+{
+  c3_w     len_w = u3r_met(a_g, b);
+  c3_w     i_w;
+  u3i_slab sab_u;
+  u3i_slab_init(&sab_u, a_g, len_w);
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    u3r_chop(a_g, i_w, 1, len_w - i_w - 1, sab_u.buf_w, b);
+  }
+
+  return u3i_slab_mint(&sab_u);
+}
+
+/* _bits_rip(): +rip by +cut, for reference.
+*/
+static u3_noun
+_bits_rip(c3_g a_g, u3_atom b)
+{
+  u3_noun pro = u3_nul;
+  c3_w    i_w = u3r_met(a_g, b);
+
+  while ( i_w-- ) {
+    pro = u3nc(u3qc_cut(a_g, i_w, 1, b), pro);
+  }
+
+  return pro;
+}
+
+/* _bits_same(): compare [pro] against [exp], consuming both.
+*/
+static c3_i
+_bits_same(const c3_c* cap_c, c3_w a_w, c3_w b_w, u3_noun exp, u3_noun pro)
+{
+  c3_i ret_i = 1;
+
+  if ( c3n == u3r_sing(exp, pro) ) {
+    fprintf(stderr, "test bits fail: %s (%u, %u)\r\n", cap_c, a_w, b_w);
+    ret_i = 0;
+  }
+
+  u3z(exp); u3z(pro);
+
+  return ret_i;
+}
+
+static c3_i
+_test_bits(void)
+{
+  c3_i ret_i = 1;
+  c3_d sed_d = 0x9e3779b97f4a7c15ULL;
+  c3_w a_w, b_w;
+  c3_g met_g;
+
+  for ( a_w = 0; a_w <= 41; a_w++ ) {
+    for ( b_w = 0; b_w <= 41; b_w += 1 + (a_w & 3) ) {
+      u3_atom a = _bits_atom(a_w, &sed_d);
+      u3_atom b = _bits_atom(b_w, &sed_d);
+
+      ret_i &= _bits_same("mix", a_w, b_w,
+                          _bits_ref('^', a, b), u3qc_mix(a, b));
+      ret_i &= _bits_same("con", a_w, b_w,
+                          _bits_ref('|', a, b), u3qc_con(a, b));
+      ret_i &= _bits_same("dis", a_w, b_w,
+                          _bits_ref('&', a, b), u3qc_dis(a, b));
+
+      u3z(a); u3z(b);
+    }
+
+    for ( met_g = 0; met_g <= 8; met_g++ ) {
+      u3_atom a = _bits_atom(a_w, &sed_d);
+
+      ret_i &= _bits_same("swp", met_g, a_w,
+                          _bits_swp(met_g, a), u3qc_swp(met_g, a));
+      ret_i &= _bits_same("rip", met_g, a_w,
+                          _bits_rip(met_g, a), u3qc_rip(met_g, 1, a));
+
+      u3z(a);
+    }
+  }
+
+  return ret_i;
+}
+
 static c3_i
 _test_jets(void)
 {
@@ -970,6 +1334,21 @@ _test_jets(void)
     ret_i = 0;
   }
 
+  if ( !_test_sort() ) {
+    fprintf(stderr, "test jets: sort: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_gas() ) {
+    fprintf(stderr, "test jets: gas: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_bits() ) {
+    fprintf(stderr, "test jets: bits: failed\r\n");
+    ret_i = 0;
+  }
+
   return ret_i;
 }
 
@@ -4,6 +4,8 @@
 #include "v2/manage.h"
 #include "v3/manage.h"
 #include "v4/manage.h"
+#include "v5/manage.h"
+#include "v6/manage.h"
 
 #include <ctype.h>
 #include <dlfcn.h>
@@ -32,6 +34,7 @@
 #include "rsignal.h"
 #include "retrieve.h"
 #include "trace.h"
+#include "ur/ur.h"
 #include "urcrypt.h"
 #include "vortex.h"
 #include "whereami.h"
@@ -471,18 +474,36 @@ u3m_file(c3_c* pas_c)
   }
 }
 
+/* _cm_mark_time(): run [mar_f], timing it in the report.
+*/
+static u3m_quac*
+_cm_mark_time(u3m_quac* (*mar_f)(void), c3_w ted_w)
+{
+  c3_d      tim_d = u3t_trace_time();
+  u3m_quac* qua_u = mar_f();
+
+  qua_u->mic_d = c3_max(1, u3t_trace_time() - tim_d);
+  qua_u->ted_w = ted_w;
+
+  return qua_u;
+}
+
 /* u3m_mark(): mark all nouns in the road.
 */
 u3m_quac**
 u3m_mark(void)
 {
   u3m_quac** qua_u = c3_malloc(sizeof(*qua_u) * 5);
-  qua_u[0] = u3v_mark();
-  qua_u[1] = u3j_mark();
-  qua_u[2] = u3n_mark();
-  qua_u[3] = u3a_mark_road();
+  c3_w       ted_w = u3a_mark_open();
+
+  qua_u[0] = _cm_mark_time(u3v_mark, ted_w);
+  qua_u[1] = _cm_mark_time(u3j_mark, ted_w);
+  qua_u[2] = _cm_mark_time(u3n_mark, ted_w);
+  qua_u[3] = _cm_mark_time(u3a_mark_road, ted_w);
   qua_u[4] = NULL;
 
+  u3a_mark_shut();
+
   return qua_u;
 }
 
@@ -491,8 +512,8 @@ u3m_mark(void)
 static void
 _pave_parts(void)
 {
-  u3R->cax.har_p = u3h_new_cache(u3C.hap_w);  //  transient
-  u3R->cax.per_p = u3h_new_cache(u3C.per_w);  //  persistent
+  u3R->cax.har_p = u3h_new();  //  transient, weighed by zave
+  u3R->cax.per_p = u3h_new();  //  persistent, weighed by zave
   u3R->jed.war_p = u3h_new();
   u3R->jed.cod_p = u3h_new();
   u3R->jed.han_p = u3h_new();
@@ -617,7 +638,9 @@ _find_home(void)
     case U3V_VER1: u3m_v2_migrate();
     case U3V_VER2: u3m_v3_migrate();
     case U3V_VER3: u3m_v4_migrate();
-    case U3V_VER4: {
+    case U3V_VER4: u3m_v5_migrate();
+    case U3V_VER5: u3m_v6_migrate();
+    case U3V_VER6: {
       mig_o = c3n;
       break;
     }
@@ -1091,6 +1114,15 @@ u3m_leap(c3_w pad_w)
   */
   {
     u3R = rod_u;
+
+#ifndef U3_MEMORY_DEBUG
+    //  small boxes come from slabs on inner roads (see u3a_walloc())
+    //
+    if ( !(u3C.wag_w & u3o_debug_ram) ) {
+      u3R->how.fag_w |= u3a_flag_slab;
+    }
+#endif
+
     _pave_parts();
   }
 #ifdef U3_MEMORY_DEBUG
@@ -1272,11 +1304,27 @@ u3m_water(u3_post* low_p, u3_post* hig_p)
   }
 }
 
-/* u3m_soft_top(): top-level safety wrapper.
+/* _cm_sand_ok(): yes iff short-lived roads may bump-allocate.
+**
+**  Sand roads skip free lists and reference counts entirely:
+**  u3m_love() copies the product out and the whole road is dropped.
 */
-u3_noun
-u3m_soft_top(c3_w    mil_w,                     //  timer ms
+static c3_o
+_cm_sand_ok(void)
+{
+#ifdef U3_MEMORY_DEBUG
+  return c3n;
+#else
+  return ( u3C.wag_w & u3o_debug_ram ) ? c3n : c3y;
+#endif
+}
+
+/* _cm_soft_top(): top-level safety wrapper, with road flags.
+*/
+static u3_noun
+_cm_soft_top(c3_w    mil_w,                     //  timer ms
              c3_w    pad_w,                     //  base memory pad
+             c3_o    san_o,                     //  bump allocation
              u3_funk fun_f,
              u3_noun   arg)
 {
@@ -1305,6 +1353,10 @@ u3m_soft_top(c3_w    mil_w,                     //  timer ms
   */
   u3m_hate(pad_w);
 
+  if ( c3y == san_o ) {
+    u3R->how.fag_w |= u3a_flag_sand;
+  }
+
   /* Trap for ordinary nock exceptions.
   */
   if ( 0 == (why = (u3_noun)_setjmp(u3R->esc.buf)) ) {
@@ -1348,6 +1400,17 @@ u3m_soft_top(c3_w    mil_w,                     //  timer ms
   return pro;
 }
 
+/* u3m_soft_top(): top-level safety wrapper.
+*/
+u3_noun
+u3m_soft_top(c3_w    mil_w,                     //  timer ms
+             c3_w    pad_w,                     //  base memory pad
+             u3_funk fun_f,
+             u3_noun   arg)
+{
+  return _cm_soft_top(mil_w, pad_w, c3n, fun_f, arg);
+}
+
 /* u3m_soft_sure(): top-level call assumed correct.
 */
 u3_noun
@@ -1563,18 +1626,17 @@ u3m_grab(u3_noun som, ...)   // terminate with u3_none
   u3a_sweep();
 }
 
-/* u3m_soft(): top-level wrapper.
-**
-** Produces [0 product] or [%error (list tank)], top last.
+/* _cm_soft(): top-level wrapper, with road flags.
 */
-u3_noun
-u3m_soft(c3_w    mil_w,
+static u3_noun
+_cm_soft(c3_w    mil_w,
+         c3_o    san_o,
          u3_funk fun_f,
          u3_noun   arg)
 {
   u3_noun why;
 
-  why = u3m_soft_top(mil_w, (1 << 20), fun_f, arg);   // 4M pad
+  why = _cm_soft_top(mil_w, (1 << 20), san_o, fun_f, arg);   // 4M pad
 
   if ( 0 == u3h(why) ) {
     return why;
@@ -1643,6 +1705,44 @@ u3m_soft(c3_w    mil_w,
   }
 }
 
+/* u3m_soft(): top-level wrapper.
+**
+** Produces [0 product] or [%error (list tank)], top last.
+*/
+u3_noun
+u3m_soft(c3_w    mil_w,
+         u3_funk fun_f,
+         u3_noun   arg)
+{
+  return _cm_soft(mil_w, c3n, fun_f, arg);
+}
+
+/* u3m_soft_sand(): u3m_soft() on a bump-allocated road.
+**
+**  A %meme on the sand road is retried on a normal one.
+*/
+u3_noun
+u3m_soft_sand(c3_w    mil_w,
+              u3_funk fun_f,
+              u3_noun   arg)
+{
+  u3_noun pro;
+
+  if ( c3n == _cm_sand_ok() ) {
+    return _cm_soft(mil_w, c3n, fun_f, arg);
+  }
+
+  pro = _cm_soft(mil_w, c3y, fun_f, u3k(arg));
+
+  if ( c3__meme == u3h(pro) ) {
+    u3z(pro);
+    return _cm_soft(mil_w, c3n, fun_f, arg);
+  }
+
+  u3z(arg);
+  return pro;
+}
+
 /* _cm_is_tas(): yes iff som (RETAIN) is @tas.
 */
 static c3_o
@@ -2021,10 +2121,16 @@ void
 u3m_save(void)
 {
   u3_post low_p, hig_p;
-  u3m_water(&low_p, &hig_p);
 
   u3_assert(u3R == &u3H->rod_u);
 
+  //  release cells held by incremental compaction,
+  //  lest the snapshot keep their references
+  //
+  u3m_pack_shut();
+
+  u3m_water(&low_p, &hig_p);
+
 #if 1  // XX redundant
   {
     c3_w low_w = u3a_heap(u3R);  // old u3m_water()
@@ -2265,6 +2371,7 @@ extern void u3je_secp_stop(void);
 void
 u3m_stop(void)
 {
+  u3m_pack_shut();
   u3e_stop();
   u3je_secp_stop();
 }
@@ -2434,6 +2541,10 @@ u3m_pack(void)
 {
   c3_w pre_w = u3a_open(u3R);
 
+  //  an incremental cycle would be rendered meaningless
+  //
+  u3m_pack_shut();
+
   //  reclaim first, to free space, and discard anything we can't/don't rewrite
   //
   u3m_reclaim();
@@ -2452,3 +2563,332 @@ u3m_pack(void)
 
   return (u3a_open(u3R) - pre_w);
 }
+
+/* _cm_pack_fame: incremental compaction traversal frame.
+*/
+typedef struct _cm_pack_fame {
+  u3_noun cel;                          //  cell being traversed
+  c3_o    tal_o;                        //  head done, tail next
+} _cm_pack_fame;
+
+/* _cm_pac_u: incremental compaction state.
+**
+**   A cycle walks the arvo kernel, moving sole-owned boxes from above
+**   [lim_p] into free space below it; the heap top then falls as the
+**   boxes above are freed. Each move is complete when it is made (the
+**   sole reference is rewritten in place), so events may run between
+**   slices. Across events, the traversal stack holds references to its
+**   cells, so that it never points into freed memory; the tail is
+**   traversed in place of its parent, so lists don't deepen the stack.
+*/
+static struct {
+  c3_o           pro_o;                 //  cycle in progress
+  c3_o           roo_o;                 //  kernel visited
+  c3_w           cyc_w;                 //  cycles begun
+  u3_post        lim_p;                 //  evacuate boxes above
+  u3_post        hat_p;                 //  heap top at start
+  c3_w           sta_w;                 //  live words above lim_p at start
+  c3_d           mov_d;                 //  boxes moved, this cycle
+  c3_d           wor_d;                 //  words moved, this cycle
+  c3_d           gan_d;                 //  words reclaimed, all cycles
+  c3_w           dep_w;                 //  traversal depth
+  c3_w           hel_w;                 //  frames below are referenced
+  c3_w           len_w;                 //  traversal capacity
+  _cm_pack_fame* fam_u;                 //  traversal stack
+  ur_dict_t      vis_u;                 //  shared cells entered
+} _cm_pac_u = { .pro_o = c3n, .roo_o = c3n };
+
+/* u3m_pack_shut(): abandon any incremental compaction cycle.
+*/
+void
+u3m_pack_shut(void)
+{
+  if ( c3y == _cm_pac_u.pro_o ) {
+    c3_w i_w;
+
+    for ( i_w = 0; i_w < _cm_pac_u.hel_w; i_w++ ) {
+      u3z(_cm_pac_u.fam_u[i_w].cel);
+    }
+
+    c3_free(_cm_pac_u.fam_u);
+    ur_dict_free(&_cm_pac_u.vis_u);
+
+    _cm_pac_u.fam_u = 0;
+    _cm_pac_u.pro_o = c3n;
+  }
+}
+
+/* u3m_pack_mark(): mark cells held by an incremental compaction cycle.
+*/
+c3_w
+u3m_pack_mark(void)
+{
+  c3_w i_w, tot_w = 0;
+
+  if (  (c3y == _cm_pac_u.pro_o)
+     && (&(u3H->rod_u) == u3R) )
+  {
+    for ( i_w = 0; i_w < _cm_pac_u.hel_w; i_w++ ) {
+      tot_w += u3a_mark_noun(_cm_pac_u.fam_u[i_w].cel);
+    }
+  }
+
+  return tot_w;
+}
+
+/* u3m_pack_open(): begin incremental compaction, if worthwhile.
+**
+**   Produce c3y if a cycle is in progress.
+*/
+c3_o
+u3m_pack_open(void)
+{
+  c3_w hep_w, fre_w, liv_w;
+
+  if ( c3y == _cm_pac_u.pro_o ) {
+    return c3y;
+  }
+
+  if (  (&(u3H->rod_u) != u3R)
+     || (c3n == u3a_is_north(u3R)) )
+  {
+    return c3n;
+  }
+
+  //  only worthwhile if an eighth of the heap (and 4MB) is free
+  //
+  hep_w = u3R->hat_p - u3R->rut_p;
+  fre_w = u3a_idle(u3R);
+
+  if ( (fre_w < (1U << 20)) || (fre_w < (hep_w >> 3)) ) {
+    return c3n;
+  }
+
+  //  evacuate everything above the live size, plus some slack
+  //
+  liv_w = hep_w - fre_w;
+
+  _cm_pac_u.lim_p = u3R->rut_p + liv_w + (liv_w >> 4);
+  _cm_pac_u.sta_w = u3a_pack_live(_cm_pac_u.lim_p);
+
+  if ( !_cm_pac_u.sta_w ) {
+    return c3n;
+  }
+
+  _cm_pac_u.pro_o = c3y;
+  _cm_pac_u.roo_o = c3n;
+  _cm_pac_u.cyc_w++;
+  _cm_pac_u.hat_p = u3R->hat_p;
+  _cm_pac_u.mov_d = 0;
+  _cm_pac_u.wor_d = 0;
+  _cm_pac_u.dep_w = 0;
+  _cm_pac_u.hel_w = 0;
+  _cm_pac_u.len_w = 256;
+  _cm_pac_u.fam_u = c3_malloc(_cm_pac_u.len_w * sizeof(_cm_pack_fame));
+
+  memset(&_cm_pac_u.vis_u, 0, sizeof(_cm_pac_u.vis_u));
+  ur_dict_grow((ur_root_t*)0, &_cm_pac_u.vis_u, ur_fib11, ur_fib12);
+
+  return c3y;
+}
+
+/* _cm_pack_visit(): move [som] if we can, then enter it, producing it.
+*/
+static u3_noun
+_cm_pack_visit(u3_noun som)
+{
+  u3a_box* box_u;
+  u3_weak  nov;
+
+  if ( c3y == u3a_is_cat(som) ) {
+    return som;
+  }
+
+  box_u = u3a_botox(u3a_to_ptr(som));
+
+  {
+    //  NB: the old box is freed (and maybe coalesced) by the move
+    //
+    c3_w siz_w = box_u->siz_w;
+
+    if ( u3_none != (nov = u3a_pack_down(som, _cm_pac_u.lim_p)) ) {
+      _cm_pac_u.mov_d++;
+      _cm_pac_u.wor_d += siz_w;
+
+      som   = nov;
+      box_u = u3a_botox(u3a_to_ptr(som));
+    }
+  }
+
+  if ( c3y == u3a_is_cell(som) ) {
+    //  shared cells are entered once per cycle
+    //
+    if ( 1 != box_u->use_w ) {
+      if ( ur_dict_get((ur_root_t*)0, &_cm_pac_u.vis_u, som) ) {
+        return som;
+      }
+      ur_dict_put((ur_root_t*)0, &_cm_pac_u.vis_u, som);
+    }
+
+    if ( _cm_pac_u.dep_w == _cm_pac_u.len_w ) {
+      _cm_pac_u.len_w *= 2;
+      _cm_pac_u.fam_u = c3_realloc(_cm_pac_u.fam_u,
+                                   _cm_pac_u.len_w * sizeof(_cm_pack_fame));
+    }
+
+    _cm_pac_u.fam_u[_cm_pac_u.dep_w].cel   = som;
+    _cm_pac_u.fam_u[_cm_pac_u.dep_w].tal_o = c3n;
+    _cm_pac_u.dep_w++;
+  }
+
+  return som;
+}
+
+/* u3m_pack_step(): compact incrementally, for about [mic_w] µs.
+**
+**   Produce c3y if the cycle continues.
+*/
+c3_o
+u3m_pack_step(c3_w mic_w)
+{
+  c3_d end_d;
+  c3_w i_w;
+
+  if ( c3n == _cm_pac_u.pro_o ) {
+    return c3n;
+  }
+
+  u3_assert( &(u3H->rod_u) == u3R );
+
+  end_d = u3t_trace_time() + mic_w;
+
+  if ( c3n == _cm_pac_u.roo_o ) {
+    u3_noun roc = u3H->arv_u.roc;
+    u3_noun nov = _cm_pack_visit(roc);
+
+    _cm_pac_u.roo_o = c3y;
+
+    if ( nov != roc ) {
+      u3H->arv_u.roc = nov;
+    }
+  }
+
+  for ( i_w = 1; _cm_pac_u.dep_w; i_w++ ) {
+    c3_w      top_w = _cm_pac_u.dep_w - 1;
+    u3_noun   cel   = _cm_pac_u.fam_u[top_w].cel;
+    u3a_cell* cel_u = u3a_to_ptr(cel);
+    u3_noun   som, nov;
+
+    //  out of time; hold the stack across events
+    //
+    if ( !(i_w & 0x3ff) && (u3t_trace_time() > end_d) ) {
+      for ( ; _cm_pac_u.hel_w < _cm_pac_u.dep_w; _cm_pac_u.hel_w++ ) {
+        u3k(_cm_pac_u.fam_u[_cm_pac_u.hel_w].cel);
+      }
+      return c3y;
+    }
+
+    //  NB: writes only on a move, so as not to dirty pages
+    //
+    if ( c3n == _cm_pac_u.fam_u[top_w].tal_o ) {
+      _cm_pac_u.fam_u[top_w].tal_o = c3y;
+
+      som = cel_u->hed;
+      nov = _cm_pack_visit(som);
+
+      if ( nov != som ) {
+        cel_u->hed = nov;
+      }
+    }
+    else {
+      //  the tail replaces its parent
+      //
+      _cm_pac_u.dep_w = top_w;
+
+      som = cel_u->tel;
+      nov = _cm_pack_visit(som);
+
+      if ( nov != som ) {
+        cel_u->tel = nov;
+      }
+
+      if ( top_w < _cm_pac_u.hel_w ) {
+        if ( _cm_pac_u.dep_w > top_w ) {
+          u3k(nov);
+        }
+        else {
+          _cm_pac_u.hel_w = top_w;
+        }
+
+        u3z(cel);
+      }
+    }
+  }
+
+  //  the cycle is complete
+  //
+  {
+    c3_w gan_w = ( u3R->hat_p < _cm_pac_u.hat_p )
+                 ? (_cm_pac_u.hat_p - u3R->hat_p)
+                 : 0;
+
+    _cm_pac_u.gan_d += gan_w;
+
+    if ( u3C.wag_w & u3o_verbose ) {
+      u3l_log("pack: incremental: cycle %u: moved %" PRIu64 " boxes",
+              _cm_pac_u.cyc_w, _cm_pac_u.mov_d);
+      u3a_print_memory(stderr, "pack: incremental: gained", gan_w);
+    }
+  }
+
+  u3m_pack_shut();
+
+  return c3n;
+}
+
+/* u3m_pack_quac(): incremental compaction progress, as a memory report.
+*/
+u3m_quac*
+u3m_pack_quac(void)
+{
+  u3m_quac** qua_u = c3_malloc(sizeof(*qua_u) * 4);
+  u3m_quac*  tot_u = c3_calloc(sizeof(*tot_u));
+  c3_w       rem_w = 0;
+  c3_c       nam_c[64];
+
+  if ( c3y == _cm_pac_u.pro_o ) {
+    c3_w don_w;
+
+    rem_w = u3a_pack_live(_cm_pac_u.lim_p);
+    don_w = ( rem_w >= _cm_pac_u.sta_w )
+            ? 0
+            : (c3_w)((100ULL * (_cm_pac_u.sta_w - rem_w)) / _cm_pac_u.sta_w);
+
+    snprintf(nam_c, sizeof(nam_c), "incremental pack (cycle %u, %u%%)",
+             _cm_pac_u.cyc_w, don_w);
+  }
+  else {
+    snprintf(nam_c, sizeof(nam_c), "incremental pack (%u cycles)",
+             _cm_pac_u.cyc_w);
+  }
+
+  qua_u[0] = c3_calloc(sizeof(*qua_u[0]));
+  qua_u[0]->nam_c = strdup("moved");
+  qua_u[0]->siz_w = (c3_w)c3_min(_cm_pac_u.wor_d * 4, 0xffffffffULL);
+
+  qua_u[1] = c3_calloc(sizeof(*qua_u[1]));
+  qua_u[1]->nam_c = strdup("remaining");
+  qua_u[1]->siz_w = rem_w * 4;
+
+  qua_u[2] = c3_calloc(sizeof(*qua_u[2]));
+  qua_u[2]->nam_c = strdup("reclaimed");
+  qua_u[2]->siz_w = (c3_w)c3_min(_cm_pac_u.gan_d * 4, 0xffffffffULL);
+
+  qua_u[3] = NULL;
+
+  tot_u->nam_c = strdup(nam_c);
+  tot_u->siz_w = qua_u[0]->siz_w + qua_u[1]->siz_w + qua_u[2]->siz_w;
+  tot_u->qua_u = qua_u;
+
+  return tot_u;
+}
@@ -120,6 +120,14 @@
         u3_noun
         u3m_soft(c3_w mil_w, u3_funk fun_f, u3_noun arg);
 
+      /* u3m_soft_sand(): u3m_soft() on a bump-allocated road.
+      **
+      **  For short-lived reads: nothing is freed until the road falls.
+      **  Retries on a normal road if the sand road runs out of memory.
+      */
+        u3_noun
+        u3m_soft_sand(c3_w mil_w, u3_funk fun_f, u3_noun arg);
+
       /* u3m_soft_slam: top-level call.
       */
         u3_noun
@@ -155,6 +163,8 @@
           c3_c* nam_c;
           c3_w  siz_w;
           struct _u3m_quac** qua_u;
+          c3_d  mic_d;                          //  gc time (µs), if measured
+          c3_w  ted_w;                          //  gc threads, if measured
         } u3m_quac;
 
       /* u3m_mark(): mark all nouns in the road.
@@ -207,4 +217,31 @@
         c3_w
         u3m_pack(void);
 
+      /* u3m_pack_open(): begin incremental compaction, if worthwhile.
+      */
+        c3_o
+        u3m_pack_open(void);
+
+      /* u3m_pack_step(): compact incrementally, for about [mic_w] µs.
+      **
+      **   Produces c3y if the cycle continues; run between events.
+      */
+        c3_o
+        u3m_pack_step(c3_w mic_w);
+
+      /* u3m_pack_shut(): abandon any incremental compaction cycle.
+      */
+        void
+        u3m_pack_shut(void);
+
+      /* u3m_pack_mark(): mark cells held by an incremental compaction cycle.
+      */
+        c3_w
+        u3m_pack_mark(void);
+
+      /* u3m_pack_quac(): incremental compaction progress, as a memory report.
+      */
+        u3m_quac*
+        u3m_pack_quac(void);
+
 #endif /* ifndef U3_MANAGE_H */
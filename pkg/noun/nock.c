@@ -2,16 +2,27 @@
 
 #include "nock.h"
 
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
 #include "allocate.h"
 #include "hashtable.h"
 #include "imprison.h"
 #include "jets.h"
 #include "jets/k.h"
 #include "jets/q.h"
+#include "log.h"
 #include "manage.h"
 #include "options.h"
+#include "events.h"
+#include "murmur3.h"
 #include "retrieve.h"
+#include "serial.h"
 #include "trace.h"
+#include "ur/ur.h"
+#include "version.h"
 #include "vortex.h"
 #include "xtract.h"
 #include "zave.h"
@@ -521,7 +532,15 @@ _n_nock_on(u3_noun bus, u3_noun fol)
   X(KUTS, "kuts", &&do_kuts),  /* 92: c3_s */                                  \
   X(KITB, "kitb", &&do_kitb),  /* 93: c3_b */                                  \
   X(KITS, "kits", &&do_kits),  /* 94: c3_s */                                  \
-  X(LAST,   NULL,      NULL),  /* 95 */
+  /* superinstructions: rewritten in place by _n_fuse(), never emitted */      \
+  X(FKIB, "fkib", &&do_fkib),  /* 95: FABK + KICB */                           \
+  X(FLIB, "flib", &&do_flib),  /* 96: FABL + KICB */                           \
+  X(FTIB, "ftib", &&do_ftib),  /* 97: FABL + TICB */                           \
+  X(CKIB, "ckib", &&do_ckib),  /* 98: COPY + KICB */                           \
+  X(LUSH, "lush", &&do_lush),  /* 99: LIBK + BUSH */                           \
+  X(PAS1, "pas1", &&do_pas1),  /* 100: LIT0 or LIT1 + TOSS */                  \
+  X(PAS2, "pas2", &&do_pas2),  /* 101: LITB or LIBK + TOSS */                  \
+  X(LAST,   NULL,      NULL),  /* 102 */
 
 // Opcodes. Define X to select the enum name from OPCODES.
 #define X(opcode, name, indirect_jump) opcode
@@ -541,6 +560,7 @@ _n_arg(c3_y cod_y)
     case BUSH: case BAST: case BALT:
     case MUTB: case KUTB: case MITB: case KITB:
     case HILB: case HINB:
+    case FKIB: case FLIB: case FTIB: case LUSH: case PAS2:
       return sizeof(c3_y);
 
     case FASK: case FASL: case FISL: case FISK:
@@ -561,6 +581,64 @@ _n_arg(c3_y cod_y)
   }
 }
 
+/* _n_tail(): the opcode absorbed by a superinstruction, or HALT if none.
+**
+**   a superinstruction replaces only the leading opcode of its pair;
+**   the absorbed opcode and its argument stay in the stream after it.
+ */
+static inline c3_y
+_n_tail(c3_y cod_y)
+{
+  switch ( cod_y ) {
+    case FKIB: case FLIB: case CKIB:
+      return KICB;
+
+    case FTIB:
+      return TICB;
+
+    case LUSH:
+      return BUSH;
+
+    case PAS1: case PAS2:
+      return TOSS;
+
+    default:
+      return HALT;
+  }
+}
+
+/* _n_pair(): superinstruction for [one_y two_y], or HALT if none.
+ */
+static inline c3_y
+_n_pair(c3_y one_y, c3_y two_y)
+{
+  switch ( two_y ) {
+    case KICB: switch ( one_y ) {
+      case FABK: return FKIB;
+      case FABL: return FLIB;
+      case COPY: return CKIB;
+      default:   return HALT;
+    }
+
+    case TICB:
+      return ( FABL == one_y ) ? FTIB : HALT;
+
+    case BUSH:
+      return ( LIBK == one_y ) ? LUSH : HALT;
+
+    //  a literal pushed only to be tossed: hint clues and memo keys
+    //
+    case TOSS: switch ( one_y ) {
+      case LIT0: case LIT1: return PAS1;
+      case LITB: case LIBK: return PAS2;
+      default:              return HALT;
+    }
+
+    default:
+      return HALT;
+  }
+}
+
 
 /* _n_melt(): measure space for list of ops (from _n_comp) */
 static u3_noun
@@ -718,6 +796,7 @@ _n_prog_new(c3_w byc_w, c3_w cal_w,
   pog_u->byc_u.ops_y = (c3_y*) _n_prog_dat(pog_u);
 
   pog_u->lit_u.len_w = lit_w;
+  pog_u->lit_u.hot_w = 0;
   pog_u->lit_u.non   = (u3_noun*) (pog_u->byc_u.ops_y + pog_u->byc_u.len_w + pad_w);
 
   pog_u->mem_u.len_w = mem_w;
@@ -753,6 +832,7 @@ _n_prog_old(u3n_prog* sep_u)
   pog_u->byc_u.ops_y = sep_u->byc_u.ops_y;
 
   pog_u->lit_u.len_w = sep_u->lit_u.len_w;
+  pog_u->lit_u.hot_w = sep_u->lit_u.hot_w;
   pog_u->lit_u.non   = (u3_noun*) _n_prog_dat(pog_u);
 
   pog_u->mem_u.len_w = sep_u->mem_u.len_w;
@@ -925,6 +1005,7 @@ _n_prog_asm(u3_noun ops, u3n_prog* pog_u, u3_noun sip)
           sit_u->cop_u = NULL;
           sit_u->ham_u = NULL;
           sit_u->fin_p = 0;
+          sit_u->pic_p = 0;
           break;
         }
       }
@@ -957,6 +1038,37 @@ _n_prog_from_ops(u3_noun ops)
   return pog_u;
 }
 
+/* _n_fuse(): rewrite bytecode in place with superinstructions.
+**
+**   fusion is byte-for-byte: only the leading opcode of a pair is
+**   overwritten, so skips and return addresses that land on the
+**   absorbed opcode still find it intact, and the pass is idempotent.
+**   it allocates nothing and preserves semantics, so it may rewrite
+**   bytecode owned by a senior road.
+ */
+static void
+_n_fuse(u3n_prog* pog_u)
+{
+  c3_y* pog_y = pog_u->byc_u.ops_y;
+  c3_w  len_w = pog_u->byc_u.len_w,
+        ip_w  = 0,
+        nex_w;
+  c3_y  fus_y;
+
+  while ( HALT != pog_y[ip_w] ) {
+    nex_w = ip_w + 1 + _n_arg(pog_y[ip_w]);
+    u3_assert( nex_w < len_w );
+    fus_y = _n_pair(pog_y[ip_w], pog_y[nex_w]);
+
+    if ( HALT != fus_y ) {
+      pog_y[ip_w] = fus_y;
+      nex_w += 1 + _n_arg(pog_y[nex_w]);
+    }
+
+    ip_w = nex_w;
+  }
+}
+
 #if 0
 /* _n_print_stack(): print out the cap stack up to a designated "empty"
  *                   used only for debugging
@@ -1643,6 +1755,510 @@ _n_bite(u3_noun fol) {
   return _n_prog_from_ops(ops);
 }
 
+/* bytecode sidecar: programs spilled from the home road, so that
+**   they can be reloaded instead of recompiled once the cache has
+**   been reclaimed (or the loom rebuilt). the file, at
+**   .urb/chk/bytecode.bin, is a header followed by records; each
+**   record is a _cn_side_head, the cache key (jammed without
+**   backreferences), the bytecode, and the jammed remainder of the
+**   program (see _cn_prog_jam()). it is only a cache: it's discarded
+**   on a version mismatch, and truncated at the first torn record.
+*/
+#define _CN_SIDE_MAG  0x63796275  //  "ubyc"
+#define _CN_SIDE_MAX  (1ULL << 24) //  max key bits
+
+/* _cn_side_head: bytecode sidecar record header.
+*/
+typedef struct {
+  c3_w mug_w;                     //  mug of key
+  c3_w byc_w;                     //  length of bytecode
+  c3_d has_d;                     //  hash of key bytes
+  c3_d key_d;                     //  length of key bytes
+  c3_d bod_d;                     //  length of jammed remainder
+} _cn_side_head;
+
+/* _cn_side_dex: bytecode sidecar index entry.
+*/
+typedef struct {
+  c3_w mug_w;                     //  mug of key
+  c3_w nex_w;                     //  next in bucket (1-indexed), or 0
+  c3_d has_d;                     //  hash of key bytes
+  c3_d key_d;                     //  length of key bytes
+  c3_d off_d;                     //  record offset
+} _cn_side_dex;
+
+/* _cn_Side: bytecode sidecar (process-local).
+*/
+static struct {
+  c3_o          liv_o;            //  open attempted
+  c3_i          fid_i;            //  file, or -1
+  c3_d          end_d;            //  end of records
+  c3_w          len_w;            //  number of records
+  c3_w          all_w;            //  entries allocated
+  c3_w          bit_w;            //  log2 of bucket count
+  c3_w*         buc_w;            //  buckets (1-indexed entries)
+  _cn_side_dex* dex_u;            //  entries
+} _cn_Side = { .liv_o = c3n, .fid_i = -1 };
+
+/* _cn_side_flat_atom(): u3a_walk_fore() atom cb for _cn_side_flat().
+*/
+static void
+_cn_side_flat_atom(u3_atom a, void* ptr_v)
+{
+  ur_bsw_t* rit_u = ptr_v;
+  c3_w      met_w = u3r_met(0, a);
+
+  if ( c3y == u3a_is_cat(a) ) {
+    ur_bsw_atom64(rit_u, (c3_y)met_w, (c3_d)a);
+  }
+  else {
+    u3a_atom* vat_u = u3a_to_ptr(a);
+    ur_bsw_atom_bytes(rit_u, (c3_d)met_w, (c3_y*)vat_u->buf_w);
+  }
+}
+
+/* _cn_side_flat_cell(): u3a_walk_fore() cell cb for _cn_side_flat().
+*/
+static c3_o
+_cn_side_flat_cell(u3_noun a, void* ptr_v)
+{
+  ur_bsw_t* rit_u = ptr_v;
+
+  if ( rit_u->bits > _CN_SIDE_MAX ) {
+    return c3n;
+  }
+
+  ur_bsw_cell(rit_u);
+  return c3y;
+}
+
+/* _cn_side_flat(): jam without backreferences, or 0 if too large.
+**
+**   cache keys are small trees, for which dedup costs far more than
+**   it saves; this keeps lookups cheaper than recompilation.
+*/
+static c3_d
+_cn_side_flat(u3_noun a, c3_y** byt_y)
+{
+  ur_bsw_t rit_u = {0};
+  c3_d     len_d;
+
+  ur_bsw_init(&rit_u, ur_fib11, ur_fib12);
+  u3a_walk_fore(a, &rit_u, _cn_side_flat_atom, _cn_side_flat_cell);
+
+  if ( ur_bsw_done(&rit_u, &len_d, byt_y) > _CN_SIDE_MAX ) {
+    c3_free(*byt_y);
+    return 0;
+  }
+
+  return len_d;
+}
+
+/* _cn_side_hash(): hash key bytes.
+*/
+static c3_d
+_cn_side_hash(c3_d len_d, c3_y* byt_y)
+{
+  c3_w lo_w, hi_w;
+
+  u3_assert( len_d <= INT32_MAX );
+  MurmurHash3_x86_32(byt_y, (c3_i)len_d, 0xcafebabe, &lo_w);
+  MurmurHash3_x86_32(byt_y, (c3_i)len_d, 0xdeadbeef, &hi_w);
+  return ((c3_d)hi_w << 32) | lo_w;
+}
+
+/* _cn_side_index(): add a record to the sidecar index.
+*/
+static void
+_cn_side_index(_cn_side_head* hed_u, c3_d off_d)
+{
+  c3_w i_w;
+
+  if ( _cn_Side.len_w == _cn_Side.all_w ) {
+    _cn_Side.all_w = c3_max(1024, 2 * _cn_Side.all_w);
+    _cn_Side.bit_w = c3_bits_word(_cn_Side.all_w);
+    _cn_Side.dex_u = c3_realloc(_cn_Side.dex_u,
+                                _cn_Side.all_w * sizeof(_cn_side_dex));
+    _cn_Side.buc_w = c3_realloc(_cn_Side.buc_w,
+                                (1U << _cn_Side.bit_w) * sizeof(c3_w));
+    memset(_cn_Side.buc_w, 0, (1U << _cn_Side.bit_w) * sizeof(c3_w));
+
+    for ( i_w = 0; i_w < _cn_Side.len_w; i_w++ ) {
+      _cn_side_dex* dex_u = &(_cn_Side.dex_u[i_w]);
+      c3_w          buc_w = dex_u->mug_w & ((1U << _cn_Side.bit_w) - 1);
+
+      dex_u->nex_w = _cn_Side.buc_w[buc_w];
+      _cn_Side.buc_w[buc_w] = i_w + 1;
+    }
+  }
+
+  {
+    _cn_side_dex* dex_u = &(_cn_Side.dex_u[_cn_Side.len_w]);
+    c3_w          buc_w = hed_u->mug_w & ((1U << _cn_Side.bit_w) - 1);
+
+    dex_u->mug_w = hed_u->mug_w;
+    dex_u->has_d = hed_u->has_d;
+    dex_u->key_d = hed_u->key_d;
+    dex_u->off_d = off_d;
+    dex_u->nex_w = _cn_Side.buc_w[buc_w];
+    _cn_Side.buc_w[buc_w] = ++_cn_Side.len_w;
+  }
+}
+
+/* _cn_side_seek(): find a record by mug, hash, and key length.
+**                  produces 1-indexed entry after [dex_w], or 0.
+*/
+static c3_w
+_cn_side_seek(c3_w mug_w, c3_d has_d, c3_d key_d, c3_w dex_w)
+{
+  if ( !_cn_Side.len_w ) {
+    return 0;
+  }
+
+  dex_w = ( dex_w )
+          ? _cn_Side.dex_u[dex_w - 1].nex_w
+          : _cn_Side.buc_w[mug_w & ((1U << _cn_Side.bit_w) - 1)];
+
+  while ( dex_w ) {
+    _cn_side_dex* dex_u = &(_cn_Side.dex_u[dex_w - 1]);
+
+    if (  (mug_w == dex_u->mug_w)
+       && ((0 == key_d) || ((has_d == dex_u->has_d) && (key_d == dex_u->key_d))) )
+    {
+      return dex_w;
+    }
+    dex_w = dex_u->nex_w;
+  }
+
+  return 0;
+}
+
+/* _cn_side_open(): open and index the bytecode sidecar, once.
+*/
+static void
+_cn_side_open(void)
+{
+  c3_c ful_c[8193];
+  c3_w hed_w[2];
+  c3_d siz_d, off_d;
+  struct stat buf_u;
+
+  if ( (c3y == _cn_Side.liv_o) || !u3P.dir_c ) {
+    return;
+  }
+  _cn_Side.liv_o = c3y;
+
+  snprintf(ful_c, 8192, "%s/.urb/chk/bytecode.bin", u3P.dir_c);
+  if ( -1 == (_cn_Side.fid_i = c3_open(ful_c, O_RDWR | O_CREAT, 0600)) ) {
+    fprintf(stderr, "bytecode: c3_open %s: %s\r\n", ful_c, strerror(errno));
+    return;
+  }
+
+  if ( -1 == fstat(_cn_Side.fid_i, &buf_u) ) {
+    fprintf(stderr, "bytecode: fstat: %s\r\n", strerror(errno));
+    close(_cn_Side.fid_i);
+    _cn_Side.fid_i = -1;
+    return;
+  }
+  siz_d = buf_u.st_size;
+
+  if (  (sizeof(hed_w) > siz_d)
+     || (sizeof(hed_w) != pread(_cn_Side.fid_i, hed_w, sizeof(hed_w), 0))
+     || (_CN_SIDE_MAG != hed_w[0])
+     || (U3N_VERLAT != hed_w[1]) )
+  {
+    hed_w[0] = _CN_SIDE_MAG;
+    hed_w[1] = U3N_VERLAT;
+
+    if (  (0 != ftruncate(_cn_Side.fid_i, 0))
+       || (sizeof(hed_w) != pwrite(_cn_Side.fid_i, hed_w, sizeof(hed_w), 0)) )
+    {
+      fprintf(stderr, "bytecode: reset: %s\r\n", strerror(errno));
+      close(_cn_Side.fid_i);
+      _cn_Side.fid_i = -1;
+      return;
+    }
+    siz_d = sizeof(hed_w);
+  }
+
+  off_d = sizeof(hed_w);
+
+  while ( off_d < siz_d ) {
+    _cn_side_head hed_u;
+    c3_d          nex_d;
+
+    if ( sizeof(hed_u) != pread(_cn_Side.fid_i, &hed_u, sizeof(hed_u), off_d) ) {
+      break;
+    }
+
+    nex_d = off_d + sizeof(hed_u) + hed_u.key_d + hed_u.byc_w + hed_u.bod_d;
+
+    if ( (nex_d > siz_d) || (nex_d <= off_d) ) {
+      break;
+    }
+
+    _cn_side_index(&hed_u, off_d);
+    off_d = nex_d;
+  }
+
+  if ( off_d != siz_d ) {
+    fprintf(stderr, "bytecode: truncating torn record at %" PRIu64 "\r\n",
+                    off_d);
+    if ( 0 != ftruncate(_cn_Side.fid_i, off_d) ) {
+      fprintf(stderr, "bytecode: ftruncate: %s\r\n", strerror(errno));
+    }
+  }
+
+  _cn_Side.end_d = off_d;
+
+  if ( u3C.wag_w & u3o_verbose ) {
+    u3l_log("bytecode: %u cached programs", _cn_Side.len_w);
+  }
+}
+
+/* _cn_prog_jam(): serialize program sans bytecode, as [lit mem cal reg].
+*/
+static u3_noun
+_cn_prog_jam(u3n_prog* pog_u)
+{
+  u3_noun lit = u3_nul,
+          mem = u3_nul,
+          cal = u3_nul;
+  c3_w    i_w;
+
+  for ( i_w = pog_u->lit_u.len_w; i_w-- > 0; ) {
+    lit = u3nc(u3k(pog_u->lit_u.non[i_w]), lit);
+  }
+
+  for ( i_w = pog_u->mem_u.len_w; i_w-- > 0; ) {
+    u3n_memo* mem_u = &(pog_u->mem_u.sot_u[i_w]);
+    mem = u3nc(u3nt(mem_u->sip_l, mem_u->cid, u3k(mem_u->key)), mem);
+  }
+
+  for ( i_w = pog_u->cal_u.len_w; i_w-- > 0; ) {
+    cal = u3nc(u3k(pog_u->cal_u.sit_u[i_w].axe), cal);
+  }
+
+  return u3nq(lit, mem, cal, u3i_word(pog_u->reg_u.len_w));
+}
+
+/* _cn_prog_cue(): deserialize program from bytecode and _cn_prog_jam(),
+**                 or NULL. RETAIN.
+*/
+static u3n_prog*
+_cn_prog_cue(c3_w len_w, c3_y* byc_y, u3_noun bod)
+{
+  u3_noun lit, mem, cal, reg, i, t;
+  c3_w    lit_w = 0, mem_w = 0, cal_w = 0, reg_w, i_w;
+  u3n_prog* pog_u;
+
+  if (  (c3n == u3r_qual(bod, &lit, &mem, &cal, &reg))
+     || (c3n == u3r_safe_word(reg, &reg_w))
+     || (0 == len_w) )
+  {
+    return NULL;
+  }
+
+  for ( t = lit; c3y == u3du(t); t = u3t(t) ) lit_w++;
+  for ( t = mem; c3y == u3du(t); t = u3t(t) ) mem_w++;
+  for ( t = cal; c3y == u3du(t); t = u3t(t) ) cal_w++;
+
+  pog_u = _n_prog_new(len_w, cal_w, reg_w, lit_w, mem_w);
+  memcpy(pog_u->byc_u.ops_y, byc_y, len_w);
+
+  for ( i_w = 0, t = lit; i_w < lit_w; i_w++, t = u3t(t) ) {
+    pog_u->lit_u.non[i_w] = u3k(u3h(t));
+  }
+
+  for ( i_w = 0, t = mem; i_w < mem_w; i_w++, t = u3t(t) ) {
+    u3n_memo* mem_u = &(pog_u->mem_u.sot_u[i_w]);
+    u3_noun   sip, cid, key;
+
+    i = u3h(t);
+    if ( c3n == u3r_trel(i, &sip, &cid, &key) ) {
+      sip = cid = 0;
+      key = i;
+    }
+    mem_u->sip_l = ( c3y == u3a_is_cat(sip) ) ? sip : 0;
+    mem_u->cid   = ( c3y == u3a_is_cat(cid) ) ? cid : 0;
+    mem_u->key   = u3k(key);
+  }
+
+  for ( i_w = 0, t = cal; i_w < cal_w; i_w++, t = u3t(t) ) {
+    u3j_site* sit_u = &(pog_u->cal_u.sit_u[i_w]);
+    sit_u->axe   = u3k(u3h(t));
+    sit_u->pog_p = 0;
+    sit_u->bat   = u3_none;
+    sit_u->bas   = u3_none;
+    sit_u->loc   = u3_none;
+    sit_u->lab   = u3_none;
+    sit_u->jet_o = c3n;
+    sit_u->fon_o = c3n;
+    sit_u->cop_u = NULL;
+    sit_u->ham_u = NULL;
+    sit_u->fin_p = 0;
+    sit_u->pic_p = 0;
+  }
+
+  for ( i_w = 0; i_w < reg_w; i_w++ ) {
+    u3j_rite* rit_u = &(pog_u->reg_u.rit_u[i_w]);
+    rit_u->own_o = c3n;
+    rit_u->clu   = u3_none;
+    rit_u->fin_p = 0;
+  }
+
+  return pog_u;
+}
+
+/* _cn_side_load(): load program for cache key from the sidecar, or NULL.
+*/
+static u3n_prog*
+_cn_side_load(u3_noun key)
+{
+  u3n_prog* pog_u = NULL;
+  c3_w      mug_w, dex_w;
+  c3_d      len_d, has_d;
+  c3_y*     byt_y;
+
+  _cn_side_open();
+
+  if ( (-1 == _cn_Side.fid_i) || !_cn_Side.len_w ) {
+    return NULL;
+  }
+
+  //  most misses stop here, at the mug
+  //
+  mug_w = u3r_mug(key);
+  if ( !_cn_side_seek(mug_w, 0, 0, 0) ) {
+    return NULL;
+  }
+
+  if ( !(len_d = _cn_side_flat(key, &byt_y)) ) {
+    return NULL;
+  }
+  has_d = _cn_side_hash(len_d, byt_y);
+  dex_w = 0;
+
+  while ( !pog_u && (dex_w = _cn_side_seek(mug_w, has_d, len_d, dex_w)) ) {
+    _cn_side_dex* dex_u = &(_cn_Side.dex_u[dex_w - 1]);
+    _cn_side_head hed_u;
+    c3_y*         buf_y;
+    c3_d          siz_d;
+    u3_weak       bod;
+
+    if ( sizeof(hed_u) != pread(_cn_Side.fid_i, &hed_u, sizeof(hed_u),
+                                dex_u->off_d) )
+    {
+      break;
+    }
+
+    siz_d = hed_u.key_d + hed_u.byc_w + hed_u.bod_d;
+    buf_y = c3_malloc(siz_d);
+
+    if (  ((c3_zs)siz_d == pread(_cn_Side.fid_i, buf_y, siz_d,
+                                 dex_u->off_d + sizeof(hed_u)))
+       && (0 == memcmp(buf_y, byt_y, len_d)) )
+    {
+      c3_y* byc_y = buf_y + hed_u.key_d;
+
+      bod = u3s_cue_xeno(hed_u.bod_d, byc_y + hed_u.byc_w);
+
+      if ( u3_none != bod ) {
+        pog_u = _cn_prog_cue(hed_u.byc_w, byc_y, bod);
+        u3z(bod);
+      }
+    }
+
+    c3_free(buf_y);
+  }
+
+  c3_free(byt_y);
+  return pog_u;
+}
+
+/* _cn_side_spill(): u3h_walk cb for u3n_spill().
+*/
+static void
+_cn_side_spill(u3_noun kev)
+{
+  u3_noun       key = u3h(kev);
+  u3n_prog*     pog_u = u3to(u3n_prog, u3t(kev));
+  _cn_side_head hed_u = {0};
+  c3_y*         key_y;
+  c3_y*         bod_y;
+
+  //  leech programs are never spilled, as they are never on home
+  //
+  u3_assert( c3y == pog_u->byc_u.own_o );
+
+  if ( !(hed_u.key_d = _cn_side_flat(key, &key_y)) ) {
+    return;
+  }
+  hed_u.mug_w = u3r_mug(key);
+  hed_u.byc_w = pog_u->byc_u.len_w;
+  hed_u.has_d = _cn_side_hash(hed_u.key_d, key_y);
+
+  //  the remainder is consed on the loom, which is likely short
+  //  when reclaimed; the spill is skipped if it mightn't fit
+  //
+  {
+    c3_w cel_w = 3 + pog_u->lit_u.len_w
+                   + (3 * pog_u->mem_u.len_w)
+                   + pog_u->cal_u.len_w;
+
+    if ( ((c3_d)cel_w * u3a_minimum) > (u3a_open(u3R) >> 1) ) {
+      c3_free(key_y);
+      return;
+    }
+  }
+
+  if ( !_cn_side_seek(hed_u.mug_w, hed_u.has_d, hed_u.key_d, 0) ) {
+    u3_noun bod = _cn_prog_jam(pog_u);
+    c3_d    off_d = _cn_Side.end_d;
+    c3_d    nex_d;
+
+    u3s_jam_xeno(bod, &hed_u.bod_d, &bod_y);
+    u3z(bod);
+
+    {
+      struct iovec vec_u[4] = {
+        { .iov_base = &hed_u,             .iov_len = sizeof(hed_u) },
+        { .iov_base = key_y,              .iov_len = hed_u.key_d },
+        { .iov_base = pog_u->byc_u.ops_y, .iov_len = hed_u.byc_w },
+        { .iov_base = bod_y,              .iov_len = hed_u.bod_d }
+      };
+
+      nex_d = off_d + sizeof(hed_u) + hed_u.key_d + hed_u.byc_w + hed_u.bod_d;
+
+      if ( (c3_zs)(nex_d - off_d) == pwritev(_cn_Side.fid_i, vec_u, 4, off_d) ) {
+        _cn_side_index(&hed_u, off_d);
+        _cn_Side.end_d = nex_d;
+      }
+      else {
+        fprintf(stderr, "bytecode: spill: %s\r\n", strerror(errno));
+      }
+    }
+
+    c3_free(bod_y);
+  }
+
+  c3_free(key_y);
+}
+
+/* u3n_spill(): write home-road programs to the bytecode sidecar.
+*/
+void
+u3n_spill(void)
+{
+  u3_assert(u3R == &(u3H->rod_u));
+
+  _cn_side_open();
+
+  if ( -1 != _cn_Side.fid_i ) {
+    u3h_walk(u3R->byc.har_p, _cn_side_spill);
+  }
+}
+
 /* _n_find(): return prog for given formula with prefix (u3_nul for none).
  *            RETAIN.
  */
@@ -1672,6 +2288,7 @@ _n_find(u3_noun pre, u3_noun fol)
           sit_u->bat   = u3_none;
           sit_u->pog_p = 0;
           sit_u->fon_o = c3n;
+          u3j_site_lend(sit_u);
         }
         u3h_put(u3R->byc.har_p, key, u3a_outa(old));
         u3z(key);
@@ -1680,8 +2297,15 @@ _n_find(u3_noun pre, u3_noun fol)
     }
   }
 
+  //  the sidecar is read only on the home road: inner roads are
+  //  short-lived, and their misses are mostly found in their parents
+  //
   {
-    u3n_prog* gop = _n_bite(fol);
+    u3n_prog* gop = ( u3R == &u3H->rod_u ) ? _cn_side_load(key) : NULL;
+
+    if ( !gop ) {
+      gop = _n_bite(fol);
+    }
     u3h_put(u3R->byc.har_p, key, u3a_outa(gop));
     u3z(key);
     return gop;
@@ -1737,7 +2361,7 @@ _cn_intlen(c3_w num_w)
 }
 
 /* _cn_is_indexed(): return true if bop_w is an opcodes that uses pog_u->lit_u.non
-**            bop_w: opcode (assumed 0-94)
+**            bop_w: opcode (assumed 0-101)
 */
 c3_b
 _cn_is_indexed(c3_w bop_w)
@@ -1753,6 +2377,7 @@ _cn_is_indexed(c3_w bop_w)
     case MITB: case MITS:
     case HILB: case HILS:
     case HINB: case HINS:
+    case LUSH:
     return 1;
   default:
     return 0;
@@ -1769,73 +2394,100 @@ _cn_is_indexed(c3_w bop_w)
   par_w == 2 ? _n_resh(pog_y, &ip_w):       \
   pog_y[ip_w++])
 
+/* _cn_etch_op(): render one op as " name" or " [name arg ...]",
+**                 superinstructions with the absorbed op's argument.
+**          pog_y: a bytecode stream
+**           ip_w: index of the op, advanced past it
+**          str_c: output buffer, or 0 to only measure
+**        returns: length of the rendering
+*/
+static c3_w
+_cn_etch_op(c3_y* pog_y, c3_w* ip_w, c3_c* str_c)
+{
+  c3_w dex_w = *ip_w;
+  c3_y bop_y = pog_y[dex_w++],
+       tal_y = _n_tail(bop_y);
+  c3_w par_w = _n_arg(bop_y),
+       tar_w = 0,
+       num_w = 0,
+       nut_w = 0;
+  c3_c buf_c[48];
+  c3_i len_i;
+
+  if ( par_w > 0 ) {
+    num_w = _cn_pog_to_num(par_w, pog_y, dex_w);
+  }
+  if ( HALT != tal_y ) {
+    dex_w++;
+    tar_w = _n_arg(tal_y);
+    if ( tar_w > 0 ) {
+      nut_w = _cn_pog_to_num(tar_w, pog_y, dex_w);
+    }
+  }
+  *ip_w = dex_w;
+
+  if ( (0 == par_w) && (0 == tar_w) ) {
+    len_i = snprintf(buf_c, sizeof(buf_c), " %.4s", opcode_names[bop_y]);
+  }
+  else if ( 0 == tar_w ) {
+    len_i = snprintf(buf_c, sizeof(buf_c), " [%.4s %s%u]",
+                     opcode_names[bop_y],
+                     _cn_is_indexed(bop_y) ? "i:" : "", num_w);
+  }
+  else if ( 0 == par_w ) {
+    len_i = snprintf(buf_c, sizeof(buf_c), " [%.4s %s%u]",
+                     opcode_names[bop_y],
+                     _cn_is_indexed(tal_y) ? "i:" : "", nut_w);
+  }
+  else {
+    len_i = snprintf(buf_c, sizeof(buf_c), " [%.4s %s%u %s%u]",
+                     opcode_names[bop_y],
+                     _cn_is_indexed(bop_y) ? "i:" : "", num_w,
+                     _cn_is_indexed(tal_y) ? "i:" : "", nut_w);
+  }
+
+  if ( str_c ) {
+    memcpy(str_c, buf_c, len_i);
+  }
+  return len_i;
+}
+
 /* _cn_etch_bytecode(): render a nock program as string of bytecodes
 **                 fol: a nock formula to compile and render
-**             returns: a u3i_string noun of the rendered bytecode
+**             returns: a u3i_string noun of the rendered bytecode,
+**                      fused as the hot tier would run it
 */
 u3_noun
 _cn_etch_bytecode(u3_noun fol) {
   u3n_prog* pog_u = _n_bite(fol);
   c3_y* pog_y = pog_u->byc_u.ops_y;
   c3_w len_w = pog_u->byc_u.len_w;
-  c3_w ip_w=0, num_w=0, bop_w=0, dex_w=0;
-  c3_w len_c = 1; // opening "{"
-  // set par_w (parameter flag) to an invalid value,
-  // so we can break imeadately if needed
-  c3_w par_w = 5;
+  c3_w ip_w = 0, len_c = 0;
+  c3_c* str_c;
+  u3_noun str;
+
+  if ( !(u3C.wag_w & u3o_no_fuse) ) {
+    _n_fuse(pog_u);
+  }
+
   // lets count the chars in this string
   while ( ip_w < len_w ) {
-    par_w = _n_arg(pog_y[ip_w]);
-    bop_w = pog_y[ip_w++];         // move ip_w for reading a opcode name
-    dex_w = _cn_is_indexed(bop_w); // is this an indexed bytecode argument
-    len_c += 5;                    // a leading space, and opcode name
-    if (par_w > 0) {               // if pair: "[bytecode arg]" else "bytecode"
-      len_c += 3;                  // "[", space between opcode & arg, "]"
-      if ( dex_w ) len_c += 2;     // 'i:'
-      len_c += _cn_intlen(         // length of the bytecode argument
-        _cn_pog_to_num(par_w, pog_y, ip_w)
-      );
-    }
+    len_c += _cn_etch_op(pog_y, &ip_w, 0);
   }
-  // reset so we can loop again
-  ip_w=0, num_w=0, bop_w=0, dex_w=0, par_w=5;
-  // init our string, and give it a trailing null
-  c3_c str_c[len_c];
-  str_c[0] = 0;
-  // lets print this string
-  while ( ip_w < len_w ) {
-    par_w = _n_arg(pog_y[ip_w]);
-    bop_w = pog_y[ip_w++];                        // move ip_w for reading a opcode name
-    dex_w = _cn_is_indexed(bop_w);                // is this an indexed bytecode argument
-    strcat(str_c, " ");                           // leading space
-    if (par_w > 0) strcat(str_c, "[");            // add "[" if the opcode pairs
-    strncat(str_c, opcode_names[bop_w], 4);       // add the opcode name
-    if (par_w > 0) {                              // finish the pair
-      strcat(str_c, " ");                         // add the space between byt and arg
-      if ( dex_w ) strcat(str_c, "i:");           // indexed args are labeled as "index of arg"
-      num_w = _cn_pog_to_num(par_w, pog_y, ip_w); // the bytecode argument
-      if (num_w == 0) {                           //
-        strcat(str_c, "0");                       // handle a literal zero
-      }                                           //
-      else {                                      //
-        c3_w x = 0;                               //
-        for (x = _cn_intlen(num_w); x > 0; x--) { //
-          strcat(str_c, "_");                     // prefill the buffer
-        }                                         //
-        c3_w f = strlen(str_c)-1;                 // get the index of the last prefill
-        while (num_w > 0) {                       // stringify number in LSB order
-          str_c[f--] = (num_w%10)+'0';            // .. stringify the tail of num into tail of buf
-          num_w /= 10;                            // .. turncate num by one digit
-        }                                         //
-      }                                           //
-      strcat(str_c, "]");                         // add the closing brace
-    }
+  // lets print this string, with a closing "}" and trailing null
+  str_c = c3_malloc(len_c + 2);
+  for ( ip_w = 0, len_c = 0; ip_w < len_w; ) {
+    len_c += _cn_etch_op(pog_y, &ip_w, str_c + len_c);
   }
   // replace the first leading space and append the last char to the string
-  str_c[0] = '{';
-  strcat(str_c, "}");
+  str_c[0]       = '{';
+  str_c[len_c++] = '}';
+  str_c[len_c]   = 0;
+
+  str = u3i_string(str_c);
+  c3_free(str_c);
   _cn_prog_free(pog_u);
-  return u3i_string(str_c);
+  return str;
 }
 
 
@@ -2043,6 +2695,25 @@ _n_kale(u3_noun a)
   return a;
 }
 
+/* _n_heat(): count a burn of pog_u, fusing it once it runs hot.
+**
+**   hot_w sits in what was struct padding, so u3n_prog keeps its
+**   persistent layout; it saturates at _N_HOT, and is not counted
+**   at all while fusion is disabled.
+ */
+#define _N_HOT 256
+
+static inline void
+_n_heat(u3n_prog* pog_u)
+{
+  if (  (pog_u->lit_u.hot_w < _N_HOT)
+     && !(u3C.wag_w & u3o_no_fuse)
+     && (_N_HOT == ++pog_u->lit_u.hot_w) )
+  {
+    _n_fuse(pog_u);
+  }
+}
+
 typedef struct __attribute__((__packed__)) {
   u3n_prog* pog_u;
   c3_w     ip_w;
@@ -2075,6 +2746,7 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
 
   empty = u3R->cap_p;
   _n_push(mov, off, bus);
+  _n_heat(pog_u);
 
 #ifdef U3_CPU_DEBUG
   u3R->pro.nox_d += 1;
@@ -2290,6 +2962,7 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       pog_u = _n_find(u3_nul, o);
       pog   = pog_u->byc_u.ops_y;
       ip_w  = 0;
+      _n_heat(pog_u);
 #ifdef U3_CPU_DEBUG
     u3R->pro.nox_d += 1;
 #endif
@@ -2451,6 +3124,7 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
         pog_u = u3to(u3n_prog, sit_u->pog_p);
         pog   = pog_u->byc_u.ops_y;
         ip_w  = 0;
+        _n_heat(pog_u);
 #ifdef U3_CPU_DEBUG
     u3R->pro.nox_d += 1;
 #endif
@@ -2483,6 +3157,7 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
         pog_u = u3to(u3n_prog, sit_u->pog_p);
         pog   = pog_u->byc_u.ops_y;
         ip_w  = 0;
+        _n_heat(pog_u);
 #ifdef U3_CPU_DEBUG
     u3R->pro.nox_d += 1;
 #endif
@@ -2626,10 +3301,22 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       x     = u3nc(x, o);
       o     = u3z_find_m(mem_u->cid, 144 + c3__nock, x);
       if ( u3_none == o ) {
-        _n_push(mov, off, u3nc(mem_u->cid, x));
+        //  when profiling, the pending save carries its site and clock
+        //
+        if ( u3C.wag_w & u3o_debug_cpu ) {
+          c3_w sit_w = u3t_memo_look(mem_u->key, mem_u->cid, c3n);
+          o = u3nt(mem_u->cid, sit_w, u3i_chub(u3t_trace_time()));
+        }
+        else {
+          o = mem_u->cid;
+        }
+        _n_push(mov, off, u3nc(o, x));
         _n_push(mov, off, u3k(u3h(x)));
       }
       else {
+        if ( u3C.wag_w & u3o_debug_cpu ) {
+          u3t_memo_look(mem_u->key, mem_u->cid, c3y);
+        }
         ip_w += mem_u->sip_l;
         _n_push(mov, off, o);
         u3z(x);
@@ -2640,13 +3327,28 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       x   = _n_pep(mov, off);  // product
       top = _n_peek(off);
       o   = *top;
-      if ( ( u3z_memo_toss == u3h(o) )
-         ? ( &(u3H->rod_u) != u3R )
-         : ( 0 == u3R->ski.gul ) ) {  //  prevents userspace from persistence
-        u3z_save_m(u3h(o), 144 + c3__nock, u3t(o), x);
-      }
-      else if ( u3z_memo_keep == u3h(o) ) {
-        fprintf(stderr, "\r\nnock: userspace can't save to persistent cache\r\n");
+      {
+        //  [cid key], or [[cid site clock] key] when profiling
+        //
+        u3_noun pre = u3h(o);
+        u3z_cid cid = ( c3y == u3du(pre) ) ? u3h(pre) : pre;
+
+        if ( ( u3z_memo_toss == cid )
+           ? ( &(u3H->rod_u) != u3R )
+           : ( 0 == u3R->ski.gul ) ) {  //  prevents userspace from persistence
+          if ( c3y == u3du(pre) ) {
+            c3_d mic_d = u3t_trace_time() - u3r_chub(0, u3t(u3t(pre)));
+            c3_w wid_w = u3z_save_wid(cid, 144 + c3__nock, u3t(o), x);
+
+            u3t_memo_save(u3h(u3t(pre)), mic_d, wid_w);
+          }
+          else {
+            u3z_save_m(cid, 144 + c3__nock, u3t(o), x);
+          }
+        }
+        else if ( u3z_memo_keep == cid ) {
+          fprintf(stderr, "\r\nnock: userspace can't save to persistent cache\r\n");
+        }
       }
       *top = x;
       u3z(o);
@@ -2795,6 +3497,51 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
     edit_in:
       *top = u3i_edit(*top, x, o);
       BURN();
+
+    do_ckib:                   // COPY + KICB
+      top = _n_peek(off);
+      _n_push(mov, off, u3k(*top));
+      goto kicb_in;
+
+    do_fkib:                   // FABK + KICB
+      x   = pog[ip_w++];
+      top = _n_peek(off);
+      _n_push(mov, off, u3k(u3x_at(x, *top)));
+      goto kicb_in;
+
+    do_flib:                   // FABL + KICB
+      x    = pog[ip_w++];
+      top  = _n_peek(off);
+      o    = *top;
+      *top = u3k(u3x_at(x, o));
+      u3z(o);
+    kicb_in:
+      ip_w++;
+      x = pog[ip_w++];
+      goto kick_in;
+
+    do_ftib:                   // FABL + TICB
+      x    = pog[ip_w++];
+      top  = _n_peek(off);
+      o    = *top;
+      *top = u3k(u3x_at(x, o));
+      u3z(o);
+      ip_w++;
+      x = pog[ip_w++];
+      goto tick_in;
+
+    do_lush:                   // LIBK + BUSH
+      o = u3k(pog_u->lit_u.non[pog[ip_w++]]);
+      ip_w++;
+      x = u3k(pog_u->lit_u.non[pog[ip_w++]]);
+      u3t_push(u3nc(x, o));
+      BURN();
+
+    do_pas2:                   // LITB or LIBK + TOSS
+      ip_w++;
+    do_pas1:                   // LIT0 or LIT1 + TOSS
+      ip_w++;
+      BURN();
   }
 }
 
@@ -2863,6 +3610,8 @@ _cn_take_prog_dat(u3n_prog* dst_u, u3n_prog* src_u)
 {
   c3_w i_w;
 
+  dst_u->lit_u.hot_w = src_u->lit_u.hot_w;
+
   for ( i_w = 0; i_w < src_u->lit_u.len_w; ++i_w ) {
     dst_u->lit_u.non[i_w] = u3a_take(src_u->lit_u.non[i_w]);
   }
@@ -2928,6 +3677,8 @@ _cn_merge_prog_dat(u3n_prog* dst_u, u3n_prog* src_u)
 {
   c3_w i_w;
 
+  dst_u->lit_u.hot_w = c3_max(dst_u->lit_u.hot_w, src_u->lit_u.hot_w);
+
   for ( i_w = 0; i_w < src_u->lit_u.len_w; ++i_w ) {
     u3z(dst_u->lit_u.non[i_w]);
     dst_u->lit_u.non[i_w] = src_u->lit_u.non[i_w];
@@ -3005,6 +3756,8 @@ _n_ream(u3_noun kev)
   pog_u->mem_u.sot_u = (u3n_memo*) (pog_u->lit_u.non + pog_u->lit_u.len_w + pod_w);
   pog_u->cal_u.sit_u = (u3j_site*) (pog_u->mem_u.sot_u + pog_u->mem_u.len_w + ped_w);
   pog_u->reg_u.rit_u = (u3j_rite*) (pog_u->cal_u.sit_u + pog_u->cal_u.len_w);
+  // hot_w was padding in older images
+  pog_u->lit_u.hot_w = 0;
 
   for ( i_w = 0; i_w < pog_u->cal_u.len_w; ++i_w ) {
     u3j_site_ream(&(pog_u->cal_u.sit_u[i_w]));
@@ -3076,7 +3829,7 @@ u3n_mark()
 
   qua_u[2] = NULL;
 
-  u3m_quac* tot_u = c3_malloc(sizeof(*tot_u));
+  u3m_quac* tot_u = c3_calloc(sizeof(*tot_u));
   tot_u->nam_c = strdup("total nock stuff");
   tot_u->siz_w = qua_u[0]->siz_w + qua_u[1]->siz_w;
   tot_u->qua_u = qua_u;
@@ -3094,6 +3847,16 @@ u3n_reclaim(void)
   //    We can't just u3h_free() -- the value is a post to a u3n_prog.
   //    Note that the hank cache *must* also be freed (in u3j_reclaim())
   //
+  //    On the home road, programs are first spilled to the sidecar,
+  //    so that they needn't be recompiled. Not so during a migration
+  //    (the image is older than this binary), as its programs are
+  //    being thrown away.
+  //
+  if (  (u3R == &(u3H->rod_u))
+     && (U3V_VERLAT == u3H->ver_w) )
+  {
+    u3n_spill();
+  }
   u3n_free();
   u3R->byc.har_p = u3h_new();
 }
@@ -32,6 +32,7 @@
     } byc_u;                          // bytecode
     struct {
       c3_w      len_w;                // number of literals
+      c3_w      hot_w;                // burn count, see _n_heat()
       u3_noun*  non;                  // array of literals
     } lit_u;                          // literals
     struct {
@@ -131,6 +132,11 @@
       void
       u3n_reclaim(void);
 
+    /* u3n_spill(): write home-road programs to the bytecode sidecar.
+    */
+      void
+      u3n_spill(void);
+
     /* u3n_rewrite_compact(): rewrite bytecode cache for compaction.
      */
       void
@@ -62,6 +62,119 @@ _test_meme(void)
   return ret_i;
 }
 
+static c3_i
+_test_memo_budget(void)
+{
+  c3_w    hab_w = u3C.hab_w;
+  c3_i  ret_i = 1;
+  c3_w    i_w;
+
+  u3C.hab_w = 1;  //  MiB
+  u3z_free(u3z_memo_toss);
+
+  //  a ~4KiB list per entry, so the budget holds a couple hundred
+  //
+  for ( i_w = 0; i_w < 2000; i_w++ ) {
+    u3_noun val = u3_nul;
+    c3_w    j_w;
+
+    for ( j_w = 0; j_w < 200; j_w++ ) {
+      val = u3nc(i_w + j_w, val);
+    }
+
+    u3z(u3z_save_m(u3z_memo_toss, c3__test, i_w, val));
+
+    if ( u3z_weight(u3z_memo_toss) > (1 << 18) ) {
+      fprintf(stderr, "memo budget: over budget at %u: %u words\r\n",
+                      i_w, u3z_weight(u3z_memo_toss));
+      ret_i = 0;
+      break;
+    }
+  }
+
+  if ( (u3z_wyt(u3z_memo_toss) < 100) || (u3z_wyt(u3z_memo_toss) > 400) ) {
+    fprintf(stderr, "memo budget: %u entries\r\n", u3z_wyt(u3z_memo_toss));
+    ret_i = 0;
+  }
+
+  {
+    u3_weak got = u3z_find_m(u3z_memo_toss, c3__test, 1999);
+
+    if ( (u3_none == got) || (1999 + 199 != u3h(got)) ) {
+      fprintf(stderr, "memo budget: newest entry missing\r\n");
+      ret_i = 0;
+    }
+
+    if ( u3_none != got ) {
+      u3z(got);
+    }
+  }
+
+  if ( u3_none != u3z_find_m(u3z_memo_toss, c3__test, 0) ) {
+    fprintf(stderr, "memo budget: oldest entry kept\r\n");
+    ret_i = 0;
+  }
+
+  //  an entry that cannot fit is not cached at all
+  //
+  {
+    c3_w    wyt_w = u3z_wyt(u3z_memo_toss);
+    u3_atom big   = u3qc_bex(1 << 24);
+
+    u3z(u3z_save_m(u3z_memo_toss, c3__test, 2000, big));
+
+    if (  (wyt_w != u3z_wyt(u3z_memo_toss))
+       || (u3_none != u3z_find_m(u3z_memo_toss, c3__test, 2000)) )
+    {
+      fprintf(stderr, "memo budget: oversized entry cached\r\n");
+      ret_i = 0;
+    }
+  }
+
+  u3z_free(u3z_memo_toss);
+
+  if ( u3z_wyt(u3z_memo_toss) || u3z_weight(u3z_memo_toss) ) {
+    fprintf(stderr, "memo budget: free left %u words\r\n",
+                    u3z_weight(u3z_memo_toss));
+    ret_i = 0;
+  }
+
+  u3C.hab_w = hab_w;
+
+  return ret_i;
+}
+
+static c3_i
+_test_memo_limit(void)
+{
+  c3_w hap_w = u3C.hap_w;
+  c3_w hab_w = u3C.hab_w;
+  c3_i ret_i = 1;
+  c3_w i_w;
+
+  u3C.hap_w = 100;
+  u3C.hab_w = 0;
+  u3z_free(u3z_memo_toss);
+
+  for ( i_w = 0; i_w < 1000; i_w++ ) {
+    u3z(u3z_save_m(u3z_memo_toss, c3__test, i_w, u3nc(i_w, u3_nul)));
+
+    if ( u3z_wyt(u3z_memo_toss) > 100 ) {
+      fprintf(stderr, "memo limit: %u entries at %u\r\n",
+                      u3z_wyt(u3z_memo_toss), i_w);
+      ret_i = 0;
+      break;
+    }
+  }
+
+  u3z_free(u3z_memo_toss);
+
+  u3C.hap_w = hap_w;
+  u3C.hab_w = hab_w;
+
+  return ret_i;
+}
+
 /* main(): run all test cases.
 */
 int
@@ -74,6 +187,16 @@ main(int argc, char* argv[])
     exit(1);
   }
 
+  if ( !_test_memo_budget() ) {
+    fprintf(stderr, "test memo budget: failed\r\n");
+    exit(1);
+  }
+
+  if ( !_test_memo_limit() ) {
+    fprintf(stderr, "test memo limit: failed\r\n");
+    exit(1);
+  }
+
   //  GC
   //
   u3m_grab(u3_none);
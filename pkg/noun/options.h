@@ -18,7 +18,10 @@
         size_t  wor_i;                        //  loom word-length (<= u3a_words)
         c3_w    tos_w;                        //  loom toss skip-length
         c3_w    hap_w;                        //  transient memoization cache size
+        c3_w    hab_w;                        //  transient memoization budget, MiB
         c3_w    per_w;                        //  persistent memoization cache size
+        c3_w    peb_w;                        //  persistent memoization budget, MiB
+        c3_w    nod_w;                        //  loom NUMA node (u3o_numa_node)
         void (*stderr_log_f)(c3_c*);          //  errors from c code
         void (*slog_f)(u3_noun);              //  function pointer for slog
         void (*sign_hold_f)(void);            //  suspend system signal regime
@@ -44,7 +47,14 @@
         u3o_auto_meld     = 1 << 10,          //  enables meld under pressure
         u3o_soft_mugs     = 1 << 11,          //  continue replay on mismatch
         u3o_swap          = 1 << 12,          //  enables ephemeral file
-        u3o_toss          = 1 << 13           //  reclaim often
+        u3o_toss          = 1 << 13,          //  reclaim often
+        u3o_pack_idle     = 1 << 14,          //  compact between events
+        u3o_no_fuse       = 1 << 15,          //  disable superinstructions
+        u3o_no_poly       = 1 << 16,          //  monomorphic call sites
+        u3o_soft_dirty    = 1 << 17,          //  kernel dirty page tracking
+        u3o_save_async    = 1 << 18,          //  snapshot in the background
+        u3o_huge_page     = 1 << 19,          //  transparent huge pages
+        u3o_numa_node     = 1 << 20           //  bind loom to a NUMA node
       };
 
   /** Globals.
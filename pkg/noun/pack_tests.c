@@ -0,0 +1,160 @@
+/// @file
+
+#include "noun.h"
+#include "events.h"
+#include "vortex.h"
+
+#include <sys/wait.h>
+
+#define _PACK_GAR   (1U << 20)            //  garbage cells, freed
+#define _PACK_LIV   (1U << 18)            //  live kernel cells
+
+/* _pack_pier(): remove a scratch pier.
+*/
+static void
+_pack_pier(c3_c* dir_c)
+{
+  c3_c pax_c[8193];
+
+  snprintf(pax_c, 8192, "%s/.urb/chk/north.bin", dir_c);
+  unlink(pax_c);
+  snprintf(pax_c, 8192, "%s/.urb/chk/south.bin", dir_c);
+  unlink(pax_c);
+  snprintf(pax_c, 8192, "%s/.urb/chk/image.bin", dir_c);
+  unlink(pax_c);
+  snprintf(pax_c, 8192, "%s/.urb/chk", dir_c);
+  rmdir(pax_c);
+  snprintf(pax_c, 8192, "%s/.urb", dir_c);
+  rmdir(pax_c);
+  rmdir(dir_c);
+}
+
+/* _pack_list(): a list of [len_w] fresh cells.
+*/
+static u3_noun
+_pack_list(c3_w len_w)
+{
+  u3_noun lis = u3_nul;
+  c3_w    i_w;
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    lis = u3nc(u3nc(i_w, i_w + 1), lis);
+  }
+
+  return lis;
+}
+
+/* _pack_save(): in a fresh pier, save in the middle of a compaction cycle.
+*/
+static void
+_pack_save(c3_c* dir_c)
+{
+  u3_noun gar;
+
+  u3m_boot(dir_c, (size_t)1 << 28);
+
+  //  garbage below the kernel, freed to make room for compaction
+  //
+  gar = _pack_list(_PACK_GAR);
+  u3A->roc = _pack_list(_PACK_LIV);
+  u3z(gar);
+
+  if ( c3n == u3m_pack_open() ) {
+    fprintf(stderr, "pack: cycle not begun\r\n");
+    exit(1);
+  }
+
+  //  out of time at once; the traversal stack is held
+  //
+  if ( c3n == u3m_pack_step(0) ) {
+    fprintf(stderr, "pack: cycle complete\r\n");
+    exit(1);
+  }
+
+  u3m_save();
+  u3m_stop();
+  exit(0);
+}
+
+/* _test_save_mid_cycle(): a snapshot taken mid-cycle holds no extra references.
+*/
+static c3_i
+_test_save_mid_cycle(void)
+{
+  c3_c  dir_c[] = "/tmp/pack-test-XXXXXX";
+  c3_i  ret_i = 1;
+  c3_i  sat_i;
+  c3_w  len_w = 0, bad_w = 0;
+  pid_t pid_i;
+
+  if ( !mkdtemp(dir_c) ) {
+    fprintf(stderr, "pack: mkdtemp: %s\r\n", strerror(errno));
+    return 0;
+  }
+
+  //  save in a child, so that the loom can be loaded afresh
+  //
+  if ( -1 == (pid_i = fork()) ) {
+    fprintf(stderr, "pack: fork: %s\r\n", strerror(errno));
+    _pack_pier(dir_c);
+    return 0;
+  }
+  else if ( !pid_i ) {
+    _pack_save(dir_c);
+  }
+
+  if (  (-1 == waitpid(pid_i, &sat_i, 0))
+     || !WIFEXITED(sat_i)
+     || WEXITSTATUS(sat_i) )
+  {
+    fprintf(stderr, "pack: save failed\r\n");
+    _pack_pier(dir_c);
+    return 0;
+  }
+
+  u3m_boot(dir_c, (size_t)1 << 28);
+
+  {
+    u3_noun lis = u3A->roc;
+
+    while ( u3_nul != lis ) {
+      if (  (1 != u3a_botox(u3a_to_ptr(lis))->use_w)
+         || (1 != u3a_botox(u3a_to_ptr(u3h(lis)))->use_w) )
+      {
+        bad_w++;
+      }
+
+      len_w++;
+      lis = u3t(lis);
+    }
+  }
+
+  if ( _PACK_LIV != len_w ) {
+    fprintf(stderr, "pack: kernel length %u\r\n", len_w);
+    ret_i = 0;
+  }
+
+  if ( bad_w ) {
+    fprintf(stderr, "pack: %u cells with extra references\r\n", bad_w);
+    ret_i = 0;
+  }
+
+  u3m_stop();
+  _pack_pier(dir_c);
+
+  return ret_i;
+}
+
+/* main(): run all test cases.
+*/
+int
+main(int argc, char* argv[])
+{
+  if ( !_test_save_mid_cycle() ) {
+    fprintf(stderr, "test pack: save mid-cycle: failed\r\n");
+    exit(1);
+  }
+
+  fprintf(stderr, "test pack: ok\r\n");
+  return 0;
+}
@@ -1112,6 +1112,32 @@ u3r_bytes(c3_w    a_w,
   }
 }
 
+/* u3r_bytes_lend():
+**
+**  Produce bytes 0 through (len_w - 1) of (*a), pointing into (*a)
+**  when it has that many. Otherwise, copy them into an allocation,
+**  also produced in (fre_y) for u3a_free(); else (fre_y) is null.
+**
+**  NB: the bytes must not be modified, nor (*a) freed, while in use.
+*/
+const c3_y*
+u3r_bytes_lend(c3_w     len_w,
+               u3_atom* a,
+               c3_y**   fre_y)
+{
+  c3_w        wor_w;
+  const c3_w* buf_w = u3r_word_buf(a, &wor_w);
+
+  if ( len_w <= ((c3_d)wor_w << 2) ) {
+    *fre_y = 0;
+    return (const c3_y*)buf_w;
+  }
+  else {
+    *fre_y = u3r_bytes_alloc(0, len_w, *a);
+    return *fre_y;
+  }
+}
+
 /* u3r_bytes_fit():
 **
 **  Copy (len_w) bytes of (a) into (buf_y) if it fits, returning overage
@@ -1312,6 +1338,29 @@ u3r_words(c3_w    a_w,
   }
 }
 
+/* u3r_word_buf():
+**
+**   Produce the words of atom (*a), and their number in (len_w).
+**   NB: points into (a) itself if direct.
+*/
+const c3_w*
+u3r_word_buf(u3_atom* a, c3_w* len_w)
+{
+  u3_assert(u3_none != *a);
+  u3_assert(_(u3a_is_atom(*a)));
+
+  if ( _(u3a_is_cat(*a)) ) {
+    *len_w = ( *a ) ? 1 : 0;
+    return a;
+  }
+  else {
+    u3a_atom* a_u = u3a_to_ptr(*a);
+
+    *len_w = a_u->len_w;
+    return a_u->buf_w;
+  }
+}
+
 /* u3r_chubs():
 **
 **  Copy double-words (a_w) through (a_w + b_w - 1) from (d) to (c).
@@ -1372,6 +1421,85 @@ u3r_safe_chub(u3_noun dat, c3_d* out_d)
   return c3y;
 }
 
+//  word-parallel kernels
+//
+//    the bitwise jets spend their time in these loops over the word
+//    buffers of multi-megabyte atoms. they are written with generic
+//    vectors, which the compiler lowers to SSE2 on x86_64 and NEON on
+//    aarch64 (both baseline, so there is nothing to dispatch at
+//    runtime), and to word operations elsewhere. buffers are loaded
+//    and stored unaligned, through memcpy.
+//
+typedef c3_w _cr_vec __attribute__((vector_size(16)));
+
+#define _CR_VEC_W  (sizeof(_cr_vec) / sizeof(c3_w))
+
+/* u3r_mix_words(): XOR [len_w] words of [src_w] into [dst_w].
+*/
+void
+u3r_mix_words(c3_w           len_w,
+              c3_w* restrict dst_w,
+        const c3_w* restrict src_w)
+{
+  size_t  i_i = 0;
+  _cr_vec dst_v, src_v;
+
+  for ( ; (i_i + _CR_VEC_W) <= len_w; i_i += _CR_VEC_W ) {
+    memcpy(&dst_v, dst_w + i_i, sizeof(dst_v));
+    memcpy(&src_v, src_w + i_i, sizeof(src_v));
+    dst_v ^= src_v;
+    memcpy(dst_w + i_i, &dst_v, sizeof(dst_v));
+  }
+
+  for ( ; i_i < len_w; i_i++ ) {
+    dst_w[i_i] ^= src_w[i_i];
+  }
+}
+
+/* u3r_con_words(): OR [len_w] words of [src_w] into [dst_w].
+*/
+void
+u3r_con_words(c3_w           len_w,
+              c3_w* restrict dst_w,
+        const c3_w* restrict src_w)
+{
+  size_t  i_i = 0;
+  _cr_vec dst_v, src_v;
+
+  for ( ; (i_i + _CR_VEC_W) <= len_w; i_i += _CR_VEC_W ) {
+    memcpy(&dst_v, dst_w + i_i, sizeof(dst_v));
+    memcpy(&src_v, src_w + i_i, sizeof(src_v));
+    dst_v |= src_v;
+    memcpy(dst_w + i_i, &dst_v, sizeof(dst_v));
+  }
+
+  for ( ; i_i < len_w; i_i++ ) {
+    dst_w[i_i] |= src_w[i_i];
+  }
+}
+
+/* u3r_dis_words(): AND [len_w] words of [src_w] into [dst_w].
+*/
+void
+u3r_dis_words(c3_w           len_w,
+              c3_w* restrict dst_w,
+        const c3_w* restrict src_w)
+{
+  size_t  i_i = 0;
+  _cr_vec dst_v, src_v;
+
+  for ( ; (i_i + _CR_VEC_W) <= len_w; i_i += _CR_VEC_W ) {
+    memcpy(&dst_v, dst_w + i_i, sizeof(dst_v));
+    memcpy(&src_v, src_w + i_i, sizeof(src_v));
+    dst_v &= src_v;
+    memcpy(dst_w + i_i, &dst_v, sizeof(dst_v));
+  }
+
+  for ( ; i_i < len_w; i_i++ ) {
+    dst_w[i_i] &= src_w[i_i];
+  }
+}
+
 /* u3r_chop_bits():
 **
 **   XOR `wid_d` bits from`src_w` at `bif_g` to `dst_w` at `bif_g`
@@ -1413,9 +1541,7 @@ u3r_chop_bits(c3_g  bif_g,
       size_t i_i, byt_i = wid_d >> 5;
 
       if ( !bif_g ) {
-        for ( i_i = 0; i_i < byt_i; i_i++ ) {
-          dst_w[i_i] ^= src_w[i_i];
-        }
+        u3r_mix_words(byt_i, dst_w, src_w);
       }
       else {
         for ( i_i = 0; i_i < byt_i; i_i++ ) {
@@ -1463,7 +1589,7 @@ u3r_chop_words(c3_g  met_g,
   //  operate on words
   //
   if ( met_g >= 5 ) {
-    size_t i_i, wid_i;
+    size_t wid_i;
 
     {
       c3_g   hut_g = met_g - 5;
@@ -1493,9 +1619,7 @@ u3r_chop_words(c3_g  met_g,
       dst_w += tou_i;
     }
 
-    for ( i_i = 0; i_i < wid_i; i_i++ ) {
-      dst_w[i_i] ^= src_w[i_i];
-    }
+    u3r_mix_words(wid_i, dst_w, src_w);
   }
   //  operate on bits
   //
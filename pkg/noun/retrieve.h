@@ -368,6 +368,19 @@
                   c3_y*   c_y,
                   u3_atom d);
 
+      /* u3r_bytes_lend():
+      **
+      **  Produce bytes 0 through (len_w - 1) of (*a), pointing into (*a)
+      **  when it has that many. Otherwise, copy them into an allocation,
+      **  also produced in (fre_y) for u3a_free(); else (fre_y) is null.
+      **
+      **  NB: the bytes must not be modified, nor (*a) freed, while in use.
+      */
+        const c3_y*
+        u3r_bytes_lend(c3_w     len_w,
+                       u3_atom* a,
+                       c3_y**   fre_y);
+
       /* u3r_bytes_fit():
       **
       **   Copy (len_w) bytes of (a) into (buf_y) if it fits, returning overage.
@@ -395,6 +408,33 @@
         u3r_bytes_all(c3_w*   len_w,
                       u3_atom a);
 
+      /* u3r_mix_words():
+      **
+      **   XOR (len_w) words of (src_w) into (dst_w).
+      */
+        void
+        u3r_mix_words(c3_w           len_w,
+                      c3_w* restrict dst_w,
+                const c3_w* restrict src_w);
+
+      /* u3r_con_words():
+      **
+      **   OR (len_w) words of (src_w) into (dst_w).
+      */
+        void
+        u3r_con_words(c3_w           len_w,
+                      c3_w* restrict dst_w,
+                const c3_w* restrict src_w);
+
+      /* u3r_dis_words():
+      **
+      **   AND (len_w) words of (src_w) into (dst_w).
+      */
+        void
+        u3r_dis_words(c3_w           len_w,
+                      c3_w* restrict dst_w,
+                const c3_w* restrict src_w);
+
       /* u3r_chop_bits():
       **
       **   XOR `wid_d` bits from`src_w` at `bif_g` to `dst_w` at `bif_g`
@@ -492,6 +532,15 @@
                   c3_w*   c_w,
                   u3_atom d);
 
+      /* u3r_word_buf():
+      **
+      **   Produce the words of atom (*a), and their number in (len_w).
+      **   NB: points into (a) itself if direct.
+      */
+        const c3_w*
+        u3r_word_buf(u3_atom* a,
+                     c3_w*    len_w);
+
       /* u3r_chubs():
       **
       **  Copy double-words (a_w) through (a_w + b_w - 1) from (d) to (c).
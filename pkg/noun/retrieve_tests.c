@@ -225,6 +225,66 @@ _test_mug(void)
   return ret_i;
 }
 
+/* _test_lend(): u3r_bytes_lend borrows when it can, and copies when not.
+*/
+static c3_i
+_test_lend(void)
+{
+  c3_i ret_i = 1;
+
+  {
+    u3_atom     a = u3i_string("Hello, world!");
+    c3_y*       fre_y;
+    const c3_y* byt_y = u3r_bytes_lend(13, &a, &fre_y);
+
+    if (  fre_y
+       || (byt_y != (c3_y*)((u3a_atom*)u3a_to_ptr(a))->buf_w)
+       || memcmp(byt_y, "Hello, world!", 13) )
+    {
+      fprintf(stderr, "lend fail (a)\r\n");
+      ret_i = 0;
+    }
+
+    //  past the end of the atom, zero-padded
+    //
+    byt_y = u3r_bytes_lend(20, &a, &fre_y);
+
+    if (  !fre_y
+       || (byt_y != fre_y)
+       || memcmp(byt_y, "Hello, world!\0\0\0\0\0\0\0", 20) )
+    {
+      fprintf(stderr, "lend fail (b)\r\n");
+      ret_i = 0;
+    }
+
+    if ( fre_y ) {
+      u3a_free(fre_y);
+    }
+
+    u3z(a);
+  }
+
+  {
+    u3_atom     a = 0x636261;
+    c3_y*       fre_y;
+    const c3_y* byt_y = u3r_bytes_lend(3, &a, &fre_y);
+
+    if ( fre_y || memcmp(byt_y, "abc", 3) ) {
+      fprintf(stderr, "lend fail (c)\r\n");
+      ret_i = 0;
+    }
+
+    byt_y = u3r_bytes_lend(0, &a, &fre_y);
+
+    if ( fre_y ) {
+      fprintf(stderr, "lend fail (d)\r\n");
+      ret_i = 0;
+    }
+  }
+
+  return ret_i;
+}
+
 /* main(): run all test cases.
 */
 int
@@ -237,6 +297,11 @@ main(int argc, char* argv[])
     exit(1);
   }
 
+  if ( !_test_lend() ) {
+    fprintf(stderr, "test_lend: failed\r\n");
+    exit(1);
+  }
+
   //  GC
   //
   u3m_grab(u3_none);
@@ -28,7 +28,7 @@ const c3_y u3s_dit_y[64] = {
 */
 struct _cs_jam_fib {
   u3i_slab*     sab_u;
-  u3p(u3h_root) har_p;
+  u3p(u3h_wide) har_p;
   c3_w          a_w;
   c3_w          b_w;
   c3_w          bit_w;
@@ -141,12 +141,12 @@ static void
 _cs_jam_fib_atom_cb(u3_atom a, void* ptr_v)
 {
   struct _cs_jam_fib* fib_u = ptr_v;
-  u3_weak b = u3h_git(fib_u->har_p, a);
+  u3_weak b = u3h_wide_git(fib_u->har_p, a);
 
   //  if [a] has no backref, encode atom and put cursor into [har_p]
   //
   if ( u3_none == b ) {
-    u3h_put(fib_u->har_p, a, u3i_words(1, &(fib_u->bit_w)));
+    u3h_wide_put(fib_u->har_p, a, u3i_words(1, &(fib_u->bit_w)));
     _cs_jam_fib_chop(fib_u, 1, 0);
     _cs_jam_fib_mat(fib_u, a);
   }
@@ -175,12 +175,12 @@ static c3_o
 _cs_jam_fib_cell_cb(u3_noun a, void* ptr_v)
 {
   struct _cs_jam_fib* fib_u = ptr_v;
-  u3_weak b = u3h_git(fib_u->har_p, a);
+  u3_weak b = u3h_wide_git(fib_u->har_p, a);
 
   //  if [a] has no backref, encode cell and put cursor into [har_p]
   //
   if ( u3_none == b ) {
-    u3h_put(fib_u->har_p, a, u3i_words(1, &(fib_u->bit_w)));
+    u3h_wide_put(fib_u->har_p, a, u3i_words(1, &(fib_u->bit_w)));
     _cs_jam_fib_chop(fib_u, 2, 1);
     return c3y;
   }
@@ -202,7 +202,7 @@ c3_w
 u3s_jam_fib(u3i_slab* sab_u, u3_noun a)
 {
   struct _cs_jam_fib fib_u;
-  fib_u.har_p = u3h_new();
+  fib_u.har_p = u3h_wide_new();
   fib_u.sab_u = sab_u;
 
   //  fib(12) is small enough to be reasonably fast to allocate.
@@ -216,12 +216,12 @@ u3s_jam_fib(u3i_slab* sab_u, u3_noun a)
 
   u3a_walk_fore(a, &fib_u, _cs_jam_fib_atom_cb, _cs_jam_fib_cell_cb);
 
-  u3h_free(fib_u.har_p);
+  u3h_wide_free(fib_u.har_p);
   return fib_u.bit_w;
 }
 
 typedef struct _jam_xeno_s {
-  u3p(u3h_root) har_p;
+  u3p(u3h_wide) har_p;
   ur_bsw_t      rit_u;
 } _jam_xeno_t;
 
@@ -274,11 +274,11 @@ _cs_jam_xeno_atom(u3_atom a, void* ptr_v)
 {
   _jam_xeno_t* jam_u = ptr_v;
   ur_bsw_t*    rit_u = &(jam_u->rit_u);
-  u3_weak        bak = u3h_git(jam_u->har_p, a);
+  u3_weak        bak = u3h_wide_git(jam_u->har_p, a);
   c3_w         met_w = u3r_met(0, a);
 
   if ( u3_none == bak ) {
-    u3h_put(jam_u->har_p, a, _cs_coin_chub(rit_u->bits));
+    u3h_wide_put(jam_u->har_p, a, _cs_coin_chub(rit_u->bits));
     _cs_jam_bsw_atom(rit_u, met_w, a);
   }
   else {
@@ -300,10 +300,10 @@ _cs_jam_xeno_cell(u3_noun a, void* ptr_v)
 {
   _jam_xeno_t* jam_u = ptr_v;
   ur_bsw_t*    rit_u = &(jam_u->rit_u);
-  u3_weak        bak = u3h_git(jam_u->har_p, a);
+  u3_weak        bak = u3h_wide_git(jam_u->har_p, a);
 
   if ( u3_none == bak ) {
-    u3h_put(jam_u->har_p, a, _cs_coin_chub(rit_u->bits));
+    u3h_wide_put(jam_u->har_p, a, _cs_coin_chub(rit_u->bits));
     ur_bsw_cell(rit_u);
     return c3y;
   }
@@ -320,14 +320,169 @@ u3s_jam_xeno(u3_noun a, c3_d* len_d, c3_y** byt_y)
 {
   _jam_xeno_t jam_u = {0};
   ur_bsw_init(&jam_u.rit_u, ur_fib11, ur_fib12);
-  jam_u.har_p = u3h_new();
+  jam_u.har_p = u3h_wide_new();
 
   u3a_walk_fore(a, &jam_u, _cs_jam_xeno_atom, _cs_jam_xeno_cell);
 
-  u3h_free(jam_u.har_p);
+  u3h_wide_free(jam_u.har_p);
   return ur_bsw_done(&jam_u.rit_u, len_d, byt_y);
 }
 
+/* _jam_twin_t: state for jamming a noun and (again) its tail.
+**
+**   the tail is traversed once, with a single dictionary mapping each
+**   subnoun to its offset in both streams.
+*/
+typedef struct _jam_twin_s {
+  u3p(u3h_wide) har_p;                  //  noun to index into [pos_d]
+  ur_bsw_t      rit_u[2];               //  [0]: whole, [1]: tail
+  c3_d          bas_d;                  //  tail stream start (pad bits)
+  c3_d*         pos_d;                  //  offset pairs
+  c3_w          len_w;                  //  pairs used
+  c3_w          siz_w;                  //  pairs allocated
+} _jam_twin_t;
+
+/* _cs_jam_twin_pre_atom(): encode atom of the prefix (no dictionary).
+*/
+static void
+_cs_jam_twin_pre_atom(u3_atom a, void* ptr_v)
+{
+  _jam_twin_t* jam_u = ptr_v;
+  _cs_jam_bsw_atom(&(jam_u->rit_u[0]), u3r_met(0, a), a);
+}
+
+/* _cs_jam_twin_pre_cell(): encode cell of the prefix (no dictionary).
+*/
+static c3_o
+_cs_jam_twin_pre_cell(u3_noun a, void* ptr_v)
+{
+  _jam_twin_t* jam_u = ptr_v;
+  ur_bsw_cell(&(jam_u->rit_u[0]));
+  return c3y;
+}
+
+/* _cs_jam_twin_save(): save stream offsets of [a].
+*/
+static void
+_cs_jam_twin_save(_jam_twin_t* jam_u, u3_noun a)
+{
+  if ( jam_u->len_w == jam_u->siz_w ) {
+    jam_u->siz_w = c3_max(64, 2 * jam_u->siz_w);
+    jam_u->pos_d = c3_realloc(jam_u->pos_d,
+                              2 * sizeof(c3_d) * jam_u->siz_w);
+  }
+
+  jam_u->pos_d[2 * jam_u->len_w]     = jam_u->rit_u[0].bits;
+  jam_u->pos_d[2 * jam_u->len_w + 1] = jam_u->rit_u[1].bits - jam_u->bas_d;
+  u3h_wide_put(jam_u->har_p, a, jam_u->len_w++);
+}
+
+/* _cs_jam_twin_atom(): encode atom or backref in both bitstreams.
+*/
+static void
+_cs_jam_twin_atom(u3_atom a, void* ptr_v)
+{
+  _jam_twin_t* jam_u = ptr_v;
+  u3_weak        idx = u3h_wide_git(jam_u->har_p, a);
+  c3_w         met_w = u3r_met(0, a);
+  c3_w           i_w;
+
+  if ( u3_none == idx ) {
+    _cs_jam_twin_save(jam_u, a);
+  }
+
+  for ( i_w = 0; i_w < 2; i_w++ ) {
+    ur_bsw_t* rit_u = &(jam_u->rit_u[i_w]);
+
+    if ( u3_none == idx ) {
+      _cs_jam_bsw_atom(rit_u, met_w, a);
+    }
+    else {
+      c3_d bak_d = jam_u->pos_d[2 * idx + i_w];
+      c3_y bak_y = ur_met0_64(bak_d);
+
+      if ( met_w <= bak_y ) {
+        _cs_jam_bsw_atom(rit_u, met_w, a);
+      }
+      else {
+        ur_bsw_back64(rit_u, bak_y, bak_d);
+      }
+    }
+  }
+}
+
+/* _cs_jam_twin_cell(): encode cell or backref in both bitstreams.
+*/
+static c3_o
+_cs_jam_twin_cell(u3_noun a, void* ptr_v)
+{
+  _jam_twin_t* jam_u = ptr_v;
+  u3_weak        idx = u3h_wide_git(jam_u->har_p, a);
+  c3_w           i_w;
+
+  if ( u3_none == idx ) {
+    _cs_jam_twin_save(jam_u, a);
+    ur_bsw_cell(&(jam_u->rit_u[0]));
+    ur_bsw_cell(&(jam_u->rit_u[1]));
+    return c3y;
+  }
+
+  for ( i_w = 0; i_w < 2; i_w++ ) {
+    c3_d bak_d = jam_u->pos_d[2 * idx + i_w];
+    ur_bsw_back64(&(jam_u->rit_u[i_w]), ur_met0_64(bak_d), bak_d);
+  }
+
+  return c3n;
+}
+
+/* u3s_jam_xeno_twin(): jam [a], and its [dep_w]th tail after [pad_w]
+**                      zero bytes, traversing the tail once.
+*/
+c3_d
+u3s_jam_xeno_twin(u3_noun a,
+                  c3_w  dep_w,
+                  c3_w  pad_w,
+                  c3_d* len_d,
+                  c3_y** byt_y,
+                  c3_d* tal_d,
+                  c3_y** tab_y)
+{
+  _jam_twin_t jam_u = {0};
+  c3_w          i_w;
+  c3_d        bit_d;
+
+  ur_bsw_init(&jam_u.rit_u[0], ur_fib11, ur_fib12);
+  ur_bsw_init(&jam_u.rit_u[1], ur_fib11, ur_fib12);
+  jam_u.har_p = u3h_wide_new();
+
+  for ( i_w = 0; i_w < pad_w; i_w++ ) {
+    ur_bsw8(&jam_u.rit_u[1], 8, 0);
+  }
+
+  jam_u.bas_d = jam_u.rit_u[1].bits;
+
+  //  the prefix is written without a dictionary, so that the tail
+  //  never refers back into it
+  //
+  for ( i_w = 0; i_w < dep_w; i_w++ ) {
+    u3_assert( c3y == u3a_is_cell(a) );
+    ur_bsw_cell(&jam_u.rit_u[0]);
+    u3a_walk_fore(u3h(a), &jam_u, _cs_jam_twin_pre_atom,
+                                  _cs_jam_twin_pre_cell);
+    a = u3t(a);
+  }
+
+  u3a_walk_fore(a, &jam_u, _cs_jam_twin_atom, _cs_jam_twin_cell);
+
+  u3h_wide_free(jam_u.har_p);
+  c3_free(jam_u.pos_d);
+
+  ur_bsw_done(&jam_u.rit_u[1], tal_d, tab_y);
+  bit_d = ur_bsw_done(&jam_u.rit_u[0], len_d, byt_y);
+
+  return bit_d;
+}
+
 /* _cs_cue: stack frame for tracking intermediate cell results
 */
 typedef struct _cs_cue {
@@ -351,7 +506,7 @@ _cs_rub(u3_atom cur, u3_atom a)
 */
 static inline u3_noun
 _cs_cue_next(u3a_pile*     pil_u,
-             u3p(u3h_root) har_p,
+             u3p(u3h_wide) har_p,
              u3_atom         cur,
              u3_atom           a,
              u3_atom*        wid)
@@ -369,7 +524,7 @@ _cs_cue_next(u3a_pile*     pil_u,
       u3_noun bur = _cs_rub(u3i_vint(cur), a);
       u3_noun pro = u3k(u3t(bur));
 
-      u3h_put(har_p, cur, u3k(pro));
+      u3h_wide_put(har_p, cur, u3k(pro));
       *wid = u3qa_inc(u3h(bur));
 
       u3z(bur);
@@ -390,7 +545,7 @@ _cs_cue_next(u3a_pile*     pil_u,
       //
       if ( 1 == tag_y ) {
         u3_noun bur = _cs_rub(u3ka_add(2, cur), a);
-        u3_noun pro = u3x_good(u3h_get(har_p, u3t(bur)));
+        u3_noun pro = u3x_good(u3h_wide_get(har_p, u3t(bur)));
 
         *wid = u3qa_add(2, u3h(bur));
 
@@ -428,7 +583,7 @@ u3s_cue(u3_atom a)
   u3_noun         pro;
   u3_atom         wid;
   _cs_cue*      fam_u;
-  u3p(u3h_root) har_p = u3h_new();
+  u3p(u3h_wide) har_p = u3h_wide_new();
   u3a_pile      pil_u;
 
   //  initialize stack control
@@ -465,7 +620,7 @@ u3s_cue(u3_atom a)
       //
       else {
         pro   = u3nc(fam_u->hed, pro);
-        u3h_put(har_p, fam_u->cur, u3k(pro));
+        u3h_wide_put(har_p, fam_u->cur, u3k(pro));
         u3z(fam_u->cur);
         wid   = u3ka_add(2, u3ka_add(wid, fam_u->wid));
         fam_u = u3a_pop(&pil_u);
@@ -474,7 +629,7 @@ u3s_cue(u3_atom a)
   }
 
   u3z(wid);
-  u3h_free(har_p);
+  u3h_wide_free(har_p);
 
   return pro;
 }
@@ -490,12 +645,28 @@ typedef struct _cue_frame_s {
   c3_d  bit_d;
 } _cue_frame_t;
 
+/* _cs_cue_xeno_keep(): save [ref] at [bit_d], if it may be referenced.
+*/
+static inline void
+_cs_cue_xeno_keep(ur_dict32_t* dic_u,
+                  ur_dict_t*   bak_u,
+                  c3_d         bit_d,
+                  u3_noun      ref)
+{
+  ur_root_t* rot_u = 0;
+
+  if ( !bak_u || ur_dict_get(rot_u, bak_u, bit_d) ) {
+    ur_dict32_put(rot_u, dic_u, bit_d, ref);
+  }
+}
+
 /* _cs_cue_xeno_next(): read next value from bitstream, dictionary off-loom.
 */
 static inline ur_cue_res_e
 _cs_cue_xeno_next(u3a_pile*    pil_u,
                   ur_bsr_t*    red_u,
                   ur_dict32_t* dic_u,
+                  ur_dict_t*   bak_u,
                   u3_noun*       out)
 {
   ur_root_t* rot_u = 0;
@@ -562,7 +733,7 @@ _cs_cue_xeno_next(u3a_pile*    pil_u,
           }
         }
 
-        ur_dict32_put(rot_u, dic_u, bit_d, *out);
+        _cs_cue_xeno_keep(dic_u, bak_u, bit_d, *out);
         return ur_cue_good;
       }
     }
@@ -570,7 +741,8 @@ _cs_cue_xeno_next(u3a_pile*    pil_u,
 }
 
 struct _u3_cue_xeno {
-  ur_dict32_t dic_u;
+  ur_dict32_t dic_u;                    //  backreference targets, by offset
+  ur_dict_t*  bak_u;                    //  offsets to keep, or all if 0
 };
 
 /* _cs_cue_xeno(): cue on-loom, with off-loom dictionary in handle.
@@ -582,6 +754,7 @@ _cs_cue_xeno(u3_cue_xeno* sil_u,
 {
   ur_bsr_t      red_u = {0};
   ur_dict32_t*  dic_u = &sil_u->dic_u;
+  ur_dict_t*    bak_u = sil_u->bak_u;
   u3a_pile      pil_u;
   _cue_frame_t* fam_u;
   ur_cue_res_e  res_e;
@@ -604,7 +777,7 @@ _cs_cue_xeno(u3_cue_xeno* sil_u,
 
   //  advance into stream
   //
-  res_e = _cs_cue_xeno_next(&pil_u, &red_u, dic_u, &ref);
+  res_e = _cs_cue_xeno_next(&pil_u, &red_u, dic_u, bak_u, &ref);
 
   //  process cell results
   //
@@ -618,16 +791,14 @@ _cs_cue_xeno(u3_cue_xeno* sil_u,
       //
       if ( u3_none == fam_u->ref ) {
         fam_u->ref = ref;
-        res_e = _cs_cue_xeno_next(&pil_u, &red_u, dic_u, &ref);
+        res_e = _cs_cue_xeno_next(&pil_u, &red_u, dic_u, bak_u, &ref);
         fam_u = u3a_peek(&pil_u);
       }
       //  f is a tail-frame; pop the stack and continue
       //
       else {
-        ur_root_t* rot_u = 0;
-
         ref   = u3nc(fam_u->ref, ref);
-        ur_dict32_put(rot_u, dic_u, fam_u->bit_d, ref);
+        _cs_cue_xeno_keep(dic_u, bak_u, fam_u->bit_d, ref);
         fam_u = u3a_pop(&pil_u);
       }
     }
@@ -716,6 +887,44 @@ u3s_cue_xeno(c3_d        len_d,
   return som;
 }
 
+/* u3s_cue_xeno_lean(): cue on-loom, with off-loom dictionary,
+**                      keeping only the targets of backreferences.
+**
+**   a prior scan of [byt_y] finds those targets, so that the
+**   dictionary is sized by the sharing in the input, not its length.
+*/
+u3_weak
+u3s_cue_xeno_lean(c3_d        len_d,
+                  const c3_y* byt_y)
+{
+  ur_dict_t    bak_u = {0};
+  u3_cue_xeno* sil_u;
+  u3_weak        som;
+  c3_d         num_d, pre_d = ur_fib10, siz_d = ur_fib11;
+
+  u3_assert( &(u3H->rod_u) == u3R );
+
+  ur_dict_grow((ur_root_t*)0, &bak_u, ur_fib10, ur_fib11);
+
+  if ( ur_cue_good != ur_cue_scan(len_d, byt_y, &bak_u, &num_d) ) {
+    ur_dict_free(&bak_u);
+    return u3_none;
+  }
+
+  while ( siz_d < num_d ) {
+    c3_d nex_d = pre_d + siz_d;
+    pre_d = siz_d;
+    siz_d = nex_d;
+  }
+
+  sil_u = u3s_cue_xeno_init_with(pre_d, siz_d);
+  sil_u->bak_u = &bak_u;
+  som   = _cs_cue_xeno(sil_u, len_d, byt_y);
+  u3s_cue_xeno_done(sil_u);
+  ur_dict_free(&bak_u);
+  return som;
+}
+
 /* _cs_cue_need(): bail on ur_cue_* read failures.
 */
 static inline void
@@ -730,24 +939,24 @@ _cs_cue_need(ur_cue_res_e res_e)
   }
 }
 
-/* _cs_cue_get(): u3h_get wrapper handling allocation and refcounts.
+/* _cs_cue_get(): u3h_wide_get wrapper handling allocation and refcounts.
 */
 static inline u3_weak
-_cs_cue_get(u3p(u3h_root) har_p, c3_d key_d)
+_cs_cue_get(u3p(u3h_wide) har_p, c3_d key_d)
 {
   u3_atom key = _cs_coin_chub(key_d);
-  u3_weak pro = u3h_get(har_p, key);
+  u3_weak pro = u3h_wide_get(har_p, key);
   u3z(key);
   return pro;
 }
 
-/* _cs_cue_put(): u3h_put wrapper handling allocation and refcounts.
+/* _cs_cue_put(): u3h_wide_put wrapper handling allocation and refcounts.
 */
 static inline u3_noun
-_cs_cue_put(u3p(u3h_root) har_p, c3_d key_d, u3_noun val)
+_cs_cue_put(u3p(u3h_wide) har_p, c3_d key_d, u3_noun val)
 {
   u3_atom key = _cs_coin_chub(key_d);
-  u3h_put(har_p, key, u3k(val));
+  u3h_wide_put(har_p, key, u3k(val));
   u3z(key);
   return val;
 }
@@ -756,7 +965,7 @@ _cs_cue_put(u3p(u3h_root) har_p, c3_d key_d, u3_noun val)
 */
 static inline u3_noun
 _cs_cue_bytes_next(u3a_pile*     pil_u,
-                   u3p(u3h_root) har_p,
+                   u3p(u3h_wide) har_p,
                    ur_bsr_t*     red_u)
 {
   while ( 1 ) {
@@ -819,7 +1028,7 @@ u3s_cue_bytes(c3_d len_d, const c3_y* byt_y)
   ur_bsr_t      red_u = {0};
   u3a_pile      pil_u;
   _cue_frame_t* fam_u;
-  u3p(u3h_root) har_p;
+  u3p(u3h_wide) har_p;
   u3_noun         ref;
 
   //  initialize stack control
@@ -828,7 +1037,7 @@ u3s_cue_bytes(c3_d len_d, const c3_y* byt_y)
 
   //  initialize a hash table for dereferencing backrefs
   //
-  har_p = u3h_new();
+  har_p = u3h_wide_new();
 
   //  init bitstream-reader
   //
@@ -868,7 +1077,7 @@ u3s_cue_bytes(c3_d len_d, const c3_y* byt_y)
     while ( c3n == u3a_pile_done(&pil_u) );
   }
 
-  u3h_free(har_p);
+  u3h_wide_free(har_p);
 
   return ref;
 }
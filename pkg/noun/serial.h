@@ -34,6 +34,21 @@
         c3_d
         u3s_jam_xeno(u3_noun a, c3_d* len_d, c3_y** byt_y);
 
+      /* u3s_jam_xeno_twin(): jam [a], and its [dep_w]th tail after [pad_w]
+      **                      zero bytes, traversing the tail once.
+      **
+      **   the prefix is never referenced from the tail, and the tail
+      **   is jammed exactly as by u3s_jam_xeno().
+      */
+        c3_d
+        u3s_jam_xeno_twin(u3_noun a,
+                          c3_w  dep_w,
+                          c3_w  pad_w,
+                          c3_d* len_d,
+                          c3_y** byt_y,
+                          c3_d* tal_d,
+                          c3_y** tab_y);
+
       /* u3s_cue(): cue [a]
       */
         u3_noun
@@ -67,6 +82,13 @@
         u3s_cue_xeno(c3_d        len_d,
                      const c3_y* byt_y);
 
+      /* u3s_cue_xeno_lean(): cue on-loom, with off-loom dictionary,
+      **                      keeping only the targets of backreferences.
+      */
+        u3_weak
+        u3s_cue_xeno_lean(c3_d        len_d,
+                          const c3_y* byt_y);
+
       /* u3s_cue_bytes(): cue bytes onto the loom.
       */
         u3_noun
@@ -118,6 +118,23 @@ _test_cue_spec(const c3_c* cap_c,
     u3z(out);
   }
 
+  {
+    u3_noun out;
+
+    if ( u3_none == (out = u3s_cue_xeno_lean(len_w, byt_y)) ) {
+      fprintf(stderr, "\033[31mcue %s fail 5\033[0m\r\n", cap_c);
+      ret_i = 0;
+    }
+    else if ( c3n == u3r_sing(ref, out) ) {
+      fprintf(stderr, "\033[31mcue %s fail 6\033[0m\r\n", cap_c);
+      u3m_p("ref", ref);
+      u3m_p("out", out);
+      ret_i = 0;
+    }
+
+    u3z(out);
+  }
+
   return ret_i;
 }
 
@@ -243,6 +260,90 @@ _test_jam_roundtrip(void)
   return ret_i;
 }
 
+/* _test_jam_twin_spec(): jam [a] and its [dep_w]th tail together.
+*/
+static c3_i
+_test_jam_twin_spec(const c3_c* cap_c, u3_noun a, c3_w dep_w)
+{
+  c3_i    ret_i = 1;
+  c3_w    pad_w = 4, i_w;
+  u3_noun   tal = a;
+  c3_d    len_d, tal_d, exp_d;
+  c3_y   *byt_y, *tab_y, *exp_y;
+  u3_weak   out;
+
+  for ( i_w = 0; i_w < dep_w; i_w++ ) {
+    tal = u3t(tal);
+  }
+
+  u3s_jam_xeno_twin(a, dep_w, pad_w, &len_d, &byt_y, &tal_d, &tab_y);
+  u3s_jam_xeno(tal, &exp_d, &exp_y);
+
+  if ( u3_none == (out = u3s_cue_xeno(len_d, byt_y)) ) {
+    fprintf(stderr, "\033[31mjam twin %s fail 1\033[0m\r\n", cap_c);
+    ret_i = 0;
+  }
+  else if ( c3n == u3r_sing(a, out) ) {
+    fprintf(stderr, "\033[31mjam twin %s fail 2\033[0m\r\n", cap_c);
+    ret_i = 0;
+  }
+
+  u3z(out);
+
+  if ( tal_d != (pad_w + exp_d) ) {
+    fprintf(stderr, "\033[31mjam twin %s fail 3\033[0m\r\n", cap_c);
+    ret_i = 0;
+  }
+  else if (  tab_y[0] || tab_y[1] || tab_y[2] || tab_y[3]
+          || memcmp(tab_y + pad_w, exp_y, exp_d) )
+  {
+    fprintf(stderr, "\033[31mjam twin %s fail 4\033[0m\r\n", cap_c);
+    _byte_print(tal_d - pad_w, tab_y + pad_w, exp_d, exp_y);
+    ret_i = 0;
+  }
+
+  c3_free(byt_y);
+  c3_free(tab_y);
+  c3_free(exp_y);
+  u3z(a);
+
+  return ret_i;
+}
+
+static c3_i
+_test_jam_twin(void)
+{
+  c3_i ret_i = 1;
+
+  ret_i &= _test_jam_twin_spec("atom", u3nt(c3__work, 0, 42), 2);
+  ret_i &= _test_jam_twin_spec("shared", u3nt(c3__work, 0,
+                               u3nt(u3nc(1, 2), u3nc(1, 2), u3nc(1, 2))), 2);
+
+  //  atoms of the prefix, repeated in the tail
+  //
+  ret_i &= _test_jam_twin_spec("prefix", u3nt(c3__work, 12345,
+                               u3nq(12345, c3__work, 12345, c3__work)), 2);
+
+  {
+    u3_noun a = u3i_string("abcdefjhijklmnopqrstuvwxyz");
+    ret_i &= _test_jam_twin_spec("alpha", u3nt(u3nc(a, 1), u3k(a),
+                                 u3nq(u3k(a), 2, 3, u3k(a))), 2);
+  }
+
+  {
+    u3_noun lit = u3_nul;
+    c3_w    i_w;
+
+    for ( i_w = 0; i_w < 1000; i_w++ ) {
+      lit = u3nc(u3nc(i_w % 7, i_w), lit);
+    }
+
+    ret_i &= _test_jam_twin_spec("list", u3nc(c3__work, lit), 1);
+  }
+
+  return ret_i;
+}
+
 /* main(): run all test cases.
 */
 int
@@ -255,6 +356,11 @@ main(int argc, char* argv[])
     exit(1);
   }
 
+  if ( !_test_jam_twin() ) {
+    fprintf(stderr, "test jam twin: failed\r\n");
+    exit(1);
+  }
+
   //  GC
   //
   u3m_grab(u3_none);
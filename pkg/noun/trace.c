@@ -15,8 +15,10 @@
 #include "options.h"
 #include "retrieve.h"
 #include "vortex.h"
+#include "zave.h"
 
 u3t_trace u3t_Trace;
+u3t_site  u3t_Site;
 
 static c3_o _ct_lop_o;
 
@@ -482,6 +484,254 @@ u3t_print_steps(FILE* fil_u, c3_c* cap_c, c3_d sep_d)
   }
 }
 
+/* u3t_memo: counters for one %memo site, off-loom.
+*/
+typedef struct _u3t_memo {
+  c3_w  mug_w;                        //  formula mug
+  c3_w  cid_w;                        //  cache id
+  c3_d  hit_d;                        //  lookups found
+  c3_d  mis_d;                        //  lookups missed
+  c3_d  sav_d;                        //  products saved
+  c3_d  mic_d;                        //  µs spent computing saved misses
+  c3_d  wor_d;                        //  words retained by saves
+  c3_c* spo_c;                        //  innermost spot, at first sight
+} u3t_memo;
+
+/* _ct_memo: memo site table; records are append-only, so that
+**           an index can ride on the nock stack across a miss.
+*/
+static struct {
+  u3t_memo* sit_u;                    //  records
+  c3_w      len_w;                    //  records used
+  c3_w      cap_w;                    //  records allocated
+  c3_w*     dex_w;                    //  open-addressed index, 1-based
+  c3_w      dip_w;                    //  index size (power of 2)
+} _ct_memo;
+
+/* _ct_memo_spot(): render the innermost spot on the trace stack.
+*/
+static c3_c*
+_ct_memo_spot(void)
+{
+  u3_noun tax = u3R->bug.tax;
+  u3_noun pax, pin, beg, end, lin, col, lon, cul;
+
+  //  [%spot pax [[lin col] [lon cul]]]
+  //
+  while ( c3y == u3du(tax) ) {
+    u3_noun hed = u3h(tax);
+
+    if (  (c3y == u3du(hed))
+       && (c3__spot == u3h(hed))
+       && (c3y == u3r_cell(u3t(hed), &pax, &pin))
+       && (c3y == u3r_cell(pin, &beg, &end))
+       && (c3y == u3r_cell(beg, &lin, &col))
+       && (c3y == u3r_cell(end, &lon, &cul))
+       && (c3y == u3a_is_cat(lin)) && (c3y == u3a_is_cat(col))
+       && (c3y == u3a_is_cat(lon)) && (c3y == u3a_is_cat(cul)) )
+    {
+      c3_c buf_c[256];
+      c3_w len_w = 0;
+
+      while ( (c3y == u3du(pax)) && (len_w < 192) ) {
+        u3_noun nam = u3h(pax);
+        c3_w    met_w = u3r_met(3, nam);
+
+        if ( (c3n == u3ud(nam)) || ((len_w + 1 + met_w) >= 192) ) {
+          break;
+        }
+
+        buf_c[len_w++] = '/';
+        u3r_bytes(0, met_w, (c3_y*)buf_c + len_w, nam);
+        len_w += met_w;
+        pax = u3t(pax);
+      }
+
+      snprintf(buf_c + len_w, sizeof(buf_c) - len_w,
+               ":<[%u %u].[%u %u]>", lin, col, lon, cul);
+      return strdup(buf_c);
+    }
+
+    tax = u3t(tax);
+  }
+
+  return strdup("-");
+}
+
+/* _ct_memo_grow(): double the memo site index.
+*/
+static void
+_ct_memo_grow(void)
+{
+  c3_w  dip_w = _ct_memo.dip_w ? (_ct_memo.dip_w << 1) : 256;
+  c3_w* dex_w = c3_calloc(sizeof(c3_w) * dip_w);
+  c3_w  i_w;
+
+  for ( i_w = 0; i_w < _ct_memo.len_w; i_w++ ) {
+    u3t_memo* sit_u = &(_ct_memo.sit_u[i_w]);
+    c3_w      idx_w = (sit_u->mug_w ^ sit_u->cid_w) & (dip_w - 1);
+
+    while ( dex_w[idx_w] ) {
+      idx_w = (idx_w + 1) & (dip_w - 1);
+    }
+    dex_w[idx_w] = i_w + 1;
+  }
+
+  c3_free(_ct_memo.dex_w);
+  _ct_memo.dex_w = dex_w;
+  _ct_memo.dip_w = dip_w;
+}
+
+/* u3t_memo_look(): count a %memo lookup at [fol], producing its site.
+*/
+c3_w
+u3t_memo_look(u3_noun fol, c3_w cid_w, c3_o hit_o)
+{
+  c3_w      mug_w = u3r_mug(fol);
+  c3_w      idx_w, dex_w;
+  u3t_memo* sit_u;
+
+  if ( (_ct_memo.len_w + 1) * 2 > _ct_memo.dip_w ) {
+    _ct_memo_grow();
+  }
+
+  idx_w = (mug_w ^ cid_w) & (_ct_memo.dip_w - 1);
+
+  while ( (dex_w = _ct_memo.dex_w[idx_w]) ) {
+    sit_u = &(_ct_memo.sit_u[dex_w - 1]);
+
+    if ( (mug_w == sit_u->mug_w) && (cid_w == sit_u->cid_w) ) {
+      break;
+    }
+    idx_w = (idx_w + 1) & (_ct_memo.dip_w - 1);
+  }
+
+  if ( !dex_w ) {
+    if ( _ct_memo.len_w == _ct_memo.cap_w ) {
+      _ct_memo.cap_w = _ct_memo.cap_w ? (_ct_memo.cap_w << 1) : 64;
+      _ct_memo.sit_u = c3_realloc(_ct_memo.sit_u,
+                                  sizeof(u3t_memo) * _ct_memo.cap_w);
+    }
+
+    dex_w = ++_ct_memo.len_w;
+    _ct_memo.dex_w[idx_w] = dex_w;
+
+    sit_u  = &(_ct_memo.sit_u[dex_w - 1]);
+    *sit_u = (u3t_memo){ .mug_w = mug_w, .cid_w = cid_w };
+    sit_u->spo_c = _ct_memo_spot();
+  }
+
+  if ( c3y == hit_o ) {
+    sit_u->hit_d++;
+  }
+  else {
+    sit_u->mis_d++;
+  }
+
+  return dex_w - 1;
+}
+
+/* u3t_memo_save(): count a %memo product computed in [mic_d].
+*/
+void
+u3t_memo_save(c3_w sit_w, c3_d mic_d, c3_w wid_w)
+{
+  if ( sit_w < _ct_memo.len_w ) {
+    u3t_memo* sit_u = &(_ct_memo.sit_u[sit_w]);
+
+    sit_u->sav_d++;
+    sit_u->mic_d += mic_d;
+    sit_u->wor_d += wid_w;
+  }
+}
+
+/* _ct_memo_gain(): estimated µs saved by a site's hits.
+*/
+static c3_d
+_ct_memo_gain(u3t_memo* sit_u)
+{
+  return ( sit_u->sav_d ) ? (sit_u->hit_d * sit_u->mic_d) / sit_u->sav_d : 0;
+}
+
+/* _ct_memo_cmp(): order sites by estimated time saved, descending.
+*/
+static c3_i
+_ct_memo_cmp(const void* a_v, const void* b_v)
+{
+  c3_d a_d = _ct_memo_gain(&(_ct_memo.sit_u[*(c3_w*)a_v]));
+  c3_d b_d = _ct_memo_gain(&(_ct_memo.sit_u[*(c3_w*)b_v]));
+
+  return ( a_d < b_d ) ? 1 : ( a_d > b_d ) ? -1 : 0;
+}
+
+/* _ct_memo_sort(): site indices, by estimated time saved.
+*/
+static c3_w*
+_ct_memo_sort(void)
+{
+  c3_w* ord_w = c3_malloc(sizeof(c3_w) * (_ct_memo.len_w + 1));
+  c3_w  i_w;
+
+  for ( i_w = 0; i_w < _ct_memo.len_w; i_w++ ) {
+    ord_w[i_w] = i_w;
+  }
+
+  qsort(ord_w, _ct_memo.len_w, sizeof(c3_w), _ct_memo_cmp);
+  return ord_w;
+}
+
+/* _ct_memo_name(): describe a memo site.
+*/
+static c3_c*
+_ct_memo_name(u3t_memo* sit_u)
+{
+  c3_c nam_c[512];
+
+  snprintf(nam_c, sizeof(nam_c),
+           "%s %s %x: %" PRIu64 " hits, %" PRIu64 " misses, "
+           "%" PRIu64 " saves, ~%" PRIu64 " \xc2\xb5s saved",
+           ( u3z_memo_keep == sit_u->cid_w ) ? "keep" : "toss",
+           sit_u->spo_c, sit_u->mug_w,
+           sit_u->hit_d, sit_u->mis_d, sit_u->sav_d,
+           _ct_memo_gain(sit_u));
+
+  return strdup(nam_c);
+}
+
+/* _ct_memo_damp(): print and clear memo site counters.
+*/
+static void
+_ct_memo_damp(FILE* fil_u)
+{
+  c3_w* ord_w;
+  c3_w  i_w;
+
+  if ( !_ct_memo.len_w ) {
+    return;
+  }
+
+  ord_w = _ct_memo_sort();
+
+  fprintf(fil_u, "memo sites:\r\n");
+
+  for ( i_w = 0; i_w < _ct_memo.len_w; i_w++ ) {
+    u3t_memo* sit_u = &(_ct_memo.sit_u[ord_w[i_w]]);
+    c3_c*     nam_c = _ct_memo_name(sit_u);
+
+    fprintf(fil_u, "  %s, %" PRIu64 " words\r\n", nam_c, sit_u->wor_d);
+    c3_free(nam_c);
+  }
+
+  for ( i_w = 0; i_w < _ct_memo.len_w; i_w++ ) {
+    c3_free(_ct_memo.sit_u[i_w].spo_c);
+  }
+
+  c3_free(ord_w);
+  c3_free(_ct_memo.sit_u);
+  c3_free(_ct_memo.dex_w);
+  memset(&_ct_memo, 0, sizeof(_ct_memo));
+}
+
 /* u3t_damp(): print and clear profile data.
 */
 void
@@ -519,6 +769,14 @@ u3t_damp(FILE* fil_u)
 
   u3R->pro.nox_d = 0;
   u3R->pro.cel_d = 0;
+
+  u3t_print_steps(fil_u, "site spare hits", u3t_Site.hit_d);
+  u3t_print_steps(fil_u, "site misses", u3t_Site.mis_d);
+  u3t_print_steps(fil_u, "site evictions", u3t_Site.eve_d);
+
+  u3t_Site = (u3t_site){0};
+
+  _ct_memo_damp(fil_u);
 }
 
 /* _ct_sigaction(): profile sigaction callback.
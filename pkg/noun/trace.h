@@ -24,6 +24,14 @@
         c3_o euq_o;                 //  now executing in equal
       } u3t_trace;
 
+    /* u3t_site: call-site cache counters, see _cj_site_poly().
+    */
+      typedef struct _u3t_site {
+        c3_d hit_d;                 //  target found in spare entry
+        c3_d mis_d;                 //  target found in no entry
+        c3_d eve_d;                 //  spare entry evicted
+      } u3t_site;
+
   /**  Macros.
   **/
 #   ifdef U3_CPU_DEBUG
@@ -132,6 +140,18 @@
       void
       u3t_event_trace(const c3_c* name, c3_c type);
 
+    /* u3t_memo_look(): count a %memo lookup at [fol], producing its site.
+    **                  RETAIN.
+    */
+      c3_w
+      u3t_memo_look(u3_noun fol, c3_w cid_w, c3_o hit_o);
+
+    /* u3t_memo_save(): count a %memo product computed in [mic_d] µs,
+    **                  retaining [wid_w] words.
+    */
+      void
+      u3t_memo_save(c3_w sit_w, c3_d mic_d, c3_w wid_w);
+
     /* u3t_damp(): print and clear profile data.
     */
       void
@@ -183,5 +203,8 @@
       extern u3t_trace u3t_Trace;
 #     define u3T u3t_Trace
 
+      /// Call-site cache counters.
+      extern u3t_site u3t_Site;
+
 
 #endif /* ifndef U3_TRACE_H */
@@ -17,6 +17,7 @@
 #include "serial.h"
 #include "ur/ur.h"
 #include "vortex.h"
+#include "zave.h"
 
 /* _cu_atom_to_ref(): allocate indirect atom off-loom.
 */
@@ -363,6 +364,84 @@ _cu_all_to_loom(ur_root_t* rot_u, ur_nref ken, ur_nvec_t* cod_u)
   ur_dict_free((ur_dict_t*)&lom_u.map_u);
 }
 
+/* _cu_ref_to_noun_k(): lookup/allocate [ref] on the loom, producing.
+*/
+static inline u3_noun
+_cu_ref_to_noun_k(ur_nref ref, _cu_loom* lom_u)
+{
+  switch ( ur_nref_tag(ref) ) {
+    default: u3_assert(0);
+
+    case ur_iatom:  return u3k(lom_u->vat[ur_nref_idx(ref)]);
+    case ur_icell:  return u3k(lom_u->cel[ur_nref_idx(ref)]);
+
+    //  u3 direct atoms are 31-bit, while ur direct atoms are 62-bit
+    //
+    case ur_direct: {
+      return ( 0x7fffffffULL >= ref ) ? (u3_atom)ref : u3i_chub(ref);
+    }
+  }
+}
+
+/* u3u_from_ur(): copy [ref] from [rot_u] onto the loom, producing.
+**             NB: imports every noun in [rot_u]; intended for small
+**                 roots, such as the product of a single ur_cue().
+*/
+u3_noun
+u3u_from_ur(ur_root_t* rot_u, ur_nref ref)
+{
+  _cu_loom lom_u = {0};
+  c3_d     i_d, vat_d, cel_d;
+  u3_noun  pro;
+
+  //  allocate all indirect atoms on the loom.
+  //
+  {
+    c3_d*  len_d = rot_u->atoms.lens;
+    c3_y** byt_y = rot_u->atoms.bytes;
+
+    vat_d = rot_u->atoms.fill;
+    lom_u.vat = c3_malloc(c3_max(1, vat_d) * sizeof(u3_atom));
+
+    for ( i_d = 0; i_d < vat_d; i_d++ ) {
+      lom_u.vat[i_d] = u3i_bytes(len_d[i_d], byt_y[i_d]);
+    }
+  }
+
+  //  allocate all cells on the loom, in cons-order,
+  //  each retained once by the relocation table.
+  //
+  {
+    ur_nref* hed = rot_u->cells.heads;
+    ur_nref* tal = rot_u->cells.tails;
+
+    cel_d = rot_u->cells.fill;
+    lom_u.cel = c3_malloc(c3_max(1, cel_d) * sizeof(u3_noun));
+
+    for ( i_d = 0; i_d < cel_d; i_d++ ) {
+      lom_u.cel[i_d] = u3nc(_cu_ref_to_noun_k(hed[i_d], &lom_u),
+                            _cu_ref_to_noun_k(tal[i_d], &lom_u));
+    }
+  }
+
+  pro = _cu_ref_to_noun_k(ref, &lom_u);
+
+  //  release the relocation table's references
+  //
+  for ( i_d = 0; i_d < cel_d; i_d++ ) {
+    u3z(lom_u.cel[i_d]);
+  }
+
+  for ( i_d = 0; i_d < vat_d; i_d++ ) {
+    u3z(lom_u.vat[i_d]);
+  }
+
+  c3_free(lom_u.cel);
+  c3_free(lom_u.vat);
+
+  return pro;
+}
+
 /* _cu_realloc(): hash-cons roots off-loom, reallocate on loom.
 */
 static ur_nref
@@ -549,8 +628,7 @@ u3u_melt(void)
 
   u3m_reclaim();     // refresh the byte-code interpreter.
 
-  u3h_free(u3R->cax.per_p);
-  u3R->cax.per_p = u3h_new_cache(u3C.per_w);
+  u3z_free(u3z_memo_keep);
 
   u3h_free(u3R->jed.cod_p);
   u3R->jed.cod_p = u3h_new();
@@ -677,84 +755,94 @@ _cu_rock_path_make(c3_c* dir_c, c3_d eve_d, c3_c** out_c)
   return c3y;
 }
 
+/* _cu_rock_open(): open rock file, creating the containing directory.
+*/
 static c3_o
-_cu_rock_save(c3_c* dir_c, c3_d eve_d, c3_d len_d, c3_y* byt_y)
+_cu_rock_open(c3_c* dir_c, c3_d eve_d, c3_i* fid_i)
 {
-  c3_i fid_i;
-
-  //  open rock file, creating the containing directory if necessary
-  //
-  {
-    c3_c* nam_c;
-
-    if ( c3n == _cu_rock_path_make(dir_c, eve_d, &nam_c) ) {
-      return c3n;
-    }
+  c3_c* nam_c;
 
-    if ( -1 == (fid_i = c3_open(nam_c, O_RDWR | O_CREAT | O_TRUNC, 0644)) ) {
-      fprintf(stderr, "rock: c3_open failed (%s, %" PRIu64 "): %s\r\n",
-                      dir_c, eve_d, strerror(errno));
-      c3_free(nam_c);
-      return c3n;
-    }
+  if ( c3n == _cu_rock_path_make(dir_c, eve_d, &nam_c) ) {
+    return c3n;
+  }
 
+  if ( -1 == (*fid_i = c3_open(nam_c, O_RDWR | O_CREAT | O_TRUNC, 0644)) ) {
+    fprintf(stderr, "rock: c3_open failed (%s, %" PRIu64 "): %s\r\n",
+                    dir_c, eve_d, strerror(errno));
     c3_free(nam_c);
+    return c3n;
   }
 
-  //  write jam-buffer into [fid_i]
-  //
-  //    XX deduplicate with _write() wrapper in term.c
-  //
-  {
-    ssize_t ret_i;
-
-    while ( len_d > 0 ) {
-      c3_w lop_w = 0;
-      //  retry interrupt/async errors
-      //
-      do {
-        //  abort pathological retry loop
-        //
-        if ( 100 == ++lop_w ) {
-          fprintf(stderr, "rock: write loop: %s\r\n", strerror(errno));
-          close(fid_i);
-          //  XX unlink file?
-          //
-          return c3n;
-        }
+  c3_free(nam_c);
+  return c3y;
+}
 
-        ret_i = write(fid_i, byt_y, len_d);
-      }
-      while (  (ret_i < 0)
-            && (  (errno == EINTR)
-               || (errno == EAGAIN)
-               || (errno == EWOULDBLOCK) ));
+/* _cu_rock_write(): write [len_d] bytes into [fid_i].
+**
+**   XX deduplicate with _write() wrapper in term.c
+*/
+static c3_o
+_cu_rock_write(c3_i fid_i, c3_d len_d, const c3_y* byt_y)
+{
+  ssize_t ret_i;
 
-      //  assert on true errors
-      //
-      //    NB: can't call u3l_log here or we would re-enter _write()
+  while ( len_d > 0 ) {
+    c3_w lop_w = 0;
+    //  retry interrupt/async errors
+    //
+    do {
+      //  abort pathological retry loop
       //
-      if ( ret_i < 0 ) {
-        fprintf(stderr, "rock: write failed %s\r\n", strerror(errno));
-        close(fid_i);
-        //  XX unlink file?
-        //
+      if ( 100 == ++lop_w ) {
+        fprintf(stderr, "rock: write loop: %s\r\n", strerror(errno));
         return c3n;
       }
-      //  continue partial writes
-      //
-      else {
-        len_d -= ret_i;
-        byt_y += ret_i;
-      }
+
+      ret_i = write(fid_i, byt_y, len_d);
     }
-  }
+    while (  (ret_i < 0)
+          && (  (errno == EINTR)
+             || (errno == EAGAIN)
+             || (errno == EWOULDBLOCK) ));
 
-  close(fid_i);
+    //  assert on true errors
+    //
+    //    NB: can't call u3l_log here or we would re-enter _write()
+    //
+    if ( ret_i < 0 ) {
+      fprintf(stderr, "rock: write failed %s\r\n", strerror(errno));
+      return c3n;
+    }
+    //  continue partial writes
+    //
+    else {
+      len_d -= ret_i;
+      byt_y += ret_i;
+    }
+  }
 
   return c3y;
 }
 
+/* _cu_rock_sink: streaming jam output, into a rock file.
+*/
+typedef struct _cu_rock_sink {
+  c3_i fid_i;                           //  rock file
+  c3_o ret_o;                           //  no write has failed
+} _cu_rock_sink;
+
+/* _cu_rock_flush(): write a chunk of jam output, unless already failed.
+*/
+static void
+_cu_rock_flush(void* ptr_v, uint64_t len_d, const uint8_t* byt_y)
+{
+  _cu_rock_sink* sin_u = ptr_v;
+
+  if ( c3y == sin_u->ret_o ) {
+    sin_u->ret_o = _cu_rock_write(sin_u->fid_i, len_d, byt_y);
+  }
+}
+
 /* u3u_cram(): globably deduplicate memory, and write a rock to disk.
 */
 #ifdef U3_MEMORY_DEBUG
@@ -768,12 +856,16 @@ u3u_cram(c3_c* dir_c, c3_d eve_d)
 c3_o
 u3u_cram(c3_c* dir_c, c3_d eve_d)
 {
-  c3_o  ret_o = c3y;
-  c3_d  len_d;
-  c3_y* byt_y;
+  _cu_rock_sink sin_u = { .ret_o = c3y };
 
   u3_assert( &(u3H->rod_u) == u3R );
 
+  //  open rock file in pier
+  //
+  if ( c3n == _cu_rock_open(dir_c, eve_d, &sin_u.fid_i) ) {
+    return c3n;
+  }
+
   {
     ur_root_t* rot_u;
     ur_nvec_t  cod_u;
@@ -799,7 +891,10 @@ u3u_cram(c3_c* dir_c, c3_d eve_d)
       roc = ur_cons(rot_u, ur_coin64(rot_u, c3__arvo),
                            ur_cons(rot_u, ken, roc));
 
-      ur_jam(rot_u, roc, &len_d, &byt_y);
+      //  stream jam output into the rock, in 4MB chunks,
+      //  rather than buffering all of it
+      //
+      ur_jam_sink(rot_u, roc, 1ULL << 22, _cu_rock_flush, &sin_u);
     }
 
     //  dispose off-loom structures
@@ -808,15 +903,11 @@ u3u_cram(c3_c* dir_c, c3_d eve_d)
     ur_root_free(rot_u);
   }
 
-  //  write jam-buffer into pier
+  //  XX unlink file on failure?
   //
-  if ( c3n == _cu_rock_save(dir_c, eve_d, len_d, byt_y) ) {
-    ret_o = c3n;
-  }
-
-  c3_free(byt_y);
+  close(sin_u.fid_i);
 
-  return ret_o;
+  return sin_u.ret_o;
 }
 #endif
 
@@ -986,13 +1077,11 @@ u3u_uncram(c3_c* dir_c, c3_d eve_d)
   //    XX errors are fatal, barring a full "u3m_reboot"-type operation.
   //
   {
-    //  XX tune the initial dictionary size for less reallocation
+    //  only backreference targets are kept in the dictionary,
+    //  which is sized by a prior scan of the rock
     //
-    u3_cue_xeno* sil_u = u3s_cue_xeno_init_with(ur_fib33, ur_fib34);
-    u3_weak        ref = u3s_cue_xeno_with(sil_u, len_d, byt_y);
-    u3_noun   roc, doc, tag, cod;
-
-    u3s_cue_xeno_done(sil_u);
+    u3_weak      ref = u3s_cue_xeno_lean(len_d, byt_y);
+    u3_noun roc, doc, tag, cod;
 
     if ( u3_none == ref ) {
       fprintf(stderr, "uncram: failed to cue rock\r\n");
@@ -4,6 +4,8 @@
 #define U3_URTH_H
 
 #include "c3/c3.h"
+#include "types.h"
+#include "ur/ur.h"
 
     /**  Functions.
     **/
@@ -26,6 +28,11 @@
         c3_o
         u3u_uncram(c3_c* dir_c, c3_d eve_d);
 
+      /* u3u_from_ur(): copy [ref] from [rot_u] onto the loom, producing.
+      */
+        u3_noun
+        u3u_from_ur(ur_root_t* rot_u, ur_nref ref);
+
       /* u3u_mmap_read(): open and mmap the file at [pat_c] for reading.
       */
         c3_o
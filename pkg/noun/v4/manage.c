@@ -1,6 +1,7 @@
 /// @file
 
 #include "v4/manage.h"
+#include "v5/manage.h"
 #include "stdio.h"
 #include "manage.h"
 #include "allocate.h"
@@ -22,6 +23,9 @@ u3m_v4_migrate(void)
   u3H = (void *)mat_w;
   u3R = &u3H->rod_u;
 
+  //  sites must be sane before the caches are freed
+  //
+  u3m_v5_clear();
   u3m_reclaim();
 
   u3H->ver_w = U3V_VER4;
@@ -0,0 +1,66 @@
+/// @file
+
+#include "v5/manage.h"
+#include "stdio.h"
+#include "manage.h"
+#include "allocate.h"
+#include "hashtable.h"
+#include "jets.h"
+#include "nock.h"
+#include "vortex.h"
+#include "options.h"
+
+/* _cm_v5_prog(): clear call-site spares in a cached program.
+**
+**   pic_p occupies what was tail padding in u3j_site,
+**   so older images may have anything there.
+*/
+static void
+_cm_v5_prog(u3_noun kev)
+{
+  u3n_prog* pog_u = u3to(u3n_prog, u3t(kev));
+  c3_w      i_w;
+
+  for ( i_w = 0; i_w < pog_u->cal_u.len_w; ++i_w ) {
+    pog_u->cal_u.sit_u[i_w].pic_p = 0;
+  }
+}
+
+/* _cm_v5_hank(): clear call-site spares in a cached hook.
+*/
+static void
+_cm_v5_hank(u3_noun kev)
+{
+  u3to(u3j_hank, u3t(kev))->sit_u.pic_p = 0;
+}
+
+/* u3m_v5_clear: clear call-site spares in a pre-v5 home road.
+*/
+void
+u3m_v5_clear(void)
+{
+  u3h_walk(u3R->byc.har_p, _cm_v5_prog);
+  u3h_walk(u3R->jed.han_p, _cm_v5_hank);
+}
+
+/* u3m_v5_migrate: perform call-site cache migration if necessary.
+*/
+void
+u3m_v5_migrate(void)
+{
+  fprintf(stderr, "loom: call-site cache migration running...\r\n");
+
+  c3_w* mem_w = u3_Loom + u3a_walign;
+  c3_w  siz_w = c3_wiseof(u3v_home);
+  c3_w  len_w = u3C.wor_i - u3a_walign;
+  c3_w* mat_w = c3_align(mem_w + len_w - siz_w, u3a_balign, C3_ALGLO);
+
+  u3H = (void *)mat_w;
+  u3R = &u3H->rod_u;
+
+  u3m_v5_clear();
+
+  u3H->ver_w = U3V_VER5;
+
+  fprintf(stderr, "loom: call-site cache migration done\r\n");
+}
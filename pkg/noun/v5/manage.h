@@ -0,0 +1,18 @@
+/// @file
+
+#ifndef U3_MANAGE_V5_H
+#define U3_MANAGE_V5_H
+
+    /** System management.
+    **/
+      /* u3m_v5_clear: clear call-site spares in a pre-v5 home road.
+      */
+        void
+        u3m_v5_clear(void);
+
+      /* u3m_v5_migrate: perform call-site cache migration if necessary.
+      */
+        void
+        u3m_v5_migrate(void);
+
+#endif /* ifndef U3_MANAGE_V5_H */
@@ -0,0 +1,36 @@
+/// @file
+
+#include "v6/manage.h"
+#include "stdio.h"
+#include "manage.h"
+#include "allocate.h"
+#include "hashtable.h"
+#include "vortex.h"
+#include "options.h"
+#include "zave.h"
+
+/* u3m_v6_migrate: perform memo cache migration if necessary.
+**
+**   memo entries are now weighed, [wid val], but older images
+**   hold bare values.  the caches are disposable, so drop them.
+*/
+void
+u3m_v6_migrate(void)
+{
+  fprintf(stderr, "loom: memo cache migration running...\r\n");
+
+  c3_w* mem_w = u3_Loom + u3a_walign;
+  c3_w  siz_w = c3_wiseof(u3v_home);
+  c3_w  len_w = u3C.wor_i - u3a_walign;
+  c3_w* mat_w = c3_align(mem_w + len_w - siz_w, u3a_balign, C3_ALGLO);
+
+  u3H = (void *)mat_w;
+  u3R = &u3H->rod_u;
+
+  u3z_free(u3z_memo_toss);
+  u3z_free(u3z_memo_keep);
+
+  u3H->ver_w = U3V_VER6;
+
+  fprintf(stderr, "loom: memo cache migration done\r\n");
+}
@@ -0,0 +1,13 @@
+/// @file
+
+#ifndef U3_MANAGE_V6_H
+#define U3_MANAGE_V6_H
+
+    /** System management.
+    **/
+      /* u3m_v6_migrate: perform memo cache migration if necessary.
+      */
+        void
+        u3m_v6_migrate(void);
+
+#endif /* ifndef U3_MANAGE_V6_H */
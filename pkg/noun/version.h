@@ -10,7 +10,9 @@ typedef c3_w       u3v_version;
 #define U3V_VER2   2
 #define U3V_VER3   3
 #define U3V_VER4   4
-#define U3V_VERLAT U3V_VER4
+#define U3V_VER5   5
+#define U3V_VER6   6
+#define U3V_VERLAT U3V_VER6
 
 /* PATCHES
  */
@@ -38,4 +40,12 @@ typedef c3_w       u3e_version;
 #define U3E_VER1   1
 #define U3E_VERLAT U3E_VER1
 
+/* BYTECODE CACHE
+ *
+ * bump when opcodes or their encoding change (see nock.c)
+ */
+
+#define U3N_VER1   1
+#define U3N_VERLAT U3N_VER1
+
 #endif /* ifndef U3_VERSION_H */
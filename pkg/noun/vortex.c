@@ -256,7 +256,7 @@ u3v_peek(u3_noun sam)
 u3_noun
 u3v_soft_peek(c3_w mil_w, u3_noun sam)
 {
-  u3_noun gon = u3m_soft(mil_w, u3v_peek, sam);
+  u3_noun gon = u3m_soft_sand(mil_w, u3v_peek, sam);
   u3_noun tag, dat;
   u3x_cell(gon, &tag, &dat);
 
@@ -405,7 +405,7 @@ u3v_mark()
 
   qua_u[3] = NULL;
 
-  u3m_quac* tot_u = c3_malloc(sizeof(*tot_u));
+  u3m_quac* tot_u = c3_calloc(sizeof(*tot_u));
   tot_u->nam_c = strdup("total arvo stuff");
   tot_u->siz_w = qua_u[0]->siz_w + qua_u[1]->siz_w + qua_u[2]->siz_w;
   tot_u->qua_u = qua_u;
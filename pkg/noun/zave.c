@@ -5,8 +5,13 @@
 #include "allocate.h"
 #include "hashtable.h"
 #include "imprison.h"
+#include "options.h"
 #include "vortex.h"
 
+  //  entry weights are direct atoms
+  //
+#define _CZ_WID_MAX  0x7fffffff
+
 /* u3z_key(): construct a memo cache-key.  Arguments retained.
 */
 u3_noun
@@ -35,6 +40,10 @@ u3z_key_5(c3_m fun, u3_noun one, u3_noun two, u3_noun tri, u3_noun qua, u3_noun
   return u3nc(fun, u3nq(u3k(one), u3k(two), u3k(tri), u3nc(u3k(qua), u3k(qin))));
 }
 
+/* u3z_Stat: memo cache counters, since boot.
+*/
+u3z_stat u3z_Stat[2];
+
 /* _har(): get the memo cache for the given cid.
 */
 static u3p(u3h_root)
@@ -49,28 +58,211 @@ _har(u3a_road* rod_u, u3z_cid cid)
   u3_assert(0);
 }
 
+/* _maz(): get the retained-word count for the given cid.
+*/
+static c3_w*
+_maz(u3a_road* rod_u, u3z_cid cid)
+{
+  switch ( cid ) {
+    case u3z_memo_toss:
+      return &(rod_u->maz.har_w);
+    case u3z_memo_keep:
+      return &(rod_u->maz.per_w);
+  }
+  u3_assert(0);
+}
+
+/* _cz_max(): entry limit for the given cid, 0 if uncapped.
+*/
+static c3_w
+_cz_max(u3z_cid cid)
+{
+  return ( u3z_memo_toss == cid ) ? u3C.hap_w : u3C.per_w;
+}
+
+/* _cz_cap(): word budget for the given cid, 0 if uncapped.
+*/
+static c3_w
+_cz_cap(u3z_cid cid)
+{
+  c3_d mib_d = ( u3z_memo_toss == cid ) ? u3C.hab_w : u3C.peb_w;
+  c3_d cap_d = mib_d << 18;
+
+  return ( cap_d > _CZ_WID_MAX ) ? _CZ_WID_MAX : (c3_w)cap_d;
+}
+
+/* _cz_weigh(): words a new entry retains on the current road.
+**
+**   key and value are counted in one pass, so that structure
+**   shared between them is only charged once; then the two cells
+**   of the entry itself and its slot in the hashtable.
+*/
+static c3_w
+_cz_weigh(u3_noun key, u3_noun val)
+{
+  c3_w wid_w = u3a_count_noun(key) + u3a_count_noun(val);
+
+  u3a_discount_noun(key);
+  u3a_discount_noun(val);
+
+  wid_w += (2 * u3a_minimum) + 1;
+
+  return ( wid_w > _CZ_WID_MAX ) ? _CZ_WID_MAX : wid_w;
+}
+
+/* _cz_add(): add a weighed entry.  RETAIN key; TRANSFER [wid val].
+*/
+static void
+_cz_add(u3z_cid cid, u3_noun key, u3_noun wap)
+{
+  u3p(u3h_root) har_p = _har(u3R, cid);
+  c3_w*         wor_w = _maz(u3R, cid);
+  u3_weak       old   = u3h_git(har_p, key);
+  c3_w          wid_w = u3h(wap);
+
+  if ( u3_none != old ) {
+    *wor_w -= c3_min(*wor_w, u3h(old));
+  }
+
+  *wor_w = ( wid_w > (0xffffffff - *wor_w) ) ? 0xffffffff : *wor_w + wid_w;
+
+  u3h_put(har_p, key, wap);
+}
+
+static c3_w _cz_gon_w;  //  words released by the current trim
+
+/* _cz_lose(): release an evicted entry, tallying its weight.
+*/
+static void
+_cz_lose(u3_noun kev)
+{
+  _cz_gon_w += u3h(u3t(kev));
+  u3z(kev);
+}
+
+/* _cz_drop(): evict down to [wyt_w] entries.
+*/
+static void
+_cz_drop(u3z_cid cid, c3_w wyt_w)
+{
+  u3p(u3h_root) har_p = _har(u3R, cid);
+  c3_w*         wor_w = _maz(u3R, cid);
+  c3_w          pre_w = u3h_wyt(har_p);
+
+  if ( pre_w <= wyt_w ) {
+    return;
+  }
+
+  _cz_gon_w = 0;
+  u3h_trim_with(har_p, wyt_w, _cz_lose);
+
+  *wor_w -= c3_min(*wor_w, _cz_gon_w);
+  u3z_Stat[cid].eve_d += pre_w - wyt_w;
+}
+
+/* _cz_fit(): evict until the cache is within its entry limit and budget.
+**
+**   entries go one at a time, in clock order, so the heaviest
+**   entries are not favored over the coldest ones.
+*/
+static void
+_cz_fit(u3z_cid cid)
+{
+  c3_w          max_w = _cz_max(cid);
+  c3_w          cap_w = _cz_cap(cid);
+  u3p(u3h_root) har_p = _har(u3R, cid);
+  c3_w*         wor_w = _maz(u3R, cid);
+  c3_w          wyt_w;
+
+  if ( max_w ) {
+    _cz_drop(cid, max_w);
+  }
+
+  if ( !cap_w ) {
+    return;
+  }
+
+  while ( (*wor_w > cap_w) && (wyt_w = u3h_wyt(har_p)) ) {
+    _cz_drop(cid, wyt_w - 1);
+  }
+}
+
+/* _cz_put(): weigh and insert, producing the weight.
+**           TRANSFER key; RETAIN val.
+*/
+static c3_w
+_cz_put(u3z_cid cid, u3_noun key, u3_noun val)
+{
+  c3_w cap_w = _cz_cap(cid);
+  c3_w wid_w = _cz_weigh(key, val);
+
+  //  an entry that can never fit would only flush the cache
+  //
+  if ( cap_w && (wid_w > cap_w) ) {
+    u3z_Stat[cid].eve_d++;
+    wid_w = 0;
+  }
+  else {
+    _cz_add(cid, key, u3nc(wid_w, u3k(val)));
+    _cz_fit(cid);
+  }
+
+  u3z(key);
+  return wid_w;
+}
+
+/* _cz_get(): find in one road's memo cache, unwrapped.  RETAIN key.
+*/
+static u3_weak
+_cz_get(u3a_road* rod_u, u3z_cid cid, u3_noun key)
+{
+  u3_weak wap = u3h_get(_har(rod_u, cid), key);
+
+  if ( u3_none == wap ) {
+    return u3_none;
+  }
+  else {
+    u3_noun val = u3k(u3t(wap));
+    u3z(wap);
+    return val;
+  }
+}
+
 /* u3z_find(): find in memo cache.  Arguments retained.
 */
 u3_weak
 u3z_find(u3z_cid cid, u3_noun key)
 {
+  u3_weak got;
+
   if ( u3z_memo_toss == cid ) {
-    return u3h_get(_har(u3R, cid), key);
+    got = _cz_get(u3R, cid, key);
   }
   else {
-    //  XX needs to be benchmarked (up vs. down search)
+    //  search down from home, where entries reaped from earlier
+    //  events live.  direction only changes how many roads a hit
+    //  passes on the way (misses visit them all); see _memo_bench()
+    //  in benchmarks.c: 16 roads deep, ~180ns vs ~480ns for a hit
+    //  at home, and the reverse for one on top.
+    //
     u3a_road* rod_u = &(u3H->rod_u);
     while ( 1 ) {
-      u3_weak got = u3h_get(_har(rod_u, cid), key);
-      if ( u3_none != got ) {
-        return got;
-      }
-      if ( 0 == rod_u->kid_p ) {
-        return u3_none;
+      got = _cz_get(rod_u, cid, key);
+      if ( (u3_none != got) || (0 == rod_u->kid_p) ) {
+        break;
       }
       rod_u = u3to(u3a_road, rod_u->kid_p);
     };
   }
+
+  if ( u3_none == got ) {
+    u3z_Stat[cid].mis_d++;
+  }
+  else {
+    u3z_Stat[cid].hit_d++;
+  }
+
+  return got;
 }
 u3_weak
 u3z_find_m(u3z_cid cid, c3_m fun, u3_noun one)
@@ -88,8 +280,7 @@ u3z_find_m(u3z_cid cid, c3_m fun, u3_noun one)
 u3_noun
 u3z_save(u3z_cid cid, u3_noun key, u3_noun val)
 {
-  u3h_put(_har(u3R, cid), key, u3k(val));
-  u3z(key);
+  _cz_put(cid, key, val);
   return val;
 }
 
@@ -98,30 +289,43 @@ u3z_save(u3z_cid cid, u3_noun key, u3_noun val)
 u3_noun
 u3z_save_m(u3z_cid cid, c3_m fun, u3_noun one, u3_noun val)
 {
-  u3_noun key = u3nc(fun, u3k(one));
-
-  u3h_put(_har(u3R, cid), key, u3k(val));
-  u3z(key);
+  _cz_put(cid, u3nc(fun, u3k(one)), val);
   return val;
 }
 
+/* u3z_save_wid(): u3z_save_m(), producing the weight of the new entry.
+*/
+c3_w
+u3z_save_wid(u3z_cid cid, c3_m fun, u3_noun one, u3_noun val)
+{
+  return _cz_put(cid, u3nc(fun, u3k(one)), val);
+}
+
 /* u3z_uniq(): uniquify with memo cache. XX not used.
 */
 u3_noun
 u3z_uniq(u3z_cid cid, u3_noun som)
 {
   u3_noun key = u3nc(c3__uniq, u3k(som));
-  u3_noun val = u3h_get(_har(u3R, cid), key);
+  u3_weak val = _cz_get(u3R, cid, key);
 
   if ( u3_none != val ) {
     u3z(key); u3z(som); return val;
   }
   else {
-    u3h_put(_har(u3R, cid), key, u3k(som));
+    _cz_put(cid, key, som);
     return som;
   }
 }
 
+/* _cz_reap(): promote one entry, keeping its weight.  RETAINS.
+*/
+static void
+_cz_reap(u3_noun kev, void* cid_v)
+{
+  _cz_add(*(u3z_cid*)cid_v, u3h(kev), u3k(u3t(kev)));
+}
+
 /* u3z_reap(): promote memoization cache state.
 */
 void
@@ -129,6 +333,51 @@ u3z_reap(u3z_cid cid, u3p(u3h_root) har_p)
 {
   u3_assert(u3z_memo_toss != cid);
 
-  u3h_uni(_har(u3R, cid), har_p);
+  u3h_walk_with(har_p, _cz_reap, &cid);
   u3h_free(har_p);
+  _cz_fit(cid);
+}
+
+/* u3z_free(): free memoization cache.
+*/
+void
+u3z_free(u3z_cid cid)
+{
+  switch ( cid ) {
+    case u3z_memo_toss: {
+      u3h_free(u3R->cax.har_p);
+      u3R->cax.har_p = u3h_new();
+    } break;
+
+    case u3z_memo_keep: {
+      u3h_free(u3R->cax.per_p);
+      u3R->cax.per_p = u3h_new();
+    } break;
+  }
+
+  *_maz(u3R, cid) = 0;
+}
+
+/* u3z_trim(): evict from memoization cache down to [wyt_w] entries.
+*/
+void
+u3z_trim(u3z_cid cid, c3_w wyt_w)
+{
+  _cz_drop(cid, wyt_w);
+}
+
+/* u3z_wyt(): number of entries in memoization cache.
+*/
+c3_w
+u3z_wyt(u3z_cid cid)
+{
+  return u3h_wyt(_har(u3R, cid));
+}
+
+/* u3z_weight(): words retained by memoization cache.
+*/
+c3_w
+u3z_weight(u3z_cid cid)
+{
+  return *_maz(u3R, cid);
 }
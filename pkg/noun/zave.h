@@ -13,6 +13,11 @@
   ***  are predefined by C-level callers, but 0 means nock.
   ***
   ***  Memo functions RETAIN keys and transfer values.
+  ***
+  ***  Each entry is weighed, at insertion, by the words it
+  ***  retains on the current road; each road's caches are kept
+  ***  within the entry limits in u3C.hap_w / u3C.per_w, and
+  ***  under the word budgets in u3C.hab_w / u3C.peb_w (MiB).
   **/
     /* u3z_cid: cache id
     */
@@ -24,6 +29,23 @@
         // ...
       } u3z_cid;
 
+    /* u3z_stat: memo cache counters, per cid.
+    */
+      typedef struct _u3z_stat {
+        c3_d hit_d;                           //  lookups found
+        c3_d mis_d;                           //  lookups missed
+        c3_d eve_d;                           //  entries evicted
+      } u3z_stat;
+
+  /**  Globals.
+  **/
+    /* u3z_Stat: memo cache counters, since boot.
+    */
+      extern u3z_stat u3z_Stat[2];
+
+  /**  Functions.
+  **/
+
     /* u3z_key*(): construct a memo cache-key.  Arguments retained.
     */
       u3_noun u3z_key(c3_m, u3_noun);
@@ -45,6 +67,11 @@
     */
       u3_noun u3z_save_m(u3z_cid cid, c3_m fun_m, u3_noun one, u3_noun val);
 
+    /* u3z_save_wid(): u3z_save_m(), producing the weight of the
+    **                 new entry (0 if it was too large to keep).
+    */
+      c3_w u3z_save_wid(u3z_cid cid, c3_m fun_m, u3_noun one, u3_noun val);
+
     /* u3z_uniq(): uniquify with memo cache.
     */
       u3_noun
@@ -60,6 +87,21 @@
       void
       u3z_free(u3z_cid cid);
 
+    /* u3z_trim(): evict from memoization cache down to [wyt_w] entries.
+    */
+      void
+      u3z_trim(u3z_cid cid, c3_w wyt_w);
+
+    /* u3z_wyt(): number of entries in memoization cache.
+    */
+      c3_w
+      u3z_wyt(u3z_cid cid);
+
+    /* u3z_weight(): words retained by memoization cache.
+    */
+      c3_w
+      u3z_weight(u3z_cid cid);
+
     /* u3z_ream(): refresh after restoring from checkpoint.
     */
       void
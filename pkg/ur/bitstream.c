@@ -712,12 +712,41 @@ ur_bsw_init(ur_bsw_t *bsw, uint64_t prev, uint64_t size)
   }
 }
 
+void
+ur_bsw_init_sink(ur_bsw_t *bsw, uint64_t size, ur_bsw_sink_f sink, void *ptr)
+{
+  //  [prev] is the minimum growth step, which must fit after a flush
+  //
+  ur_bsw_init(bsw, size >> 1, size);
+  bsw->sent = 0;
+  bsw->sink = sink;
+  bsw->ptr  = ptr;
+}
+
 void
 ur_bsw_grow(ur_bsw_t *bsw, uint64_t step)
 {
   uint64_t size = bsw->size;
   uint64_t next = size + step;
 
+  //  flush whole bytes, keeping the partial byte (if any);
+  //  reallocate only if a single write needs more than the buffer
+  //
+  if ( bsw->sink && bsw->fill ) {
+    uint64_t fill = bsw->fill;
+
+    bsw->sink(bsw->ptr, fill, bsw->bytes);
+    bsw->bytes[0] = bsw->bytes[fill];
+    memset(bsw->bytes + 1, 0, fill);
+
+    bsw->sent += fill;
+    bsw->fill  = 0;
+
+    if ( step < size ) {
+      return;
+    }
+  }
+
   bsw->bytes = realloc(bsw->bytes, next);
 
   if ( !bsw->bytes ) {
@@ -736,7 +765,7 @@ ur_bool_t
 ur_bsw_sane(ur_bsw_t *bsw)
 {
   return (  (8 > bsw->off)
-         && ((bsw->fill << 3) + bsw->off == bsw->bits) );
+         && (((bsw->sent + bsw->fill) << 3) + bsw->off == bsw->bits) );
 }
 
 uint64_t
@@ -747,6 +776,16 @@ ur_bsw_done(ur_bsw_t *bsw, uint64_t *len, uint8_t **byt)
   *len = bsw->fill + !!bsw->off;
   *byt = bsw->bytes;
 
+  if ( bsw->sink ) {
+    if ( *len ) {
+      bsw->sink(bsw->ptr, *len, bsw->bytes);
+    }
+
+    free(bsw->bytes);
+    *len += bsw->sent;
+    *byt  = 0;
+  }
+
   memset(bsw, 0, sizeof(*bsw));
 
   return bits;
@@ -42,11 +42,19 @@ typedef enum {
   ur_jam_back = 2
 } ur_cue_tag_e;
 
+/*
+**  sink for a streaming bitstream writer: consume [len] bytes.
+*/
+typedef void (*ur_bsw_sink_f)(void *ptr, uint64_t len, const uint8_t *byt);
+
 /*
 **  stateful bitstream writer, backed by a byte-buffer automatically
 **  reallocated with fibonacc growth, maintaing a 64-bit bit-cursor,
 **  and supporting a variety of write sizes and patterns.
 **
+**  if [sink] is set, whole bytes are flushed to it (and counted in [sent])
+**  when the buffer is full, instead of reallocating it.
+**
 */
 typedef struct ur_bsw_s {
   uint64_t    prev;
@@ -55,6 +63,9 @@ typedef struct ur_bsw_s {
   uint64_t    bits;
   uint8_t      off;
   uint8_t   *bytes;
+  uint64_t    sent;
+  ur_bsw_sink_f sink;
+  void        *ptr;
 } ur_bsw_t;
 
 /*
@@ -141,6 +152,13 @@ void
 ur_bsw_init(ur_bsw_t *bsw, uint64_t prev, uint64_t size);
 
 /*
+**  initialize bitstream-writer with a [size]-byte buffer, flushed to [sink].
+*/
+void
+ur_bsw_init_sink(ur_bsw_t *bsw, uint64_t size, ur_bsw_sink_f sink, void *ptr);
+
+/*
+**  flush whole bytes to the sink, if any; otherwise,
 **  reallocate bitstream write buffer with max(fibonacci, step) growth.
 */
 void
@@ -154,6 +172,7 @@ ur_bsw_sane(ur_bsw_t *bsw);
 
 /*
 **  return bit-length, produce byte-buffer.
+**  (if streaming, flush the remainder and produce a null buffer.)
 */
 uint64_t
 ur_bsw_done(ur_bsw_t *bsw, uint64_t *len, uint8_t **byt);
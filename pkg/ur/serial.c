@@ -152,6 +152,25 @@ ur_jam(ur_root_t  *r,
   return bits;
 }
 
+uint64_t
+ur_jam_sink(ur_root_t     *r,
+            ur_nref       ref,
+            uint64_t     size,
+            ur_bsw_sink_f sink,
+            void         *ptr)
+{
+  ur_jam_t   *j = ur_jam_init(r);
+  uint64_t  len, bits;
+  uint8_t  *byt;
+
+  ur_bsw_init_sink(&j->bsw, size, sink, ptr);
+  ur_walk_fore_with(j->w, ref, j, _jam_atom, _jam_cell);
+  bits = ur_bsw_done(&j->bsw, &len, &byt);
+
+  ur_jam_done(j);
+  return bits;
+}
+
 /*
 **  stack frame for recording head vs tail iteration
 **
@@ -586,3 +605,75 @@ ur_cue_test(uint64_t len, const uint8_t *byt)
   ur_cue_test_done(t);
   return ret;
 }
+
+ur_cue_res_e
+ur_cue_scan(uint64_t       len,
+            const uint8_t *byt,
+            ur_dict_t     *refs,
+            uint64_t      *out)
+{
+  ur_bsr_t     bsr = {0};
+  uint64_t    todo = 1, bak, size;
+  ur_cue_tag_e tag;
+  ur_cue_res_e res;
+
+  *out = 0;
+
+  //  init bitstream-reader
+  //
+  if ( ur_cue_good != (res = ur_bsr_init(&bsr, len, byt)) ) {
+    return res;
+  }
+  //  bit-cursor (and backreferences) must fit in 62-bit direct atoms
+  //
+  else if ( 0x7ffffffffffffffULL < len ) {
+    return ur_cue_meme;
+  }
+
+  //  jam is a prefix code: no stack is needed, just the count of
+  //  nodes yet to be read. a cell adds one, an atom or backreference
+  //  completes one.
+  //
+  while ( todo ) {
+    if ( ur_cue_good != (res = ur_bsr_tag(&bsr, &tag)) ) {
+      return res;
+    }
+
+    switch ( tag ) {
+      default: assert(0);
+
+      case ur_jam_cell: {
+        todo++;
+      } break;
+
+      case ur_jam_back: {
+        if ( ur_cue_good != (res = ur_bsr_rub_len(&bsr, &size)) ) {
+          return res;
+        }
+        else if ( 62 < size ) {
+          return ur_cue_meme;
+        }
+
+        bak = ur_bsr64_any(&bsr, size);
+
+        if ( !ur_dict_get((ur_root_t*)0, refs, bak) ) {
+          ur_dict_put((ur_root_t*)0, refs, bak);
+          (*out)++;
+        }
+
+        todo--;
+      } break;
+
+      case ur_jam_atom: {
+        if ( ur_cue_good != (res = ur_bsr_rub_len(&bsr, &size)) ) {
+          return res;
+        }
+
+        ur_bsr_skip_any(&bsr, size);
+        todo--;
+      } break;
+    }
+  }
+
+  return ur_cue_good;
+}
@@ -52,6 +52,17 @@ ur_jam_with(ur_jam_t   *j,
 void
 ur_jam_done(ur_jam_t *j);
 
+/*
+**  jam_sink streams its output to [sink], in chunks of up to [size] bytes,
+**  rather than producing a byte-buffer.
+*/
+uint64_t
+ur_jam_sink(ur_root_t     *r,
+            ur_nref       ref,
+            uint64_t     size,
+            ur_bsw_sink_f sink,
+            void         *ptr);
+
 /*
 **  bitwise deserialization of a byte-buffer into a noun.
 **  supports up to 62-bits of bit-addressed input (511 PiB).
@@ -111,4 +122,15 @@ ur_cue_test_with(ur_cue_test_t   *t,
 void
 ur_cue_test_done(ur_cue_test_t *t);
 
+/*
+**  cue_scan merely parses the input (without a stack), collecting the
+**  distinct targets of backreferences into [refs] and counting them in [out].
+**  backreferences are not validated; a subsequent cue must do so.
+*/
+ur_cue_res_e
+ur_cue_scan(uint64_t       len,
+            const uint8_t *byt,
+            ur_dict_t     *refs,
+            uint64_t      *out);
+
 #endif /* ifndef UR_SERIAL_H */
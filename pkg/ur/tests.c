@@ -1696,6 +1696,60 @@ _test_jam_spec(const char    *cap,
   return ret;
 }
 
+/*
+**  accumulate streamed jam output.
+*/
+typedef struct _jam_sink_s {
+  uint64_t  len;
+  uint64_t  max;
+  uint8_t  *byt;
+} _jam_sink_t;
+
+static void
+_jam_sink(void *ptr, uint64_t len, const uint8_t *byt)
+{
+  _jam_sink_t *s = ptr;
+
+  if ( s->len + len > s->max ) {
+    s->max = s->len + len;
+    s->byt = realloc(s->byt, s->max);
+  }
+
+  memcpy(s->byt + s->len, byt, len);
+  s->len += len;
+}
+
+static int
+_test_jam_sink_spec(const char    *cap,
+                    ur_root_t       *r,
+                    ur_nref        ref,
+                    size_t         len,
+                    const uint8_t *res)
+{
+  uint64_t size;
+  int       ret = 1;
+
+  //  small buffers flush often, and reallocate for wide atoms
+  //
+  for ( size = 2; size <= 64; size <<= 1 ) {
+    _jam_sink_t s = {0};
+    uint64_t bits = ur_jam_sink(r, ref, size, _jam_sink, &s);
+
+    if (  (s.len != len)
+       || (s.len != ((bits + 7) >> 3))
+       || (0 != memcmp(s.byt, res, len)) )
+    {
+      fprintf(stderr, "\033[31mjam sink %s (%" PRIu64 ") fail\033[0m\r\n",
+                      cap, size);
+      ret = 0;
+    }
+
+    free(s.byt);
+  }
+
+  return ret;
+}
+
 static int
 _test_cue_spec(const char    *cap,
                ur_root_t*       r,
@@ -1742,6 +1796,7 @@ _test_jam_cue(void)
         const char* cap = a;                                   \
         ur_nref     ref = b;                                   \
         ret &= _test_jam_spec(cap, r, ref, sizeof(res), res);  \
+        ret &= _test_jam_sink_spec(cap, r, ref, sizeof(res), res); \
         ret &= _test_cue_spec(cap, r, ref, sizeof(res), res);  \
 
   {
@@ -1826,6 +1881,69 @@ _test_jam_cue(void)
   return ret;
 }
 
+static int
+_test_cue_scan_spec(const char    *cap,
+                    size_t         len,
+                    const uint8_t *byt,
+                    uint64_t       num)
+{
+  ur_dict_t refs = {0};
+  uint64_t   out;
+  int        ret = 1;
+
+  ur_dict_grow((ur_root_t*)0, &refs, ur_fib10, ur_fib11);
+
+  if (  (ur_cue_good != ur_cue_scan(len, byt, &refs, &out))
+     || (num != out) )
+  {
+    fprintf(stderr, "\033[31mcue scan %s fail\033[0m\r\n", cap);
+    ret = 0;
+  }
+
+  ur_dict_free(&refs);
+  return ret;
+}
+
+static int
+_test_cue_scan(void)
+{
+  int ret = 1;
+
+  {
+    uint8_t res[2] = {  0x71, 0xcc };
+    ret &= _test_cue_scan_spec("[1 1 1]", sizeof(res), res, 0);
+  }
+
+  {
+    uint8_t res[12] = { 0x1, 0xdf, 0x2c, 0x6c, 0x8e, 0x1e, 0xf0, 0xcd, 0xea, 0xd8, 0xd8, 0x93 };
+    ret &= _test_cue_scan_spec("[%fast %full %fast]", sizeof(res), res, 1);
+  }
+
+  {
+    uint8_t res[6] = { 0xa5, 0x35, 0x19, 0xf3, 0x18, 0x5 };
+    ret &= _test_cue_scan_spec("[[0 0] [[0 0] 1 1] 1 1]", sizeof(res), res, 2);
+  }
+
+  //  truncated input
+  //
+  {
+    uint8_t res[1] = { 0x1 };
+    ur_dict_t refs = {0};
+    uint64_t   out;
+
+    ur_dict_grow((ur_root_t*)0, &refs, ur_fib10, ur_fib11);
+
+    if ( ur_cue_good == ur_cue_scan(sizeof(res), res, &refs, &out) ) {
+      fprintf(stderr, "\033[31mcue scan truncated fail\033[0m\r\n");
+      ret = 0;
+    }
+
+    ur_dict_free(&refs);
+  }
+
+  return ret;
+}
+
 static int
 _test_ur(void)
 {
@@ -1846,6 +1964,11 @@ _test_ur(void)
     ret = 0;
   }
 
+  if ( !_test_cue_scan() ) {
+    fprintf(stderr, "ur test cue scan failed\r\n");
+    ret = 0;
+  }
+
   return ret;
 }
 
@@ -1,16 +1,35 @@
 /// @file
 
 #include "noun.h"
+#include "events.h"
 #include "jets/q.h"
+#include "jets/w.h"
 #include "ur/ur.h"
 #include "vere.h"
+#include "db/book.h"
+#include "db/dict.h"
+#include "db/lmdb.h"
+
+#include <dirent.h>
+#include <sys/wait.h>
+
+/* _large(): yes iff VERE_BENCH_LARGE is set, enabling the slow sizes.
+*/
+static c3_o
+_large(void)
+{
+  return ( getenv("VERE_BENCH_LARGE") ) ? c3y : c3n;
+}
 
 /* _setup(): prepare for tests.
 */
 static void
 _setup(void)
 {
-  u3m_boot_lite(1 << 24);
+  //  +sort on 100k elements needs 64MB, and the hashes take 16MB samples;
+  //  the large sizes (+sort and +gas:by on 1M, 64MB atoms) need 1GB
+  //
+  u3m_boot_lite(( c3y == _large() ) ? ((size_t)1 << 30) : ((size_t)1 << 27));
 }
 
 /* _ames_writ_ex(): |hi packet from fake ~zod to fake ~nec
@@ -144,6 +163,65 @@ _jam_bench(void)
   u3z(wit);
 }
 
+/* _etch_bench(): king cpu per event, from ipc jam to event log etch.
+*/
+static void
+_etch_bench(void)
+{
+  struct timeval b4, f2, d0;
+  c3_w  mic_w, i_w, max_w = 100000;
+  u3_noun wit = _ames_writ_ex();
+
+  fprintf(stderr, "\r\nevent serialization microbenchmark:\r\n");
+
+  {
+    gettimeofday(&b4, 0);
+
+    {
+      c3_d  len_d;
+      c3_y* byt_y;
+      c3_y* dat_y;
+
+      for ( i_w = 0; i_w < max_w; i_w++ ) {
+        u3s_jam_xeno(wit, &len_d, &byt_y);
+        u3_disk_etch(0, u3t(u3t(wit)), 0, &dat_y);
+        c3_free(byt_y);
+        c3_free(dat_y);
+      }
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mic_w = (d0.tv_sec * 1000000) + d0.tv_usec;
+    fprintf(stderr, "  jam and etch: %u ms (%" PRIu64 " ns/event)\r\n",
+                    mic_w / 1000, ((c3_d)mic_w * 1000) / max_w);
+  }
+
+  {
+    gettimeofday(&b4, 0);
+
+    {
+      c3_d  len_d, dat_d;
+      c3_y* byt_y;
+      c3_y* dat_y;
+
+      for ( i_w = 0; i_w < max_w; i_w++ ) {
+        u3s_jam_xeno_twin(wit, 2, 4, &len_d, &byt_y, &dat_d, &dat_y);
+        c3_free(byt_y);
+        c3_free(dat_y);
+      }
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mic_w = (d0.tv_sec * 1000000) + d0.tv_usec;
+    fprintf(stderr, "  jam twin: %u ms (%" PRIu64 " ns/event)\r\n",
+                    mic_w / 1000, ((c3_d)mic_w * 1000) / max_w);
+  }
+
+  u3z(wit);
+}
+
 static void
 _cue_bench(void)
 {
@@ -445,6 +523,1443 @@ _edit_bench(void)
   }
 }
 
+/* _alloc_loop(): allocate and free small boxes, slabs per [sam].
+*/
+static u3_noun
+_alloc_loop(u3_noun sam)
+{
+  c3_w* ptr_w[1024];
+  c3_w  i_w, j_w, max_w = 2000;
+
+  if ( c3y == sam ) {
+    u3R->how.fag_w |= u3a_flag_slab;
+  }
+  else {
+    u3R->how.fag_w &= ~u3a_flag_slab;
+  }
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    //  2-16 words, freed out of order
+    //
+    for ( j_w = 0; j_w < 1024; j_w++ ) {
+      ptr_w[j_w] = u3a_walloc(2 + (j_w % 15));
+    }
+    for ( j_w = 0; j_w < 1024; j_w += 2 ) {
+      u3a_wfree(ptr_w[j_w]);
+    }
+    for ( j_w = 1; j_w < 1024; j_w += 2 ) {
+      u3a_wfree(ptr_w[j_w]);
+    }
+  }
+
+  return u3_blip;
+}
+
+static void
+_alloc_bench(void)
+{
+  struct timeval b4, f2, d0;
+  c3_w  mil_w;
+  c3_d  num_d = 2000ULL * 1024;
+
+  fprintf(stderr, "\r\nsmall-box allocation microbenchmark:\r\n");
+
+  {
+    gettimeofday(&b4, 0);
+
+    u3z(u3m_soft(0, _alloc_loop, c3n));
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mil_w = (d0.tv_sec * 1000) + (d0.tv_usec / 1000);
+    fprintf(stderr, "  alloc free lists: %u ms (%" PRIu64 " allocs/s)\r\n",
+                    mil_w, (num_d * 1000) / c3_max(1, mil_w));
+  }
+
+  {
+    gettimeofday(&b4, 0);
+
+    u3z(u3m_soft(0, _alloc_loop, c3y));
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mil_w = (d0.tv_sec * 1000) + (d0.tv_usec / 1000);
+    fprintf(stderr, "  alloc slabs: %u ms (%" PRIu64 " allocs/s)\r\n",
+                    mil_w, (num_d * 1000) / c3_max(1, mil_w));
+  }
+}
+
+/* _peek_fake(): scry-shaped read: list and relist a map in [sam].
+*/
+static u3_noun
+_peek_fake(u3_noun sam)
+{
+  c3_w i_w, len_w = 0;
+
+  for ( i_w = 0; i_w < 8; i_w++ ) {
+    u3_noun lit = u3kb_flop(u3qdb_tap(sam));
+    len_w += u3kb_lent(u3kb_weld(lit, u3qdb_tap(sam)));
+  }
+
+  return len_w;
+}
+
+static void
+_peek_bench(void)
+{
+  struct timeval b4, f2, d0;
+  c3_w  mil_w, i_w, max_w = 5000;
+  u3_noun sam = u3_nul;
+
+  for ( i_w = 0; i_w < 1024; i_w++ ) {
+    sam = u3kdb_put(sam, u3i_word(i_w * 7919), u3nc(i_w, u3_nul));
+  }
+
+  fprintf(stderr, "\r\npeek road microbenchmark:\r\n");
+
+  {
+    gettimeofday(&b4, 0);
+
+    for ( i_w = 0; i_w < max_w; i_w++ ) {
+      u3z(u3m_soft(0, _peek_fake, u3k(sam)));
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mil_w = (d0.tv_sec * 1000) + (d0.tv_usec / 1000);
+    fprintf(stderr, "  peek normal: %u ms (%u peeks/s)\r\n",
+                    mil_w, (max_w * 1000) / c3_max(1, mil_w));
+  }
+
+  {
+    gettimeofday(&b4, 0);
+
+    for ( i_w = 0; i_w < max_w; i_w++ ) {
+      u3z(u3m_soft_sand(0, _peek_fake, u3k(sam)));
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mil_w = (d0.tv_sec * 1000) + (d0.tv_usec / 1000);
+    fprintf(stderr, "  peek sand: %u ms (%u peeks/s)\r\n",
+                    mil_w, (max_w * 1000) / c3_max(1, mil_w));
+  }
+
+  u3z(sam);
+}
+
+/* _fuse_core(): [[loop inc get] n m], a loop shaped like compiled hoon:
+**               it counts n up to m under a spot hint and an ignored
+**               hint clue, kicking inc on the subject, get through a
+**               fragment, and itself with an edited sample.
+*/
+static u3_noun
+_fuse_core(c3_w max_w)
+{
+  u3_noun inc = u3nc(4, u3nc(0, 6));
+  u3_noun get = u3nc(0, 7);
+  u3_noun lup = u3nt(9, 4, u3nt(10, u3nt(6, 0, 6), u3nc(0, 7)));
+  u3_noun tes = u3nt(5, u3nc(0, 6), u3nt(9, 11, u3nc(0, 7)));
+  u3_noun ife = u3nq(6, tes, u3nt(9, 11, u3nc(0, 7)), lup);
+  u3_noun bod = u3nt(8, u3nt(9, 10, u3nc(0, 1)), u3nt(8, u3nc(1, 0), ife));
+  u3_noun hin = u3nt(11, u3nt(c3__germ, 1, 0), bod);
+  u3_noun arm = u3nt(11, u3nt(c3__spot, 1, u3nc(0, 0)), hin);
+
+  return u3nt(u3nt(arm, inc, get), 0, max_w);
+}
+
+/* _fuse_loop(): run the loop in [cor] to completion.
+*/
+static u3_noun
+_fuse_loop(u3_noun cor)
+{
+  return u3n_nock_on(u3nc(u3nc(cor, 0), 0), u3nt(9, 4, u3nc(0, 4)));
+}
+
+static void
+_fuse_bench(void)
+{
+  struct timeval b4, f2, d0;
+  c3_w  mil_w, i_w, max_w = 200;
+  u3_noun cor = _fuse_core(10000);
+  //  per run: the outer formula, plus loop, inc and get per iteration
+  //
+  c3_d  nox_d = (c3_d)max_w * (1 + (3 * 10000));
+
+  fprintf(stderr, "\r\nnock superinstruction microbenchmark:\r\n");
+
+  //  each run is a fresh road, like an event
+  //
+  {
+    u3C.wag_w |= u3o_no_fuse;
+    gettimeofday(&b4, 0);
+
+    for ( i_w = 0; i_w < max_w; i_w++ ) {
+      u3z(u3m_soft(0, _fuse_loop, u3k(cor)));
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mil_w = (d0.tv_sec * 1000) + (d0.tv_usec / 1000);
+    fprintf(stderr, "  nock unfused: %u ms (%" PRIu64 " steps/s)\r\n",
+                    mil_w, (nox_d * 1000) / c3_max(1, mil_w));
+  }
+
+  {
+    u3C.wag_w &= ~u3o_no_fuse;
+    gettimeofday(&b4, 0);
+
+    for ( i_w = 0; i_w < max_w; i_w++ ) {
+      u3z(u3m_soft(0, _fuse_loop, u3k(cor)));
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mil_w = (d0.tv_sec * 1000) + (d0.tv_usec / 1000);
+    fprintf(stderr, "  nock fused: %u ms (%" PRIu64 " steps/s)\r\n",
+                    mil_w, (nox_d * 1000) / c3_max(1, mil_w));
+  }
+
+  u3z(cor);
+}
+
+/* _kick_core(): [loop n m t], where t is a tuple of [len_w] static
+**               cores, each registered for jets under its own name.
+**               the loop kicks the head of t at a single call site,
+**               then rotates t, until n reaches m.
+*/
+static u3_noun
+_kick_core(c3_w len_w, c3_w max_w)
+{
+  c3_w    axe_w[8], bas_w = 15, i_w;
+  u3_noun tup, rot;
+
+  u3_assert( (0 < len_w) && (8 >= len_w) );
+
+  //  axes of t's elements in the loop core
+  //
+  for ( i_w = 0; i_w < len_w - 1; i_w++ ) {
+    axe_w[i_w] = u3x_peg(bas_w, 2);
+    bas_w      = u3x_peg(bas_w, 3);
+  }
+  axe_w[len_w - 1] = bas_w;
+
+  //  t, and its rotation, built from [res loop] (so pegged under 3)
+  //
+  tup = u3_none;
+  rot = u3nc(0, u3x_peg(3, axe_w[0]));
+
+  for ( i_w = len_w; i_w-- > 0; ) {
+    u3_noun cor = u3nc(u3nc(1, i_w), 0);
+    c3_c    nam_c[8];
+
+    snprintf(nam_c, sizeof(nam_c), "kick%c", 'a' + i_w);
+    u3j_mine(u3nt(u3i_string(nam_c), u3nc(1, 0), u3_nul), u3k(cor));
+
+    tup = ( u3_none == tup ) ? cor : u3nc(cor, tup);
+
+    if ( 0 != i_w ) {
+      rot = u3nc(u3nc(0, u3x_peg(3, axe_w[i_w])), rot);
+    }
+  }
+
+  {
+    u3_noun nex = u3nt(2, u3nt(10, u3nt(6, 4, u3nc(0, 14)),
+                                   u3nt(10, u3nc(15, rot), u3nc(0, 3))),
+                          u3nc(0, 6));
+    u3_noun bod = u3nt(8, u3nt(9, 2, u3nc(0, axe_w[0])), nex);
+    u3_noun arm = u3nq(6, u3nt(5, u3nc(0, 6), u3nc(0, 14)), u3nc(0, 6), bod);
+
+    return u3nq(arm, 0, max_w, tup);
+  }
+}
+
+/* _kick_loop(): run the loop in [cor] to completion.
+*/
+static u3_noun
+_kick_loop(u3_noun cor)
+{
+  return u3n_nock_on(cor, u3nc(2, u3nc(u3nc(0, 1), u3nc(0, 2))));
+}
+
+/* _kick_time(): time [max_w] runs of the loop in [cor] in fresh roads.
+*/
+static void
+_kick_time(c3_c* cap_c, u3_noun cor, c3_w max_w, c3_d kic_d)
+{
+  struct timeval b4, f2, d0;
+  c3_w mil_w, i_w;
+
+  gettimeofday(&b4, 0);
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    u3z(u3m_soft(0, _kick_loop, u3k(cor)));
+  }
+
+  gettimeofday(&f2, 0);
+  timersub(&f2, &b4, &d0);
+  mil_w = (d0.tv_sec * 1000) + (d0.tv_usec / 1000);
+  fprintf(stderr, "  %s: %u ms (%" PRIu64 " kicks/s)\r\n",
+                  cap_c, mil_w, (kic_d * max_w * 1000) / c3_max(1, mil_w));
+}
+
+static void
+_kick_bench(void)
+{
+  c3_w    max_w = 20, len_w = 100000;
+  u3_noun mon = _kick_core(1, len_w);
+  u3_noun pol = _kick_core(4, len_w);
+
+  fprintf(stderr, "\r\njet dispatch microbenchmark:\r\n");
+
+  _kick_time("site monomorphic", mon, max_w, len_w);
+
+  u3C.wag_w |= u3o_no_poly;
+  _kick_time("site 4 batteries, one entry", pol, max_w, len_w);
+
+  u3C.wag_w &= ~u3o_no_poly;
+  u3t_Site = (u3t_site){0};
+  _kick_time("site 4 batteries, 4 entries", pol, max_w, len_w);
+  fprintf(stderr, "  spare hits %" PRIu64 ", misses %" PRIu64 "\r\n",
+                  u3t_Site.hit_d, u3t_Site.mis_d);
+
+  u3z(mon);
+  u3z(pol);
+}
+
+/* _side_formula(): generate a distinct formula, [dep_w] branches deep.
+*/
+static u3_noun
+_side_formula(c3_w i_w, c3_w dep_w)
+{
+  u3_noun fol = u3nc(1, i_w);
+
+  while ( dep_w ) {
+    u3_noun tes = u3nt(5, u3nc(0, 2), u3nc(1, dep_w));
+    u3_noun yes = u3nc(4, u3nc(0, 2));
+    u3_noun no  = u3nt(7, u3nc(0, 3), u3nc(1, dep_w--));
+
+    fol = u3nt(8, fol, u3nq(6, tes, yes, no));
+  }
+
+  return fol;
+}
+
+/* _side_time(): time bytecode cache misses for [fol].
+*/
+static void
+_side_time(c3_c* cap_c, u3_noun fol)
+{
+  struct timeval b4, f2, d0;
+  c3_w  mic_w, len_w = u3qb_lent(fol);
+  u3_noun t;
+
+  gettimeofday(&b4, 0);
+
+  for ( t = fol; u3_nul != t; t = u3t(t) ) {
+    u3n_find(u3_nul, u3h(t));
+  }
+
+  gettimeofday(&f2, 0);
+  timersub(&f2, &b4, &d0);
+  mic_w = (d0.tv_sec * 1000000) + d0.tv_usec;
+  fprintf(stderr, "  %s: %u us (%u us/formula)\r\n",
+                  cap_c, mic_w, mic_w / c3_max(1, len_w));
+}
+
+/* _side_bench(): compare bytecode compilation to sidecar loading.
+*/
+static void
+_side_bench(void)
+{
+  c3_c  dir_c[] = "/tmp/vere-bench-XXXXXX";
+  c3_c  pax_c[sizeof(dir_c) + 32];
+  c3_c* old_c = u3P.dir_c;
+  c3_w  i_w, max_w = 2000;
+  u3_noun fol = u3_nul;
+
+  fprintf(stderr, "\r\nbytecode sidecar microbenchmark:\r\n");
+
+  if ( !mkdtemp(dir_c) ) {
+    fprintf(stderr, "  mkdtemp: %s\r\n", strerror(errno));
+    return;
+  }
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    fol = u3nc(_side_formula(i_w, 40), fol);
+  }
+
+  //  compile with no sidecar, then spill on reclaim
+  //
+  u3n_reclaim();
+  _side_time("compile", fol);
+
+  snprintf(pax_c, sizeof(pax_c), "%s/.urb", dir_c);
+  c3_mkdir(pax_c, 0700);
+  snprintf(pax_c, sizeof(pax_c), "%s/.urb/chk", dir_c);
+  c3_mkdir(pax_c, 0700);
+  u3P.dir_c = dir_c;
+
+  u3n_reclaim();
+  _side_time("load", fol);
+
+  u3n_reclaim();
+  u3P.dir_c = old_c;
+
+  snprintf(pax_c, sizeof(pax_c), "%s/.urb/chk/bytecode.bin", dir_c);
+  c3_unlink(pax_c);
+  snprintf(pax_c, sizeof(pax_c), "%s/.urb/chk", dir_c);
+  c3_rmdir(pax_c);
+  snprintf(pax_c, sizeof(pax_c), "%s/.urb", dir_c);
+  c3_rmdir(pax_c);
+  c3_rmdir(dir_c);
+
+  u3z(fol);
+}
+
+/* _memo_find_up(): u3z_find() for the persistent cache, searching
+**                  from the current road up to home.
+*/
+static u3_weak
+_memo_find_up(u3_noun key)
+{
+  u3a_road* rod_u = u3R;
+
+  while ( 1 ) {
+    u3_weak got = u3h_get(rod_u->cax.per_p, key);
+
+    if ( (u3_none != got) || (0 == rod_u->par_p) ) {
+      return got;
+    }
+    rod_u = u3to(u3a_road, rod_u->par_p);
+  }
+}
+
+/* _memo_time(): time [max_w] passes of [len_w] persistent lookups,
+**               from [off_w], in both directions.
+*/
+static void
+_memo_time(c3_c* cap_c, c3_w off_w, c3_w len_w, c3_w max_w)
+{
+  struct timeval b4, f2, d0;
+  c3_w  mic_w, i_w, j_w;
+  c3_d  num_d = (c3_d)len_w * max_w;
+
+  {
+    gettimeofday(&b4, 0);
+
+    for ( i_w = 0; i_w < max_w; i_w++ ) {
+      for ( j_w = 0; j_w < len_w; j_w++ ) {
+        u3z(u3z_find_m(u3z_memo_keep, c3__test, off_w + j_w));
+      }
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mic_w = (d0.tv_sec * 1000000) + d0.tv_usec;
+    fprintf(stderr, "  %s, down: %" PRIu64 " ns/find\r\n",
+                    cap_c, ((c3_d)mic_w * 1000) / num_d);
+  }
+
+  {
+    gettimeofday(&b4, 0);
+
+    for ( i_w = 0; i_w < max_w; i_w++ ) {
+      for ( j_w = 0; j_w < len_w; j_w++ ) {
+        u3_noun key = u3nc(c3__test, off_w + j_w);
+        u3z(_memo_find_up(key));
+        u3z(key);
+      }
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mic_w = (d0.tv_sec * 1000000) + d0.tv_usec;
+    fprintf(stderr, "  %s, up: %" PRIu64 " ns/find\r\n",
+                    cap_c, ((c3_d)mic_w * 1000) / num_d);
+  }
+}
+
+/* _memo_dive(): descend [dep_w] roads, then time lookups of entries
+**               at home, on top, and nowhere.  top entries are reaped
+**               home on the way out, so each depth uses fresh keys.
+*/
+static void
+_memo_dive(c3_w dep_w, c3_w len_w)
+{
+  if ( dep_w ) {
+    //  bare leap, as u3m_soft() pads each road by 4MB
+    //
+    u3m_hate(1 << 12);
+    _memo_dive(dep_w - 1, len_w);
+    u3z(u3m_love(u3_nul));
+  }
+  else {
+    c3_w   i_w;
+    c3_w   max_w = 200;
+    c3_c   cap_c[64];
+    c3_w   lev_w = 0;
+
+    for ( u3a_road* rod_u = u3R; rod_u->par_p; lev_w++ ) {
+      rod_u = u3to(u3a_road, rod_u->par_p);
+    }
+
+    c3_w   top_w = len_w * 2 * lev_w;
+
+    for ( i_w = 0; i_w < len_w; i_w++ ) {
+      u3z_save_m(u3z_memo_keep, c3__test, top_w + i_w, i_w);
+    }
+
+    snprintf(cap_c, sizeof(cap_c), "depth %u, hit at home", lev_w);
+    _memo_time(cap_c, 0, len_w, max_w);
+
+    snprintf(cap_c, sizeof(cap_c), "depth %u, hit at top", lev_w);
+    _memo_time(cap_c, top_w, len_w, max_w);
+
+    snprintf(cap_c, sizeof(cap_c), "depth %u, miss", lev_w);
+    _memo_time(cap_c, top_w + len_w, len_w, max_w);
+  }
+}
+
+/* _memo_bench(): persistent memo lookups, from nested roads.
+*/
+static void
+_memo_bench(void)
+{
+  c3_w len_w = 1000;
+  c3_w i_w;
+
+  fprintf(stderr, "\r\npersistent memo search microbenchmark:\r\n");
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    u3z_save_m(u3z_memo_keep, c3__test, i_w, i_w);
+  }
+
+  _memo_dive(1, len_w);
+  _memo_dive(4, len_w);
+  _memo_dive(16, len_w);
+
+  u3z_free(u3z_memo_keep);
+}
+
+/* _log_save_f: event store append, as timed.
+*/
+typedef c3_o (*_log_save_f)(void*, c3_d, c3_d, void**, size_t*);
+
+static c3_o
+_log_lmdb_save(void* ptr_v, c3_d eve_d, c3_d len_d, void** byt_p, size_t* siz_i)
+{
+  return u3_lmdb_save(ptr_v, eve_d, len_d, byt_p, siz_i);
+}
+
+static c3_o
+_log_book_save(void* ptr_v, c3_d eve_d, c3_d len_d, void** byt_p, size_t* siz_i)
+{
+  return u3_book_save(ptr_v, eve_d, len_d, byt_p, siz_i);
+}
+
+static c3_i
+_log_cmp(const void* a_v, const void* b_v)
+{
+  c3_d a_d = *(const c3_d*)a_v;
+  c3_d b_d = *(const c3_d*)b_v;
+
+  return ( a_d < b_d ) ? -1 : ( a_d > b_d ) ? 1 : 0;
+}
+
+/* _log_time(): time [num_w] commits of [len_w] [siz_w]-byte events.
+*/
+static void
+_log_time(c3_c*       cap_c,
+          void*       ptr_v,
+          _log_save_f sav_f,
+          c3_d*       eve_d,
+          c3_w        num_w,
+          c3_w        len_w,
+          c3_w        siz_w)
+{
+  struct timeval b4, f2, d0, t0, t1;
+  c3_d*   lat_d = c3_malloc(num_w * sizeof(c3_d));
+  void**  byt_p = c3_malloc(len_w * sizeof(void*));
+  size_t* siz_i = c3_malloc(len_w * sizeof(size_t));
+  c3_y*   dat_y = c3_malloc(siz_w);
+  c3_d    mic_d, sum_d = 0;
+  c3_w    i_w;
+
+  for ( i_w = 0; i_w < siz_w; i_w++ ) {
+    dat_y[i_w] = (c3_y)(i_w * 0x9e);
+  }
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    byt_p[i_w] = dat_y;
+    siz_i[i_w] = siz_w;
+  }
+
+  gettimeofday(&b4, 0);
+
+  for ( i_w = 0; i_w < num_w; i_w++ ) {
+    gettimeofday(&t0, 0);
+
+    if ( c3n == sav_f(ptr_v, *eve_d, len_w, byt_p, siz_i) ) {
+      fprintf(stderr, "  %s: save failed\r\n", cap_c);
+      goto done;
+    }
+
+    gettimeofday(&t1, 0);
+    timersub(&t1, &t0, &d0);
+    lat_d[i_w] = (d0.tv_sec * 1000000) + d0.tv_usec;
+    sum_d += lat_d[i_w];
+    *eve_d += len_w;
+  }
+
+  gettimeofday(&f2, 0);
+  timersub(&f2, &b4, &d0);
+  mic_d = c3_max(1, (d0.tv_sec * 1000000) + d0.tv_usec);
+
+  qsort(lat_d, num_w, sizeof(c3_d), _log_cmp);
+
+  fprintf(stderr, "  %s: %" PRIu64 " events/s, %" PRIu64 " KB/s;"
+                  " commit mean %" PRIu64 " us, p99 %" PRIu64 " us\r\n",
+                  cap_c,
+                  ((c3_d)num_w * len_w * 1000000) / mic_d,
+                  ((c3_d)num_w * len_w * siz_w * 1000000) / (mic_d * 1024),
+                  sum_d / num_w,
+                  lat_d[(num_w * 99) / 100]);
+
+done:
+  c3_free(dat_y);
+  c3_free(siz_i);
+  c3_free(byt_p);
+  c3_free(lat_d);
+}
+
+/* _log_wipe(): delete a flat directory.
+*/
+static void
+_log_wipe(const c3_c* pax_c)
+{
+  DIR*           dir_u = opendir(pax_c);
+  struct dirent* den_u;
+  c3_c           fil_c[8193];
+
+  if ( !dir_u ) {
+    return;
+  }
+
+  while ( (den_u = readdir(dir_u)) ) {
+    if ( '.' != den_u->d_name[0] ) {
+      snprintf(fil_c, sizeof(fil_c), "%s/%s", pax_c, den_u->d_name);
+      unlink(fil_c);
+    }
+  }
+
+  closedir(dir_u);
+  rmdir(pax_c);
+}
+
+/* _log_bench(): event store append throughput and commit latency.
+**
+**   runs in the working directory, as /tmp is often a tmpfs,
+**   where a data sync costs nothing.
+*/
+static void
+_log_bench(void)
+{
+  c3_c     tem_c[] = "log-bench-XXXXXX";
+  c3_c     mdb_c[64], bok_c[64];
+  MDB_env* mdb_u;
+  u3_book* bok_u;
+  c3_d     mdb_d = 1, bok_d = 1;
+
+  fprintf(stderr, "\r\nevent log append microbenchmark:\r\n");
+
+  if ( !mkdtemp(tem_c) ) {
+    fprintf(stderr, "  mkdtemp: %s\r\n", strerror(errno));
+    return;
+  }
+
+  snprintf(mdb_c, sizeof(mdb_c), "%s/lmdb", tem_c);
+  snprintf(bok_c, sizeof(bok_c), "%s/book", tem_c);
+  mkdir(mdb_c, 0700);
+
+  if ( !(mdb_u = u3_lmdb_init(mdb_c, (size_t)1 << 30)) ) {
+    _log_wipe(mdb_c);
+    _log_wipe(tem_c);
+    return;
+  }
+
+  if ( !(bok_u = u3_book_init(bok_c, c3n)) ) {
+    u3_lmdb_exit(mdb_u);
+    _log_wipe(mdb_c);
+    _log_wipe(tem_c);
+    return;
+  }
+
+  _log_time("lmdb, 1 x 128B/commit", mdb_u, _log_lmdb_save, &mdb_d, 1000, 1, 128);
+  _log_time("book, 1 x 128B/commit", bok_u, _log_book_save, &bok_d, 1000, 1, 128);
+
+  _log_time("lmdb, 1 x 16KB/commit", mdb_u, _log_lmdb_save, &mdb_d, 1000, 1, 16384);
+  _log_time("book, 1 x 16KB/commit", bok_u, _log_book_save, &bok_d, 1000, 1, 16384);
+
+  _log_time("lmdb, 100 x 128B/commit", mdb_u, _log_lmdb_save, &mdb_d, 200, 100, 128);
+  _log_time("book, 100 x 128B/commit", bok_u, _log_book_save, &bok_d, 200, 100, 128);
+
+  u3_book_exit(bok_u);
+  u3_lmdb_exit(mdb_u);
+
+  _log_wipe(bok_c);
+  _log_wipe(mdb_c);
+  _log_wipe(tem_c);
+}
+
+/* _zip_event(): jam an ames- or http-like event [i_w].
+*/
+static size_t
+_zip_event(c3_w i_w, c3_y** byt_y)
+{
+  u3_noun wen, ovo;
+  c3_d    len_d;
+
+  {
+    struct timeval tim_u;
+    gettimeofday(&tim_u, 0);
+    wen = u3_time_in_tv(&tim_u);
+  }
+
+  //  an ames packet is mostly ciphertext
+  //
+  if ( i_w & 1 ) {
+    c3_y bod_y[96];
+    c3_d val_d = (i_w + 1) * 0x9e3779b97f4a7c15ULL;
+    c3_w j_w;
+
+    memcpy(bod_y, "\x30\x90\x2d\x00\x00\x00\x01\x00\x09\xc0\xd0", 11);
+
+    for ( j_w = 11; j_w < sizeof(bod_y); j_w++ ) {
+      val_d ^= val_d << 13;
+      val_d ^= val_d >> 7;
+      val_d ^= val_d << 17;
+      bod_y[j_w] = (c3_y)val_d;
+    }
+
+    ovo = u3nc(u3nc(u3_blip, u3nt(c3__ames, 0x1234, u3_nul)),
+               u3nt(c3__hear, u3nc(0, 1), u3i_bytes(sizeof(bod_y), bod_y)));
+  }
+  //  an http request is mostly boilerplate
+  //
+  else {
+    c3_c url_c[64], bod_c[256];
+    c3_w bod_w;
+    u3_noun hed, req;
+
+    snprintf(url_c, sizeof(url_c), "/~/channel/1697%05u-%06x",
+                    i_w / 64, (i_w * 2654435761U) & 0xffffff);
+    bod_w = snprintf(bod_c, sizeof(bod_c),
+                     "[{\"id\":%u,\"action\":\"poke\",\"ship\":"
+                     "\"sampel-palnet\",\"app\":\"hood\",\"mark\":"
+                     "\"helm-hi\",\"json\":\"message %u\"}]", i_w, i_w * 7);
+
+    hed = u3nt(u3nc(u3i_string("host"),
+                    u3i_string("sampel-palnet.arvo.network")),
+               u3nc(u3i_string("cookie"),
+                    u3i_string("urbauth-~sampel-palnet=0v3.j2a8e.ouq9l")),
+               u3nc(u3nc(u3i_string("content-type"),
+                         u3i_string("application/json")),
+                    u3_nul));
+    req = u3nq(u3i_string("PUT"), u3i_string(url_c), hed,
+               u3nc(u3_nul, u3nc(bod_w, u3i_bytes(bod_w, (c3_y*)bod_c))));
+
+    ovo = u3nc(u3nc(u3_blip, u3nt(c3__http, 0x1234 + (i_w & 0xff), u3_nul)),
+               u3nq(u3i_string("request"), c3y,
+                    u3nc(c3__ipv4, 0x7f000001), req));
+  }
+
+  {
+    u3_noun eve = u3nc(wen, ovo);
+    u3s_jam_xeno(eve, &len_d, byt_y);
+    u3z(eve);
+  }
+
+  return len_d;
+}
+
+/* _zip_bench(): event compression ratio, and its cost on replay.
+*/
+static void
+_zip_bench(void)
+{
+  struct timeval b4, f2, d0;
+  c3_w     i_w, max_w = 4096, hal_w = max_w / 2;
+  c3_y**   byt_y = c3_malloc(max_w * sizeof(*byt_y));
+  size_t*  siz_i = c3_malloc(max_w * sizeof(*siz_i));
+  c3_y**   pac_y = c3_malloc(hal_w * sizeof(*pac_y));
+  size_t*  pac_i = c3_malloc(hal_w * sizeof(*pac_i));
+  c3_y*    dic_y = c3_malloc(u3_dict_max);
+  c3_y*    out_y = c3_malloc(1 << 16);
+  size_t   raw_i = 0, zip_i = 0, nul_i = 0, out_i;
+  c3_w     dic_w;
+  u3_dict* dit_u;
+  u3_dict* nul_u;
+
+  fprintf(stderr, "\r\nevent log compression microbenchmark:\r\n");
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    siz_i[i_w] = _zip_event(i_w, &byt_y[i_w]);
+  }
+
+  //  train on the first half, measure on the second
+  //
+  {
+    gettimeofday(&b4, 0);
+    dic_w = u3_dict_train(hal_w, byt_y, siz_i, dic_y, u3_dict_max);
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+
+    fprintf(stderr, "  train: %u-byte dictionary from %u events in %"
+                    PRIu64 " ms\r\n", dic_w, hal_w,
+                    (c3_d)(d0.tv_sec * 1000) + (d0.tv_usec / 1000));
+  }
+
+  dit_u = u3_dict_init(dic_y, dic_w);
+  nul_u = u3_dict_init(dic_y, 0);
+
+  {
+    gettimeofday(&b4, 0);
+
+    for ( i_w = 0; i_w < hal_w; i_w++ ) {
+      size_t len_i = siz_i[hal_w + i_w];
+
+      pac_i[i_w] = 1 << 16;
+      pac_y[i_w] = c3_malloc(pac_i[i_w]);
+      u3_assert( c3y == u3_dict_pack(dit_u, len_i, byt_y[hal_w + i_w],
+                                     pac_y[i_w], &pac_i[i_w]) );
+      raw_i += len_i;
+      zip_i += pac_i[i_w];
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+
+    for ( i_w = 0; i_w < hal_w; i_w++ ) {
+      out_i = 1 << 16;
+      u3_assert( c3y == u3_dict_pack(nul_u, siz_i[hal_w + i_w],
+                                     byt_y[hal_w + i_w], out_y, &out_i) );
+      nul_i += out_i;
+    }
+
+    fprintf(stderr, "  ratio: %.2fx with dictionary, %.2fx without"
+                    " (%zu bytes raw)\r\n",
+                    (double)raw_i / zip_i, (double)raw_i / nul_i, raw_i);
+    fprintf(stderr, "  pack: %" PRIu64 " ns/event\r\n",
+                    ((c3_d)((d0.tv_sec * 1000000) + d0.tv_usec) * 1000) / hal_w);
+  }
+
+  //  replay: cue alone, and unpack before cue
+  //
+  {
+    gettimeofday(&b4, 0);
+
+    for ( i_w = 0; i_w < hal_w; i_w++ ) {
+      u3z(u3s_cue_xeno(siz_i[hal_w + i_w], byt_y[hal_w + i_w]));
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    fprintf(stderr, "  replay, cue: %" PRIu64 " ns/event\r\n",
+                    ((c3_d)((d0.tv_sec * 1000000) + d0.tv_usec) * 1000) / hal_w);
+  }
+
+  {
+    gettimeofday(&b4, 0);
+
+    for ( i_w = 0; i_w < hal_w; i_w++ ) {
+      size_t len_i = siz_i[hal_w + i_w];
+
+      u3_assert( c3y == u3_dict_unpack(dit_u, pac_i[i_w], pac_y[i_w],
+                                       len_i, out_y) );
+      u3z(u3s_cue_xeno(len_i, out_y));
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    fprintf(stderr, "  replay, unpack and cue: %" PRIu64 " ns/event\r\n",
+                    ((c3_d)((d0.tv_sec * 1000000) + d0.tv_usec) * 1000) / hal_w);
+  }
+
+  for ( i_w = 0; i_w < hal_w; i_w++ ) {
+    c3_free(pac_y[i_w]);
+  }
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    c3_free(byt_y[i_w]);
+  }
+
+  u3_dict_free(nul_u);
+  u3_dict_free(dit_u);
+  c3_free(out_y);
+  c3_free(dic_y);
+  c3_free(pac_i);
+  c3_free(pac_y);
+  c3_free(siz_i);
+  c3_free(byt_y);
+}
+
+/* _sort_gate(): a gate ordering 16-bit lists, most significant first,
+**               as +lth, unrolled so as to cost little more than a jet.
+*/
+static u3_noun
+_sort_gate(void)
+{
+  c3_w    a_w[16], b_w[16], i_w;
+  c3_w    ata_w = 12, atb_w = 13;
+  u3_noun fol = u3nc(1, c3n);
+
+  for ( i_w = 0; i_w < 16; i_w++ ) {
+    a_w[i_w] = u3x_peg(ata_w, 2);
+    b_w[i_w] = u3x_peg(atb_w, 2);
+    ata_w    = u3x_peg(ata_w, 3);
+    atb_w    = u3x_peg(atb_w, 3);
+  }
+
+  for ( i_w = 16; i_w-- > 0; ) {
+    u3_noun tes = u3nt(5, u3nc(0, a_w[i_w]), u3nc(0, b_w[i_w]));
+    u3_noun dif = u3nt(5, u3nc(0, a_w[i_w]), u3nc(1, 0));
+
+    fol = u3nq(6, tes, fol, dif);
+  }
+
+  return u3nt(fol, u3nc(0, 0), 0);
+}
+
+/* _sort_loop(): sort the list in [sam] with the gate.
+*/
+static u3_noun
+_sort_loop(u3_noun sam)
+{
+  u3_noun pro = u3qb_sort(u3h(sam), u3t(sam));
+  u3z(sam);
+  return pro;
+}
+
+static c3_w
+_sort_asc(c3_w i_w, c3_w len_w)
+{
+  return (c3_w)(((c3_d)i_w << 16) / len_w);
+}
+
+static c3_w
+_sort_des(c3_w i_w, c3_w len_w)
+{
+  return _sort_asc(len_w - 1 - i_w, len_w);
+}
+
+static c3_w
+_sort_ran(c3_w i_w, c3_w len_w)
+{
+  return (i_w * 2654435761U) >> 16;
+}
+
+/* _sort_time(): time sorting [len_w] of the 16-bit [key], as [ord_f].
+*/
+static void
+_sort_time(c3_c*    cap_c,
+           u3_noun* key,
+           c3_w     len_w,
+           c3_w     (*ord_f)(c3_w, c3_w))
+{
+  struct timeval b4, f2, d0;
+  u3_noun lis = u3_nul;
+  c3_w    i_w;
+  c3_d    mic_d;
+
+  for ( i_w = len_w; i_w-- > 0; ) {
+    lis = u3nc(u3k(key[ord_f(i_w, len_w)]), lis);
+  }
+
+  gettimeofday(&b4, 0);
+  u3z(u3m_soft(0, _sort_loop, u3nc(lis, _sort_gate())));
+  gettimeofday(&f2, 0);
+  timersub(&f2, &b4, &d0);
+  mic_d = (d0.tv_sec * 1000000) + d0.tv_usec;
+
+  fprintf(stderr, "  %s, %u: %" PRIu64 " ms (%" PRIu64 " ns/element)\r\n",
+                  cap_c, len_w, mic_d / 1000, (mic_d * 1000) / len_w);
+}
+
+/* _sort_bench(): +sort on presorted, reversed and random lists,
+**                 to 100k elements (1M with VERE_BENCH_LARGE).
+*/
+static void
+_sort_bench(void)
+{
+  u3_noun* key = c3_malloc((1 << 16) * sizeof(u3_noun));
+  c3_w     max_w = ( c3y == _large() ) ? 1000000 : 100000;
+  c3_w     len_w, i_w;
+
+  fprintf(stderr, "\r\n+sort microbenchmark:\r\n");
+
+  for ( i_w = 0; i_w < (1 << 16); i_w++ ) {
+    c3_w    j_w;
+    u3_noun bit = 0;
+
+    for ( j_w = 0; j_w < 16; j_w++ ) {
+      bit = u3nc((i_w >> j_w) & 1, bit);
+    }
+
+    key[i_w] = bit;
+  }
+
+  for ( len_w = 10000; len_w <= max_w; len_w *= 10 ) {
+    _sort_time("sorted", key, len_w, _sort_asc);
+    _sort_time("reversed", key, len_w, _sort_des);
+    _sort_time("random", key, len_w, _sort_ran);
+  }
+
+  for ( i_w = 0; i_w < (1 << 16); i_w++ ) {
+    u3z(key[i_w]);
+  }
+
+  c3_free(key);
+}
+
+/* _gas_put_loop(): build a map from the list in [sam], by +put.
+*/
+static u3_noun
+_gas_put_loop(u3_noun sam)
+{
+  u3_noun pro = u3_nul;
+  u3_noun t   = sam;
+
+  for ( ; u3_nul != t; t = u3t(t) ) {
+    u3_noun nex = u3qdb_put(pro, u3h(u3h(t)), u3t(u3h(t)));
+    u3z(pro);
+    pro = nex;
+  }
+
+  u3z(sam);
+  return pro;
+}
+
+/* _gas_loop(): build a map from the list in [sam], by +gas.
+*/
+static u3_noun
+_gas_loop(u3_noun sam)
+{
+  u3_noun pro = u3qdb_gas(u3_nul, sam);
+  u3z(sam);
+  return pro;
+}
+
+/* _gas_time(): time building a map of [len_w] entries with [fun_f].
+*/
+static void
+_gas_time(c3_c* cap_c, c3_w len_w, u3_funk fun_f)
+{
+  struct timeval b4, f2, d0;
+  u3_noun lis = u3_nul;
+  c3_w    i_w;
+  c3_d    mic_d;
+
+  for ( i_w = len_w; i_w-- > 0; ) {
+    lis = u3nc(u3nc((i_w * 2654435761U) & 0x7fffffff, i_w), lis);
+  }
+
+  gettimeofday(&b4, 0);
+  u3z(u3m_soft(0, fun_f, lis));
+  gettimeofday(&f2, 0);
+  timersub(&f2, &b4, &d0);
+  mic_d = (d0.tv_sec * 1000000) + d0.tv_usec;
+
+  fprintf(stderr, "  %s, %u: %" PRIu64 " ms (%" PRIu64 " ns/entry)\r\n",
+                  cap_c, len_w, mic_d / 1000, (mic_d * 1000) / len_w);
+}
+
+/* _gas_bench(): building maps, by +put and by +gas,
+**                to 100k entries (1M with VERE_BENCH_LARGE).
+*/
+static void
+_gas_bench(void)
+{
+  c3_w max_w = ( c3y == _large() ) ? 1000000 : 100000;
+  c3_w len_w;
+
+  fprintf(stderr, "\r\n+gas:by microbenchmark:\r\n");
+
+  for ( len_w = 1000; len_w <= max_w; len_w *= 10 ) {
+    _gas_time("put", len_w, _gas_put_loop);
+    _gas_time("gas", len_w, _gas_loop);
+  }
+}
+
+/* _bits_atom(): pseudorandom atom of exactly [len_w] words.
+*/
+static u3_atom
+_bits_atom(c3_w len_w, c3_d sed_d)
+{
+  u3i_slab sab_u;
+  c3_w     i_w;
+
+  u3i_slab_bare(&sab_u, 5, len_w);
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    sed_d ^= sed_d << 13;
+    sed_d ^= sed_d >> 7;
+    sed_d ^= sed_d << 17;
+    sab_u.buf_w[i_w] = (c3_w)sed_d;
+  }
+
+  sab_u.buf_w[len_w - 1] |= 0x80000000;
+
+  return u3i_slab_mint(&sab_u);
+}
+
+/* _bits_call(): apply bitwise jet [cap_c] to [a] and [b].
+*/
+static u3_noun
+_bits_call(c3_c* cap_c, u3_atom a, u3_atom b)
+{
+  if ( !strcmp("mix", cap_c) ) {
+    return u3qc_mix(a, b);
+  }
+  else if ( !strcmp("con", cap_c) ) {
+    return u3qc_con(a, b);
+  }
+  else if ( !strcmp("dis", cap_c) ) {
+    return u3qc_dis(a, b);
+  }
+  else if ( !strcmp("swp", cap_c) ) {
+    return u3qc_swp(3, a);
+  }
+  else if ( !strcmp("rsh", cap_c) ) {
+    return u3qc_rsh(5, 1, a);
+  }
+  else {
+    return u3qc_cut(0, 7, u3r_met(0, a) - 7, a);
+  }
+}
+
+/* _bits_time(): time bitwise jet [cap_c] on atoms of [len_w] words.
+*/
+static void
+_bits_time(c3_c* cap_c, c3_w len_w, u3_atom a, u3_atom b)
+{
+  struct timeval b4, f2, d0;
+  c3_w i_w, max_w = c3_max(1, (1 << 20) / len_w);
+  c3_d mic_d;
+
+  gettimeofday(&b4, 0);
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    u3z(_bits_call(cap_c, a, b));
+  }
+
+  gettimeofday(&f2, 0);
+  timersub(&f2, &b4, &d0);
+  mic_d = c3_max(1, (d0.tv_sec * 1000000) + d0.tv_usec);
+
+  fprintf(stderr, "  %s: %" PRIu64 " ns/op, %" PRIu64 " MB/s\r\n",
+                  cap_c,
+                  (mic_d * 1000) / max_w,
+                  (((c3_d)len_w << 2) * max_w) / mic_d);
+}
+
+/* _bits_bench(): bitwise atom jets, from one word to 256KB
+**                (64MB with VERE_BENCH_LARGE).
+*/
+static void
+_bits_bench(void)
+{
+  c3_w max_w = ( c3y == _large() ) ? (1 << 24) : (1 << 16);
+  c3_w len_w;
+
+  fprintf(stderr, "\r\nbitwise atom jets microbenchmark:\r\n");
+
+  for ( len_w = 1; len_w <= max_w; len_w <<= 4 ) {
+    u3_atom a = _bits_atom(len_w, 0x9e3779b97f4a7c15ULL);
+    u3_atom b = _bits_atom(len_w, 0xd1b54a32d192ed03ULL);
+
+    fprintf(stderr, " %u words:\r\n", len_w);
+    _bits_time("mix", len_w, a, b);
+    _bits_time("con", len_w, a, b);
+    _bits_time("dis", len_w, a, b);
+    _bits_time("swp", len_w, a, b);
+    _bits_time("rsh", len_w, a, b);
+    _bits_time("cut", len_w, a, b);
+
+    u3z(a); u3z(b);
+  }
+}
+
+/* _hash_time(): time crypto jet [fun_f] on sample [sam], [max_w] times.
+*/
+static void
+_hash_time(c3_c* cap_c, c3_w max_w, u3_noun sam, u3_noun (*fun_f)(u3_noun))
+{
+  struct timeval b4, f2, d0;
+  u3_noun cor = u3nt(0, sam, 0);
+  c3_w    i_w;
+  c3_d    mic_d;
+
+  gettimeofday(&b4, 0);
+
+  for ( i_w = 0; i_w < max_w; i_w++ ) {
+    u3z(fun_f(cor));
+  }
+
+  gettimeofday(&f2, 0);
+  timersub(&f2, &b4, &d0);
+  mic_d = (d0.tv_sec * 1000000) + d0.tv_usec;
+
+  fprintf(stderr, "  %s: %" PRIu64 " ns/call\r\n",
+                  cap_c, (mic_d * 1000) / max_w);
+
+  u3z(cor);
+}
+
+/* _hash_bench(): hashing and signature verification jets.
+*/
+static void
+_hash_bench(void)
+{
+  c3_w len_w;
+
+  fprintf(stderr, "\r\ncrypto jets microbenchmark:\r\n");
+
+  for ( len_w = 64; len_w <= (1 << 24); len_w <<= 4 ) {
+    u3_atom dat = _bits_atom(len_w >> 2, 0x9e3779b97f4a7c15ULL);
+    c3_w    max_w = c3_max(1, (1 << 26) / len_w);
+    c3_c    cap_c[32];
+
+    snprintf(cap_c, sizeof(cap_c), "shax, %u bytes", len_w);
+    _hash_time(cap_c, max_w, u3k(dat), u3we_shax);
+    snprintf(cap_c, sizeof(cap_c), "shay, %u bytes", len_w);
+    _hash_time(cap_c, max_w, u3nc(len_w, u3k(dat)), u3we_shay);
+    snprintf(cap_c, sizeof(cap_c), "keccak-256, %u bytes", len_w);
+    _hash_time(cap_c, max_w, u3nc(len_w, u3k(dat)), u3we_kecc256);
+
+    u3z(dat);
+  }
+
+  {
+    u3_atom sed = _bits_atom(8, 0xd1b54a32d192ed03ULL);
+    u3_atom msg = _bits_atom(32, 0x9e3779b97f4a7c15ULL);
+    u3_noun cor = u3nt(0, u3k(sed), 0);
+    u3_atom pub = u3wee_puck(cor);
+    u3_atom sig;
+
+    u3z(cor);
+    cor = u3nt(0, u3nc(u3k(msg), u3k(sed)), 0);
+    sig = u3wee_sign(cor);
+    u3z(cor);
+
+    _hash_time("veri, 128 bytes", 1000,
+               u3nt(sig, u3k(msg), u3k(pub)), u3wee_veri);
+
+    u3z(pub); u3z(msg); u3z(sed);
+  }
+}
+
+/* _newt_peer: one end of a benchmark stream pair.
+*/
+typedef struct _newt_peer {
+  u3_moat   mot_u;                      //  inbound
+  u3_mojo   moj_u;                      //  outbound
+  uv_loop_t lup_u;                      //  event loop
+  c3_w      got_w;                      //  replies received
+} _newt_peer;
+
+/* _newt_echo(): child pok_f; echo small messages, ack large ones.
+*/
+static void
+_newt_echo(void* ptr_v, c3_d len_d, c3_y* byt_y)
+{
+  _newt_peer* per_u = ptr_v;
+  c3_d        ack_d = ( 64 < len_d ) ? 8 : len_d;
+  c3_y*       cop_y = c3_malloc(ack_d);
+
+  memcpy(cop_y, byt_y, ack_d);
+  u3_newt_send(&per_u->moj_u, ack_d, cop_y);
+}
+
+/* _newt_gone(): child bal_f; the parent is done.
+*/
+static void
+_newt_gone(void* ptr_v, ssize_t err_i, const c3_c* err_c)
+{
+  _exit(0);
+}
+
+/* _newt_take(): parent pok_f; count a reply.
+*/
+static void
+_newt_take(void* ptr_v, c3_d len_d, c3_y* byt_y)
+{
+  _newt_peer* per_u = ptr_v;
+
+  per_u->got_w++;
+  uv_stop(&per_u->lup_u);
+}
+
+/* _newt_bail(): parent bal_f.
+*/
+static void
+_newt_bail(void* ptr_v, ssize_t err_i, const c3_c* err_c)
+{
+  if ( strlen(err_c) ) {
+    fprintf(stderr, "  newt: %s\r\n", err_c);
+    exit(1);
+  }
+}
+
+/* _newt_wait(): run until [got_w] replies have arrived.
+*/
+static void
+_newt_wait(_newt_peer* per_u, c3_w got_w)
+{
+  while ( per_u->got_w < got_w ) {
+    uv_run(&per_u->lup_u, UV_RUN_DEFAULT);
+  }
+}
+
+/* _newt_open(): attach [per_u] to descriptors, reading as [red_f].
+*/
+static void
+_newt_open(_newt_peer* per_u, c3_i inn_i, c3_i out_i, void (*red_f)(u3_moat*))
+{
+  uv_pipe_init(&per_u->lup_u, &per_u->mot_u.pyp_u, 0);
+  uv_pipe_open(&per_u->mot_u.pyp_u, inn_i);
+  uv_timer_init(&per_u->lup_u, &per_u->mot_u.tim_u);
+  uv_pipe_init(&per_u->lup_u, &per_u->moj_u.pyp_u, 0);
+  uv_pipe_open(&per_u->moj_u.pyp_u, out_i);
+
+  per_u->mot_u.ptr_v = per_u->moj_u.ptr_v = per_u;
+  red_f(&per_u->mot_u);
+}
+
+/* _newt_time(): king-to-serf round trips, over pipes or rings.
+**
+**   the child stands in for the serf, reading synchronously;
+**   the parent reads asynchronously, as the king does.
+*/
+static void
+_newt_time(c3_c* cap_c, c3_o rin_o)
+{
+  struct timeval b4, f2, d0;
+  _newt_peer per_u;
+  c3_i       kin_i[2], sin_i[2];
+  c3_i       fid_i = -1;
+  c3_w       i_w, pin_w = 20000, bat_w = 200;
+  c3_d       mic_d;
+  pid_t      pid_i;
+
+  memset(&per_u, 0, sizeof(per_u));
+
+  if ( pipe(kin_i) || pipe(sin_i) ) {
+    fprintf(stderr, "  %s: pipe: %s\r\n", cap_c, strerror(errno));
+    return;
+  }
+
+  if (  (c3y == rin_o)
+     && (0 > (fid_i = u3_newt_ring_make(&per_u.mot_u, &per_u.moj_u, 0))) )
+  {
+    return;
+  }
+
+  if ( 0 == (pid_i = fork()) ) {
+    close(kin_i[0]);
+    close(sin_i[1]);
+
+    memset(&per_u, 0, sizeof(per_u));
+    uv_loop_init(&per_u.lup_u);
+
+    if ( (0 <= fid_i) && (c3n == u3_newt_ring_join(&per_u.mot_u,
+                                                    &per_u.moj_u, fid_i)) )
+    {
+      _exit(1);
+    }
+
+    per_u.mot_u.pok_f = _newt_echo;
+    per_u.mot_u.bal_f = per_u.moj_u.bal_f = _newt_gone;
+    _newt_open(&per_u, sin_i[0], kin_i[1], u3_newt_read_sync);
+    uv_run(&per_u.lup_u, UV_RUN_DEFAULT);
+    _exit(0);
+  }
+
+  close(kin_i[1]);
+  close(sin_i[0]);
+
+  if ( 0 <= fid_i ) {
+    close(fid_i);
+  }
+
+  uv_loop_init(&per_u.lup_u);
+  per_u.mot_u.pok_f = _newt_take;
+  per_u.mot_u.bal_f = per_u.moj_u.bal_f = _newt_bail;
+  _newt_open(&per_u, kin_i[0], sin_i[1], u3_newt_read);
+
+  //  small messages, as for a peek
+  //
+  {
+    gettimeofday(&b4, 0);
+
+    for ( i_w = 0; i_w < pin_w; i_w++ ) {
+      c3_y* byt_y = c3_malloc(64);
+
+      memset(byt_y, (c3_y)i_w, 64);
+      u3_newt_send(&per_u.moj_u, 64, byt_y);
+      _newt_wait(&per_u, per_u.got_w + 1);
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mic_d = c3_max(1, (d0.tv_sec * 1000000) + d0.tv_usec);
+
+    fprintf(stderr, "  %s, 64B round trip: %" PRIu64 " ns\r\n",
+                    cap_c, (mic_d * 1000) / pin_w);
+  }
+
+  //  large acknowledged batches, as for %play
+  //
+  {
+    c3_d len_d = 1 << 20;
+
+    gettimeofday(&b4, 0);
+
+    for ( i_w = 0; i_w < bat_w; i_w++ ) {
+      c3_y* byt_y = c3_malloc(len_d);
+
+      memset(byt_y, (c3_y)i_w, len_d);
+      u3_newt_send(&per_u.moj_u, len_d, byt_y);
+      _newt_wait(&per_u, per_u.got_w + 1);
+    }
+
+    gettimeofday(&f2, 0);
+    timersub(&f2, &b4, &d0);
+    mic_d = c3_max(1, (d0.tv_sec * 1000000) + d0.tv_usec);
+
+    fprintf(stderr, "  %s, 1MB batch: %" PRIu64 " us, %" PRIu64 " MB/s\r\n",
+                    cap_c, mic_d / bat_w,
+                    ((c3_d)bat_w * 1000000) / mic_d);
+  }
+
+  u3_newt_moat_stop(&per_u.mot_u, 0);
+  u3_newt_mojo_stop(&per_u.moj_u, 0);
+  uv_run(&per_u.lup_u, UV_RUN_DEFAULT);
+  uv_loop_close(&per_u.lup_u);
+  waitpid(pid_i, 0, 0);
+}
+
+/* _newt_bench(): ipc latency and throughput, pipes against rings.
+*/
+static void
+_newt_bench(void)
+{
+  fprintf(stderr, "\r\nipc microbenchmark:\r\n");
+
+  _newt_time("pipe", c3n);
+  _newt_time("ring", c3y);
+}
+
 /* main(): run all benchmarks
 */
 int
@@ -453,9 +1968,23 @@ main(int argc, char* argv[])
   _setup();
 
   _jam_bench();
+  _etch_bench();
   _cue_bench();
   _cue_soft_bench();
   _edit_bench();
+  _alloc_bench();
+  _peek_bench();
+  _fuse_bench();
+  _kick_bench();
+  _side_bench();
+  _memo_bench();
+  _log_bench();
+  _zip_bench();
+  _newt_bench();
+  _sort_bench();
+  _gas_bench();
+  _bits_bench();
+  _hash_bench();
 
   //  GC
   //
@@ -0,0 +1,483 @@
+/// @file
+
+#include "db/book.h"
+#include "noun.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+static c3_c _dir_c[] = "/tmp/book-test-XXXXXX";
+
+/* _setup(): prepare for tests.
+*/
+static void
+_setup(void)
+{
+  if ( !mkdtemp(_dir_c) ) {
+    fprintf(stderr, "book test: mkdtemp: %s\r\n", strerror(errno));
+    exit(1);
+  }
+}
+
+/* _wipe(): delete a store directory.
+*/
+static void
+_wipe(const c3_c* pax_c)
+{
+  DIR*           dir_u = opendir(pax_c);
+  struct dirent* den_u;
+  c3_c           fil_c[8193];
+
+  if ( !dir_u ) {
+    return;
+  }
+
+  while ( (den_u = readdir(dir_u)) ) {
+    if ( '.' != den_u->d_name[0] ) {
+      snprintf(fil_c, sizeof(fil_c), "%s/%s", pax_c, den_u->d_name);
+      unlink(fil_c);
+    }
+  }
+
+  closedir(dir_u);
+  rmdir(pax_c);
+}
+
+/* _event(): deterministic payload for event [eve_d].
+*/
+static size_t
+_event(c3_d eve_d, c3_y* byt_y)
+{
+  size_t len_i = 1 + (eve_d % 301);
+  size_t i_i;
+
+  for ( i_i = 0; i_i < len_i; i_i++ ) {
+    byt_y[i_i] = (c3_y)(eve_d + i_i);
+  }
+
+  return len_i;
+}
+
+/* _save(): save [len_d] deterministic events starting at [eve_d].
+*/
+static c3_o
+_save(u3_book* bok_u, c3_d eve_d, c3_d len_d)
+{
+  void**  byt_p = c3_malloc(len_d * sizeof(void*));
+  size_t* siz_i = c3_malloc(len_d * sizeof(size_t));
+  c3_o    ret_o;
+  c3_d    i_d;
+
+  for ( i_d = 0; i_d < len_d; i_d++ ) {
+    byt_p[i_d] = c3_malloc(512);
+    siz_i[i_d] = _event(eve_d + i_d, byt_p[i_d]);
+  }
+
+  ret_o = u3_book_save(bok_u, eve_d, len_d, byt_p, siz_i);
+
+  for ( i_d = 0; i_d < len_d; i_d++ ) {
+    c3_free(byt_p[i_d]);
+  }
+
+  c3_free(byt_p);
+  c3_free(siz_i);
+
+  return ret_o;
+}
+
+/* _check_cb(): verify an event read back.
+*/
+static c3_o
+_check_cb(void* ptr_v, c3_d eve_d, size_t len_i, void* buf_v)
+{
+  c3_d* nex_d = ptr_v;
+  c3_y  byt_y[512];
+
+  if (  (*nex_d != eve_d)
+     || (len_i != _event(eve_d, byt_y))
+     || memcmp(byt_y, buf_v, len_i) )
+  {
+    fprintf(stderr, "book: mismatch at %" PRIu64 "\r\n", eve_d);
+    return c3n;
+  }
+
+  (*nex_d)++;
+  return c3y;
+}
+
+/* _check(): verify bounds and contents of a store.
+*/
+static c3_i
+_check(u3_book* bok_u, c3_d low_d, c3_d hig_d)
+{
+  c3_d fir_d, las_d, nex_d = low_d;
+
+  u3_book_gulf(bok_u, &fir_d, &las_d);
+
+  if ( (low_d != fir_d) || (hig_d != las_d) ) {
+    fprintf(stderr, "book: gulf %" PRIu64 "-%" PRIu64 ", expected %"
+                    PRIu64 "-%" PRIu64 "\r\n", fir_d, las_d, low_d, hig_d);
+    return 0;
+  }
+
+  if (  (c3n == u3_book_read(bok_u, &nex_d, low_d,
+                             (hig_d - low_d) + 1, _check_cb))
+     || (nex_d != hig_d + 1) )
+  {
+    return 0;
+  }
+
+  return 1;
+}
+
+/* _test_save_read(): round trip, with contiguity enforced.
+*/
+static c3_i
+_test_save_read(void)
+{
+  c3_c     pax_c[8193];
+  u3_book* bok_u;
+  c3_i     ret_i = 1;
+  c3_d     eve_d = 101;
+  c3_w     i_w;
+
+  snprintf(pax_c, sizeof(pax_c), "%s/save", _dir_c);
+
+  if ( !(bok_u = u3_book_init(pax_c, c3n)) ) {
+    fprintf(stderr, "book: init fail\r\n");
+    return 0;
+  }
+
+  for ( i_w = 1; i_w <= 100; i_w++ ) {
+    if ( c3n == _save(bok_u, eve_d, i_w) ) {
+      fprintf(stderr, "book: save fail at %" PRIu64 "\r\n", eve_d);
+      ret_i = 0;
+      break;
+    }
+
+    eve_d += i_w;
+  }
+
+  ret_i &= _check(bok_u, 101, eve_d - 1);
+
+  if ( c3y == _save(bok_u, eve_d + 1, 1) ) {
+    fprintf(stderr, "book: saved past a gap\r\n");
+    ret_i = 0;
+  }
+
+  if ( c3y == _save(bok_u, eve_d - 1, 1) ) {
+    fprintf(stderr, "book: overwrote an event\r\n");
+    ret_i = 0;
+  }
+
+  //  walk a subrange
+  //
+  {
+    u3_book_walk itr_u;
+    size_t       len_i;
+    void*        buf_v;
+    c3_d         nex_d = 200;
+
+    if ( c3n == u3_book_walk_init(bok_u, &itr_u, 200, 300) ) {
+      fprintf(stderr, "book: walk init fail\r\n");
+      ret_i = 0;
+    }
+    else {
+      while ( itr_u.nex_d <= itr_u.las_d ) {
+        c3_d cur_d = itr_u.nex_d;
+
+        if (  (c3n == u3_book_walk_next(&itr_u, &len_i, &buf_v))
+           || (c3n == _check_cb(&nex_d, cur_d, len_i, buf_v)) )
+        {
+          ret_i = 0;
+          break;
+        }
+      }
+
+      u3_book_walk_done(&itr_u);
+    }
+
+    if ( c3y == u3_book_walk_init(bok_u, &itr_u, eve_d, eve_d) ) {
+      fprintf(stderr, "book: walked past the end\r\n");
+      ret_i = 0;
+    }
+  }
+
+  u3_book_exit(bok_u);
+
+  //  reopen, and again with the index lost
+  //
+  if ( !(bok_u = u3_book_init(pax_c, c3n)) ) {
+    fprintf(stderr, "book: reopen fail\r\n");
+    return 0;
+  }
+
+  ret_i &= _check(bok_u, 101, eve_d - 1);
+  u3_book_exit(bok_u);
+
+  {
+    c3_c dex_c[8193];
+    snprintf(dex_c, sizeof(dex_c), "%s/%016" PRIx64 ".idx", pax_c, (c3_d)101);
+    unlink(dex_c);
+  }
+
+  if ( !(bok_u = u3_book_init(pax_c, c3n)) ) {
+    fprintf(stderr, "book: reindex fail\r\n");
+    return 0;
+  }
+
+  ret_i &= _check(bok_u, 101, eve_d - 1);
+
+  if ( c3n == _save(bok_u, eve_d, 1) ) {
+    fprintf(stderr, "book: save after reindex fail\r\n");
+    ret_i = 0;
+  }
+
+  ret_i &= _check(bok_u, 101, eve_d);
+  u3_book_exit(bok_u);
+
+  _wipe(pax_c);
+  return ret_i;
+}
+
+/* _damage(): flip the first payload byte of event [eve_d] in [seg_c],
+**            a segment starting at event 1.
+*/
+static c3_i
+_damage(const c3_c* seg_c, c3_d eve_d)
+{
+  c3_d off_d = 0, i_d;
+  c3_y byt_y[512], val_y;
+  c3_i fid_i = open(seg_c, O_RDWR);
+  c3_i ret_i = 1;
+
+  for ( i_d = 1; i_d < eve_d; i_d++ ) {
+    off_d += 16 + ((_event(i_d, byt_y) + 7) & ~7ULL);
+  }
+
+  if (  (0 > fid_i)
+     || (1 != pread(fid_i, &val_y, 1, off_d + 16)) )
+  {
+    fprintf(stderr, "book: open segment fail\r\n");
+    return 0;
+  }
+
+  val_y ^= 0xff;
+
+  if ( 1 != pwrite(fid_i, &val_y, 1, off_d + 16) ) {
+    fprintf(stderr, "book: damage segment fail\r\n");
+    ret_i = 0;
+  }
+
+  close(fid_i);
+  return ret_i;
+}
+
+/* _test_torn(): a damaged final record is discarded on open.
+*/
+static c3_i
+_test_torn(void)
+{
+  c3_c     pax_c[8193], seg_c[8193];
+  u3_book* bok_u;
+  c3_i     ret_i = 1;
+
+  snprintf(pax_c, sizeof(pax_c), "%s/torn", _dir_c);
+  snprintf(seg_c, sizeof(seg_c), "%s/%016" PRIx64 ".log", pax_c, (c3_d)1);
+
+  if ( !(bok_u = u3_book_init(pax_c, c3n)) ) {
+    fprintf(stderr, "book: init fail\r\n");
+    return 0;
+  }
+
+  if ( c3n == _save(bok_u, 1, 10) ) {
+    fprintf(stderr, "book: save fail\r\n");
+    ret_i = 0;
+  }
+
+  u3_book_exit(bok_u);
+
+  //  flip the first payload byte of event 10
+  //
+  if ( !_damage(seg_c, 10) ) {
+    return 0;
+  }
+
+  if ( !(bok_u = u3_book_init(pax_c, c3n)) ) {
+    fprintf(stderr, "book: reopen fail\r\n");
+    return 0;
+  }
+
+  ret_i &= _check(bok_u, 1, 9);
+
+  if ( c3n == _save(bok_u, 10, 5) ) {
+    fprintf(stderr, "book: save after repair fail\r\n");
+    ret_i = 0;
+  }
+
+  ret_i &= _check(bok_u, 1, 14);
+  u3_book_exit(bok_u);
+
+  _wipe(pax_c);
+  return ret_i;
+}
+
+/* _test_stale(): intact records after a torn one are not revived.
+*/
+static c3_i
+_test_stale(void)
+{
+  c3_c     pax_c[8193], seg_c[8193];
+  u3_book* bok_u;
+  c3_i     ret_i = 1;
+
+  snprintf(pax_c, sizeof(pax_c), "%s/stale", _dir_c);
+  snprintf(seg_c, sizeof(seg_c), "%s/%016" PRIx64 ".log", pax_c, (c3_d)1);
+
+  if ( !(bok_u = u3_book_init(pax_c, c3n)) ) {
+    fprintf(stderr, "book: init fail\r\n");
+    return 0;
+  }
+
+  if ( c3n == _save(bok_u, 1, 10) ) {
+    fprintf(stderr, "book: save fail\r\n");
+    ret_i = 0;
+  }
+
+  u3_book_exit(bok_u);
+
+  //  tear event 5, leaving 6-10 intact behind it; as the index is
+  //  written only once a batch is durable, it ends before event 5
+  //
+  if ( !_damage(seg_c, 5) ) {
+    return 0;
+  }
+
+  {
+    c3_c dex_c[8193];
+    snprintf(dex_c, sizeof(dex_c), "%s/%016" PRIx64 ".idx", pax_c, (c3_d)1);
+
+    if ( -1 == truncate(dex_c, 4 * sizeof(c3_w)) ) {
+      fprintf(stderr, "book: truncate index fail\r\n");
+      return 0;
+    }
+  }
+
+  if ( !(bok_u = u3_book_init(pax_c, c3n)) ) {
+    fprintf(stderr, "book: reopen fail\r\n");
+    return 0;
+  }
+
+  ret_i &= _check(bok_u, 1, 4);
+
+  //  rewrite event 5, of the same size, then "crash"
+  //
+  if ( c3n == _save(bok_u, 5, 1) ) {
+    fprintf(stderr, "book: save after repair fail\r\n");
+    ret_i = 0;
+  }
+
+  u3_book_exit(bok_u);
+
+  if ( !(bok_u = u3_book_init(pax_c, c3n)) ) {
+    fprintf(stderr, "book: reopen fail\r\n");
+    return 0;
+  }
+
+  ret_i &= _check(bok_u, 1, 5);
+  u3_book_exit(bok_u);
+
+  _wipe(pax_c);
+  return ret_i;
+}
+
+/* _test_read_only(): a reader neither writes nor creates files.
+*/
+static c3_i
+_test_read_only(void)
+{
+  c3_c     pax_c[8193], dex_c[8193];
+  u3_book* bok_u;
+  c3_i     ret_i = 1;
+
+  snprintf(pax_c, sizeof(pax_c), "%s/rdo", _dir_c);
+  snprintf(dex_c, sizeof(dex_c), "%s/%016" PRIx64 ".idx", pax_c, (c3_d)1);
+
+  if ( u3_book_init(pax_c, c3y) ) {
+    fprintf(stderr, "book: read-only open created a store\r\n");
+    return 0;
+  }
+
+  if ( !(bok_u = u3_book_init(pax_c, c3n)) ) {
+    fprintf(stderr, "book: init fail\r\n");
+    return 0;
+  }
+
+  if ( c3n == _save(bok_u, 1, 10) ) {
+    fprintf(stderr, "book: save fail\r\n");
+    ret_i = 0;
+  }
+
+  u3_book_exit(bok_u);
+  unlink(dex_c);
+
+  if ( !(bok_u = u3_book_init(pax_c, c3y)) ) {
+    fprintf(stderr, "book: read-only open fail\r\n");
+    return 0;
+  }
+
+  ret_i &= _check(bok_u, 1, 10);
+
+  if ( c3y == _save(bok_u, 11, 1) ) {
+    fprintf(stderr, "book: read-only save succeeded\r\n");
+    ret_i = 0;
+  }
+
+  u3_book_exit(bok_u);
+
+  if ( 0 == access(dex_c, F_OK) ) {
+    fprintf(stderr, "book: read-only open created an index\r\n");
+    ret_i = 0;
+  }
+
+  _wipe(pax_c);
+  return ret_i;
+}
+
+/* main(): run all test cases.
+*/
+int
+main(int argc, char* argv[])
+{
+  _setup();
+
+  if ( !_test_save_read() ) {
+    fprintf(stderr, "test book: save/read: failed\r\n");
+    _wipe(_dir_c);
+    exit(1);
+  }
+
+  if ( !_test_torn() ) {
+    fprintf(stderr, "test book: torn: failed\r\n");
+    _wipe(_dir_c);
+    exit(1);
+  }
+
+  if ( !_test_stale() ) {
+    fprintf(stderr, "test book: stale: failed\r\n");
+    _wipe(_dir_c);
+    exit(1);
+  }
+
+  if ( !_test_read_only() ) {
+    fprintf(stderr, "test book: read-only: failed\r\n");
+    _wipe(_dir_c);
+    exit(1);
+  }
+
+  _wipe(_dir_c);
+
+  fprintf(stderr, "test book: ok\r\n");
+  return 0;
+}
@@ -201,6 +201,8 @@ const c_source_files = [_][]const u8{
     "auto.c",
     "ca_bundle/ca_bundle.c",
     "dawn.c",
+    "db/book.c",
+    "db/dict.c",
     "db/lmdb.c",
     "disk.c",
     "foil.c",
@@ -234,6 +236,8 @@ const c_source_files = [_][]const u8{
 };
 
 const install_headers = [_][]const u8{
+    "db/book.h",
+    "db/dict.h",
     "db/lmdb.h",
     "dns_sd.h",
     "io/ames/stun.h",
@@ -0,0 +1,1063 @@
+/// @file
+
+#include "db/book.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <zlib.h>
+
+#include "c3/c3.h"
+#include "noun.h"
+
+//  append-only event log
+//
+//    an alternative to the lmdb EVENTS table for what is a pure
+//    append workload. events are written in order into preallocated
+//    segment files, and each batch is made durable by one data sync
+//    per segment touched (group commit). like lmdb.c, this module
+//    has no dependence on anything u3.
+//
+//    a store is a directory of segments, each named by its first
+//    event number:
+//
+//      %016llx.log: records, preallocated to [_BOOK_SEG] bytes
+//      %016llx.idx: record offsets, one c3_w each
+//
+//    a record is a 16-byte header [eve_d len_w crc_w], then [len_w]
+//    bytes of payload, zero-padded to 8 bytes. [crc_w] is the crc32
+//    of the event number, length and payload. a record with a zero
+//    length (such as unwritten, preallocated space) ends a segment.
+//    a record never spans segments; one too large for a fresh segment
+//    gets a segment of its own.
+//
+//    the index is a cache: it is written after its records are
+//    synced, and never synced itself. on open, it is checked against
+//    its segment, extended by scanning any unindexed records, and
+//    rebuilt from scratch if inconsistent. only the writer repairs
+//    the file, so a store may be opened read-only beside a writer.
+//
+//    a torn batch may leave intact records after the first damaged
+//    one. before its first append to a segment it did not create, the
+//    writer zeroes everything after the last valid record, lest an
+//    append of the same size expose those records again.
+//
+//    XX assumes little-endian
+//
+
+#define _BOOK_SEG  (1ULL << 26)           //  segment size
+#define _BOOK_IOV  1024                   //  iovecs per writev()
+#define _BOOK_WIP  (1ULL << 20)           //  tail wipe chunk
+
+/* u3_book_head: record header.
+*/
+typedef struct _u3_book_head {
+  c3_d eve_d;                             //  event number
+  c3_w len_w;                             //  payload length
+  c3_w crc_w;                             //  crc32 of the above and payload
+} u3_book_head;
+
+/* u3_book_seg: segment file.
+*/
+typedef struct _u3_book_seg {
+  c3_d  fir_d;                            //  first event number
+  c3_d  len_d;                            //  number of events
+  c3_i  fid_i;                            //  segment file
+  c3_i  dex_i;                            //  index file
+  c3_d  siz_d;                            //  allocated size
+  c3_d  end_d;                            //  end of last record
+  c3_w* off_w;                            //  record offsets
+  c3_d  cap_d;                            //  [off_w] capacity
+  c3_d  dex_d;                            //  offsets valid in index file
+  c3_o  fix_o;                            //  index file has garbage after
+  c3_o  cln_o;                            //  zeroed after [end_d]
+} u3_book_seg;
+
+struct _u3_book {
+  c3_c*           pax_c;                  //  store directory
+  c3_o            rdo_o;                  //  read-only
+  pthread_mutex_t mut_u;                  //  guards segment table
+  c3_w            len_w;                  //  number of segments
+  c3_w            cap_w;                  //  [seg_u] capacity
+  u3_book_seg*    seg_u;                  //  segments, ascending
+};
+
+/* _book_size(): size of a record with a [len_w]-byte payload.
+*/
+static inline c3_d
+_book_size(c3_w len_w)
+{
+  return sizeof(u3_book_head) + (((c3_d)len_w + 7) & ~7ULL);
+}
+
+/* _book_crc(): checksum a record.
+*/
+static c3_w
+_book_crc(c3_d eve_d, c3_w len_w, const c3_y* byt_y)
+{
+  c3_y  hed_y[12];
+  uLong crc_l = crc32(0L, Z_NULL, 0);
+
+  memcpy(hed_y, &eve_d, 8);
+  memcpy(hed_y + 8, &len_w, 4);
+
+  crc_l = crc32(crc_l, hed_y, sizeof(hed_y));
+  crc_l = crc32(crc_l, byt_y, len_w);
+
+  return (c3_w)crc_l;
+}
+
+/* _book_pread(): read [len_i] bytes at [off_d], retrying.
+*/
+static c3_o
+_book_pread(c3_i fid_i, c3_y* buf_y, size_t len_i, c3_d off_d)
+{
+  ssize_t ret_i;
+
+  while ( len_i ) {
+    if ( 0 > (ret_i = pread(fid_i, buf_y, len_i, off_d)) ) {
+      if ( EINTR == errno ) continue;
+      fprintf(stderr, "book: read: %s\r\n", strerror(errno));
+      return c3n;
+    }
+    else if ( !ret_i ) {
+      return c3n;
+    }
+
+    buf_y += ret_i;
+    off_d += ret_i;
+    len_i -= ret_i;
+  }
+
+  return c3y;
+}
+
+/* _book_pwrite(): write [len_i] bytes at [off_d], retrying.
+*/
+static c3_o
+_book_pwrite(c3_i fid_i, const c3_y* buf_y, size_t len_i, c3_d off_d)
+{
+  ssize_t ret_i;
+
+  while ( len_i ) {
+    if ( 0 > (ret_i = pwrite(fid_i, buf_y, len_i, off_d)) ) {
+      if ( EINTR == errno ) continue;
+      fprintf(stderr, "book: write: %s\r\n", strerror(errno));
+      return c3n;
+    }
+
+    buf_y += ret_i;
+    off_d += ret_i;
+    len_i -= ret_i;
+  }
+
+  return c3y;
+}
+
+/* _book_writev(): write [len_w] iovecs at [off_d], retrying.
+**
+**   NB: mutates [vec_u]; the file offset is only used by the writer.
+*/
+static c3_o
+_book_writev(c3_i fid_i, struct iovec* vec_u, c3_w len_w, c3_d off_d)
+{
+  ssize_t ret_i;
+
+  if ( 0 > lseek(fid_i, off_d, SEEK_SET) ) {
+    fprintf(stderr, "book: seek: %s\r\n", strerror(errno));
+    return c3n;
+  }
+
+  while ( len_w ) {
+    if ( 0 > (ret_i = writev(fid_i, vec_u, c3_min(len_w, _BOOK_IOV))) ) {
+      if ( EINTR == errno ) continue;
+      fprintf(stderr, "book: write: %s\r\n", strerror(errno));
+      return c3n;
+    }
+
+    while ( len_w && ((size_t)ret_i >= vec_u->iov_len) ) {
+      ret_i -= vec_u->iov_len;
+      vec_u++;
+      len_w--;
+    }
+
+    if ( ret_i ) {
+      vec_u->iov_base = (c3_y*)vec_u->iov_base + ret_i;
+      vec_u->iov_len -= ret_i;
+    }
+  }
+
+  return c3y;
+}
+
+/* _book_path(): path of the segment starting at [fir_d].
+*/
+static void
+_book_path(u3_book* bok_u, c3_d fir_d, const c3_c* ext_c,
+           c3_c* pat_c, size_t len_i)
+{
+  snprintf(pat_c, len_i, "%s/%016" PRIx64 ".%s", bok_u->pax_c, fir_d, ext_c);
+}
+
+/* _book_sync_dir(): sync the store directory.
+*/
+static c3_o
+_book_sync_dir(u3_book* bok_u)
+{
+  c3_i dir_i;
+
+  if ( -1 == (dir_i = c3_open(bok_u->pax_c, O_RDONLY, 0)) ) {
+    fprintf(stderr, "book: open %s: %s\r\n", bok_u->pax_c, strerror(errno));
+    return c3n;
+  }
+
+  if ( -1 == c3_sync(dir_i) ) {
+    fprintf(stderr, "book: sync %s: %s\r\n", bok_u->pax_c, strerror(errno));
+    close(dir_i);
+    return c3n;
+  }
+
+  close(dir_i);
+  return c3y;
+}
+
+/* _book_seg_push(): append a segment to the table, under the lock.
+*/
+static u3_book_seg*
+_book_seg_push(u3_book* bok_u, c3_d fir_d)
+{
+  u3_book_seg* seg_u;
+
+  if ( bok_u->len_w == bok_u->cap_w ) {
+    bok_u->cap_w = c3_max(8, 2 * bok_u->cap_w);
+    bok_u->seg_u = c3_realloc(bok_u->seg_u,
+                              bok_u->cap_w * sizeof(*bok_u->seg_u));
+  }
+
+  seg_u = &bok_u->seg_u[bok_u->len_w++];
+  memset(seg_u, 0, sizeof(*seg_u));
+  seg_u->fir_d = fir_d;
+  seg_u->fid_i = -1;
+  seg_u->dex_i = -1;
+  seg_u->fix_o = c3n;
+  seg_u->cln_o = c3n;
+
+  return seg_u;
+}
+
+/* _book_seg_note(): record the offset of the next event in [seg_u].
+*/
+static void
+_book_seg_note(u3_book_seg* seg_u, c3_w off_w)
+{
+  if ( seg_u->len_d == seg_u->cap_d ) {
+    seg_u->cap_d = c3_max(1024, 2 * seg_u->cap_d);
+    seg_u->off_w = c3_realloc(seg_u->off_w, seg_u->cap_d * sizeof(c3_w));
+  }
+
+  seg_u->off_w[seg_u->len_d++] = off_w;
+}
+
+/* _book_seg_free(): close segment files.
+*/
+static void
+_book_seg_free(u3_book_seg* seg_u)
+{
+  if ( -1 != seg_u->fid_i ) {
+    close(seg_u->fid_i);
+  }
+
+  if ( -1 != seg_u->dex_i ) {
+    close(seg_u->dex_i);
+  }
+
+  c3_free(seg_u->off_w);
+}
+
+/* _book_rec_read(): read and verify record [eve_d] at [off_d].
+*/
+static c3_o
+_book_rec_read(c3_i    fid_i,
+               c3_d    siz_d,
+               c3_d    off_d,
+               c3_d    eve_d,
+               c3_y**  buf_y,
+               size_t* cap_i,
+               c3_w*   len_w)
+{
+  u3_book_head hed_u;
+
+  if (  (off_d + sizeof(hed_u) > siz_d)
+     || (c3n == _book_pread(fid_i, (c3_y*)&hed_u, sizeof(hed_u), off_d))
+     || !hed_u.len_w
+     || (eve_d != hed_u.eve_d)
+     || (off_d + _book_size(hed_u.len_w) > siz_d) )
+  {
+    return c3n;
+  }
+
+  if ( *cap_i < hed_u.len_w ) {
+    *cap_i = c3_max(hed_u.len_w, 2 * *cap_i);
+    *buf_y = c3_realloc(*buf_y, *cap_i);
+  }
+
+  if (  (c3n == _book_pread(fid_i, *buf_y, hed_u.len_w, off_d + sizeof(hed_u)))
+     || (hed_u.crc_w != _book_crc(eve_d, hed_u.len_w, *buf_y)) )
+  {
+    return c3n;
+  }
+
+  *len_w = hed_u.len_w;
+  return c3y;
+}
+
+/* _book_seg_load(): load segment index, verifying and extending it.
+*/
+static c3_o
+_book_seg_load(u3_book* bok_u, u3_book_seg* seg_u)
+{
+  c3_c        pat_c[8193];
+  struct stat buf_u;
+  c3_y*       buf_y = 0;
+  size_t      cap_i = 0;
+  c3_w        len_w;
+  c3_d        dex_d, i_d, off_d;
+  c3_i        fla_i = ( c3y == bok_u->rdo_o ) ? O_RDONLY : O_RDWR;
+
+  _book_path(bok_u, seg_u->fir_d, "log", pat_c, sizeof(pat_c));
+
+  if (  (-1 == (seg_u->fid_i = c3_open(pat_c, fla_i, 0)))
+     || (-1 == fstat(seg_u->fid_i, &buf_u)) )
+  {
+    fprintf(stderr, "book: open %s: %s\r\n", pat_c, strerror(errno));
+    return c3n;
+  }
+
+  seg_u->siz_d = buf_u.st_size;
+
+  //  a reader never creates the index; without it, it scans
+  //
+  _book_path(bok_u, seg_u->fir_d, "idx", pat_c, sizeof(pat_c));
+
+  if ( c3n == bok_u->rdo_o ) {
+    fla_i |= O_CREAT;
+  }
+
+  if ( -1 == (seg_u->dex_i = c3_open(pat_c, fla_i, 0644)) ) {
+    if ( (c3n == bok_u->rdo_o) || (ENOENT != errno) ) {
+      fprintf(stderr, "book: open %s: %s\r\n", pat_c, strerror(errno));
+      return c3n;
+    }
+
+    buf_u.st_size = 0;
+  }
+  else if ( -1 == fstat(seg_u->dex_i, &buf_u) ) {
+    fprintf(stderr, "book: stat %s: %s\r\n", pat_c, strerror(errno));
+    return c3n;
+  }
+
+  //  load the cached index, trusting it if monotone and if its
+  //  final record verifies
+  //
+  dex_d = buf_u.st_size / sizeof(c3_w);
+
+  if ( dex_d ) {
+    seg_u->cap_d = dex_d;
+    seg_u->off_w = c3_malloc(dex_d * sizeof(c3_w));
+
+    if ( c3n == _book_pread(seg_u->dex_i, (c3_y*)seg_u->off_w,
+                            dex_d * sizeof(c3_w), 0) )
+    {
+      dex_d = 0;
+    }
+
+    for ( i_d = 1; i_d < dex_d; i_d++ ) {
+      if ( seg_u->off_w[i_d] <= seg_u->off_w[i_d - 1] ) {
+        dex_d = 0;
+      }
+    }
+
+    if (  dex_d
+       && (c3n == _book_rec_read(seg_u->fid_i, seg_u->siz_d,
+                                 seg_u->off_w[dex_d - 1],
+                                 seg_u->fir_d + dex_d - 1,
+                                 &buf_y, &cap_i, &len_w)) )
+    {
+      dex_d = 0;
+    }
+  }
+
+  seg_u->len_d = dex_d;
+  off_d = ( dex_d ) ? seg_u->off_w[dex_d - 1] + _book_size(len_w) : 0;
+
+  //  scan any records beyond the index
+  //
+  while ( c3y == _book_rec_read(seg_u->fid_i, seg_u->siz_d, off_d,
+                                seg_u->fir_d + seg_u->len_d,
+                                &buf_y, &cap_i, &len_w) )
+  {
+    _book_seg_note(seg_u, (c3_w)off_d);
+    off_d += _book_size(len_w);
+  }
+
+  seg_u->end_d = off_d;
+  seg_u->dex_d = dex_d;
+  seg_u->fix_o = ( dex_d < (buf_u.st_size / sizeof(c3_w)) ) ? c3y : c3n;
+  c3_free(buf_y);
+
+  return c3y;
+}
+
+/* _book_seg_wipe(): zero and sync any stale bytes after the last record.
+**
+**   writer only; most segments are clean, and only read.
+*/
+static c3_o
+_book_seg_wipe(u3_book_seg* seg_u)
+{
+  c3_d*  buf_d = c3_malloc(_BOOK_WIP);
+  c3_y*  buf_y = (c3_y*)buf_d;
+  c3_d   off_d, hig_d = seg_u->end_d;
+  size_t len_i, i_i;
+  c3_o   ret_o = c3n;
+
+  //  find the end of the last chunk with anything in it
+  //
+  for ( off_d = seg_u->end_d; off_d < seg_u->siz_d; off_d += len_i ) {
+    len_i = c3_min(_BOOK_WIP, seg_u->siz_d - off_d);
+
+    if ( c3n == _book_pread(seg_u->fid_i, buf_y, len_i, off_d) ) {
+      goto done;
+    }
+
+    for ( i_i = 0; i_i < (len_i >> 3); i_i++ ) {
+      if ( buf_d[i_i] ) {
+        break;
+      }
+    }
+
+    for ( i_i <<= 3; i_i < len_i; i_i++ ) {
+      if ( buf_y[i_i] ) {
+        hig_d = off_d + len_i;
+        break;
+      }
+    }
+  }
+
+  if ( hig_d > seg_u->end_d ) {
+    fprintf(stderr, "book: clearing %" PRIu64 " bytes after event %" PRIu64
+                    "\r\n", hig_d - seg_u->end_d,
+                    seg_u->fir_d + seg_u->len_d - 1);
+
+    memset(buf_y, 0, _BOOK_WIP);
+
+    for ( off_d = seg_u->end_d; off_d < hig_d; off_d += len_i ) {
+      len_i = c3_min(_BOOK_WIP, hig_d - off_d);
+
+      if ( c3n == _book_pwrite(seg_u->fid_i, buf_y, len_i, off_d) ) {
+        goto done;
+      }
+    }
+
+    if ( -1 == c3_sync(seg_u->fid_i) ) {
+      fprintf(stderr, "book: sync: %s\r\n", strerror(errno));
+      goto done;
+    }
+  }
+
+  seg_u->cln_o = c3y;
+  ret_o = c3y;
+
+done:
+  c3_free(buf_d);
+  return ret_o;
+}
+
+/* _book_seg_dex(): write unpersisted offsets to the index file.
+**
+**   writer only, so reads [off_w] without the lock.
+*/
+static void
+_book_seg_dex(u3_book_seg* seg_u)
+{
+  if ( c3y == seg_u->fix_o ) {
+    if ( -1 == ftruncate(seg_u->dex_i, seg_u->dex_d * sizeof(c3_w)) ) {
+      return;
+    }
+
+    seg_u->fix_o = c3n;
+  }
+
+  if (  (seg_u->dex_d < seg_u->len_d)
+     && (c3y == _book_pwrite(seg_u->dex_i,
+                             (c3_y*)(seg_u->off_w + seg_u->dex_d),
+                             (seg_u->len_d - seg_u->dex_d) * sizeof(c3_w),
+                             seg_u->dex_d * sizeof(c3_w))) )
+  {
+    seg_u->dex_d = seg_u->len_d;
+  }
+}
+
+/* _book_seg_make(): create and preallocate a segment at [fir_d].
+*/
+static c3_o
+_book_seg_make(u3_book* bok_u, c3_d fir_d, c3_d siz_d, u3_book_seg* seg_u)
+{
+  c3_c pat_c[8193];
+  c3_i ret_i;
+
+  memset(seg_u, 0, sizeof(*seg_u));
+  seg_u->fir_d = fir_d;
+  seg_u->siz_d = siz_d;
+  seg_u->dex_i = -1;
+  seg_u->fix_o = c3n;
+  seg_u->cln_o = c3y;
+
+  _book_path(bok_u, fir_d, "log", pat_c, sizeof(pat_c));
+
+  if ( -1 == (seg_u->fid_i = c3_open(pat_c, O_RDWR | O_CREAT | O_TRUNC, 0644)) ) {
+    fprintf(stderr, "book: create %s: %s\r\n", pat_c, strerror(errno));
+    return c3n;
+  }
+
+#if defined(U3_OS_linux)
+  ret_i = posix_fallocate(seg_u->fid_i, 0, siz_d);
+#else
+  ret_i = ( -1 == ftruncate(seg_u->fid_i, siz_d) ) ? errno : 0;
+#endif
+
+  if ( ret_i ) {
+    fprintf(stderr, "book: allocate %s: %s\r\n", pat_c, strerror(ret_i));
+    return c3n;
+  }
+
+  if ( -1 == c3_sync(seg_u->fid_i) ) {
+    fprintf(stderr, "book: sync %s: %s\r\n", pat_c, strerror(errno));
+    return c3n;
+  }
+
+  _book_path(bok_u, fir_d, "idx", pat_c, sizeof(pat_c));
+
+  if ( -1 == (seg_u->dex_i = c3_open(pat_c, O_RDWR | O_CREAT | O_TRUNC, 0644)) ) {
+    fprintf(stderr, "book: create %s: %s\r\n", pat_c, strerror(errno));
+    return c3n;
+  }
+
+  return _book_sync_dir(bok_u);
+}
+
+/* _book_seg_kill(): delete an empty segment.
+*/
+static void
+_book_seg_kill(u3_book* bok_u, u3_book_seg* seg_u)
+{
+  c3_c pat_c[8193];
+
+  _book_seg_free(seg_u);
+
+  _book_path(bok_u, seg_u->fir_d, "log", pat_c, sizeof(pat_c));
+  c3_unlink(pat_c);
+  _book_path(bok_u, seg_u->fir_d, "idx", pat_c, sizeof(pat_c));
+  c3_unlink(pat_c);
+}
+
+/* _book_cmp(): order segment numbers.
+*/
+static c3_i
+_book_cmp(const void* a_v, const void* b_v)
+{
+  c3_d a_d = *(const c3_d*)a_v;
+  c3_d b_d = *(const c3_d*)b_v;
+
+  return ( a_d < b_d ) ? -1 : ( a_d > b_d ) ? 1 : 0;
+}
+
+/* u3_book_init(): open or create an event store in directory [pax_c],
+**                 or ([rdo_o]) open one read-only.
+*/
+u3_book*
+u3_book_init(const c3_c* pax_c, c3_o rdo_o)
+{
+  u3_book*       bok_u;
+  DIR*           dir_u;
+  struct dirent* den_u;
+  c3_d*          fir_d = 0;
+  c3_w           len_w = 0, cap_w = 0, i_w;
+  c3_d           val_d;
+  c3_i           car_i;
+
+  if (  (c3n == rdo_o)
+     && c3_mkdir(pax_c, 0700)
+     && (EEXIST != errno) )
+  {
+    fprintf(stderr, "book: mkdir %s: %s\r\n", pax_c, strerror(errno));
+    return 0;
+  }
+
+  if ( !(dir_u = opendir(pax_c)) ) {
+    fprintf(stderr, "book: opendir %s: %s\r\n", pax_c, strerror(errno));
+    return 0;
+  }
+
+  while ( (den_u = readdir(dir_u)) ) {
+    car_i = 0;
+
+    if (  (1 == sscanf(den_u->d_name, "%16" SCNx64 ".log%n", &val_d, &car_i))
+       && (20 == car_i)
+       && ('\0' == den_u->d_name[car_i]) )
+    {
+      if ( len_w == cap_w ) {
+        cap_w = c3_max(8, 2 * cap_w);
+        fir_d = c3_realloc(fir_d, cap_w * sizeof(c3_d));
+      }
+
+      fir_d[len_w++] = val_d;
+    }
+  }
+
+  closedir(dir_u);
+
+  if ( len_w ) {
+    qsort(fir_d, len_w, sizeof(c3_d), _book_cmp);
+  }
+
+  bok_u = c3_calloc(sizeof(*bok_u));
+  bok_u->pax_c = strdup(pax_c);
+  bok_u->rdo_o = rdo_o;
+  pthread_mutex_init(&bok_u->mut_u, NULL);
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    u3_book_seg* seg_u = _book_seg_push(bok_u, fir_d[i_w]);
+
+    if ( c3n == _book_seg_load(bok_u, seg_u) ) {
+      c3_free(fir_d);
+      u3_book_exit(bok_u);
+      return 0;
+    }
+
+    //  segments must be contiguous, and only the last may be partial
+    //
+    if ( i_w ) {
+      u3_book_seg* pre_u = seg_u - 1;
+
+      if ( (pre_u->fir_d + pre_u->len_d) != seg_u->fir_d ) {
+        fprintf(stderr, "book: %s: gap at event %" PRIu64 "\r\n",
+                        pax_c, pre_u->fir_d + pre_u->len_d);
+        c3_free(fir_d);
+        u3_book_exit(bok_u);
+        return 0;
+      }
+    }
+  }
+
+  c3_free(fir_d);
+
+  return bok_u;
+}
+
+/* u3_book_exit(): close event store.
+*/
+void
+u3_book_exit(u3_book* bok_u)
+{
+  c3_w i_w;
+
+  for ( i_w = 0; i_w < bok_u->len_w; i_w++ ) {
+    _book_seg_free(&bok_u->seg_u[i_w]);
+  }
+
+  pthread_mutex_destroy(&bok_u->mut_u);
+  c3_free(bok_u->seg_u);
+  c3_free(bok_u->pax_c);
+  c3_free(bok_u);
+}
+
+/* u3_book_stat(): print event store stats.
+*/
+void
+u3_book_stat(u3_book* bok_u, FILE* fil_u)
+{
+  c3_d len_d = 0, end_d = 0, siz_d = 0;
+  c3_w i_w;
+
+  pthread_mutex_lock(&bok_u->mut_u);
+
+  for ( i_w = 0; i_w < bok_u->len_w; i_w++ ) {
+    len_d += bok_u->seg_u[i_w].len_d;
+    end_d += bok_u->seg_u[i_w].end_d;
+    siz_d += bok_u->seg_u[i_w].siz_d;
+  }
+
+  fprintf(fil_u, "book info:\n");
+  fprintf(fil_u, "  segments: %u\n", bok_u->len_w);
+  fprintf(fil_u, "  events: %" PRIu64 "\n", len_d);
+  fprintf(fil_u, "  bytes used: %" PRIu64 "\n", end_d);
+  fprintf(fil_u, "  bytes allocated: %" PRIu64 "\n", siz_d);
+
+  pthread_mutex_unlock(&bok_u->mut_u);
+}
+
+/* _book_gulf(): first and last event numbers, under the lock.
+*/
+static void
+_book_gulf(u3_book* bok_u, c3_d* low_d, c3_d* hig_d)
+{
+  u3_book_seg* las_u;
+
+  if ( !bok_u->len_w ) {
+    *low_d = *hig_d = 0;
+    return;
+  }
+
+  las_u = &bok_u->seg_u[bok_u->len_w - 1];
+
+  if ( !las_u->len_d && (1 == bok_u->len_w) ) {
+    *low_d = *hig_d = 0;
+  }
+  else {
+    *low_d = bok_u->seg_u[0].fir_d;
+    *hig_d = las_u->fir_d + las_u->len_d - 1;
+  }
+}
+
+/* u3_book_gulf(): read first and last event numbers.
+*/
+c3_o
+u3_book_gulf(u3_book* bok_u, c3_d* low_d, c3_d* hig_d)
+{
+  pthread_mutex_lock(&bok_u->mut_u);
+  _book_gulf(bok_u, low_d, hig_d);
+  pthread_mutex_unlock(&bok_u->mut_u);
+
+  return c3y;
+}
+
+/* _book_find(): locate event [eve_d].
+*/
+static c3_o
+_book_find(u3_book* bok_u, c3_d eve_d, c3_i* fid_i, c3_d* siz_d, c3_d* off_d)
+{
+  c3_o ret_o = c3n;
+  c3_w low_w, hig_w, mid_w;
+
+  pthread_mutex_lock(&bok_u->mut_u);
+
+  if ( bok_u->len_w && (eve_d >= bok_u->seg_u[0].fir_d) ) {
+    low_w = 0;
+    hig_w = bok_u->len_w - 1;
+
+    while ( low_w < hig_w ) {
+      mid_w = low_w + ((hig_w - low_w + 1) / 2);
+
+      if ( bok_u->seg_u[mid_w].fir_d <= eve_d ) {
+        low_w = mid_w;
+      }
+      else {
+        hig_w = mid_w - 1;
+      }
+    }
+
+    {
+      u3_book_seg* seg_u = &bok_u->seg_u[low_w];
+
+      if ( (eve_d - seg_u->fir_d) < seg_u->len_d ) {
+        *fid_i = seg_u->fid_i;
+        *siz_d = seg_u->siz_d;
+        *off_d = seg_u->off_w[eve_d - seg_u->fir_d];
+        ret_o  = c3y;
+      }
+    }
+  }
+
+  pthread_mutex_unlock(&bok_u->mut_u);
+
+  return ret_o;
+}
+
+/* u3_book_read(): read [len_d] events starting at [eve_d].
+*/
+c3_o
+u3_book_read(u3_book* bok_u,
+             void*    ptr_v,
+             c3_d     eve_d,
+             c3_d     len_d,
+             c3_o   (*read_f)(void*, c3_d, size_t, void*))
+{
+  c3_y*  buf_y = 0;
+  size_t cap_i = 0;
+  c3_o   ret_o = c3y;
+  c3_d   i_d, siz_d, off_d;
+  c3_w   len_w;
+  c3_i   fid_i;
+
+  for ( i_d = eve_d; i_d < (eve_d + len_d); i_d++ ) {
+    if ( c3n == _book_find(bok_u, i_d, &fid_i, &siz_d, &off_d) ) {
+      fprintf(stderr, "book: read: missing event %" PRIu64 "\r\n", i_d);
+      ret_o = c3n;
+      break;
+    }
+
+    if ( c3n == _book_rec_read(fid_i, siz_d, off_d, i_d,
+                               &buf_y, &cap_i, &len_w) )
+    {
+      fprintf(stderr, "book: read: corrupt event %" PRIu64 "\r\n", i_d);
+      ret_o = c3n;
+      break;
+    }
+
+    if ( c3n == read_f(ptr_v, i_d, len_w, buf_y) ) {
+      ret_o = c3n;
+      break;
+    }
+  }
+
+  c3_free(buf_y);
+  return ret_o;
+}
+
+/* _book_save_run(): write and sync records [i_d, j_d) into [seg_u].
+*/
+static c3_o
+_book_save_run(u3_book*     bok_u,
+               u3_book_seg* seg_u,
+               c3_d         eve_d,
+               c3_d         i_d,
+               c3_d         j_d,
+               void**       byt_p,
+               size_t*      siz_i)
+{
+  static c3_y   pad_y[8] = {0};
+  c3_d          len_d = j_d - i_d;
+  u3_book_head* hed_u = c3_malloc(len_d * sizeof(*hed_u));
+  struct iovec* vec_u = c3_malloc(3 * len_d * sizeof(*vec_u));
+  c3_w*         off_w = c3_malloc(len_d * sizeof(*off_w));
+  c3_d          off_d = seg_u->end_d;
+  c3_w          vec_w = 0;
+  c3_d          k_d;
+  c3_o          ret_o = c3n;
+
+  for ( k_d = 0; k_d < len_d; k_d++ ) {
+    c3_w len_w = (c3_w)siz_i[i_d + k_d];
+    c3_d pad_d = _book_size(len_w) - sizeof(*hed_u) - len_w;
+
+    hed_u[k_d].eve_d = eve_d + i_d + k_d;
+    hed_u[k_d].len_w = len_w;
+    hed_u[k_d].crc_w = _book_crc(hed_u[k_d].eve_d, len_w, byt_p[i_d + k_d]);
+
+    vec_u[vec_w].iov_base = &hed_u[k_d];
+    vec_u[vec_w++].iov_len = sizeof(*hed_u);
+    vec_u[vec_w].iov_base = byt_p[i_d + k_d];
+    vec_u[vec_w++].iov_len = len_w;
+
+    if ( pad_d ) {
+      vec_u[vec_w].iov_base = pad_y;
+      vec_u[vec_w++].iov_len = pad_d;
+    }
+
+    off_w[k_d] = (c3_w)off_d;
+    off_d += _book_size(len_w);
+  }
+
+  if ( c3n == _book_writev(seg_u->fid_i, vec_u, vec_w, seg_u->end_d) ) {
+    goto done;
+  }
+
+  if ( -1 == c3_sync(seg_u->fid_i) ) {
+    fprintf(stderr, "book: sync: %s\r\n", strerror(errno));
+    goto done;
+  }
+
+  //  publish the durable records, then cache their offsets
+  //
+  pthread_mutex_lock(&bok_u->mut_u);
+
+  for ( k_d = 0; k_d < len_d; k_d++ ) {
+    _book_seg_note(seg_u, off_w[k_d]);
+  }
+
+  seg_u->end_d = off_d;
+
+  pthread_mutex_unlock(&bok_u->mut_u);
+
+  _book_seg_dex(seg_u);
+
+  ret_o = c3y;
+
+done:
+  c3_free(off_w);
+  c3_free(vec_u);
+  c3_free(hed_u);
+  return ret_o;
+}
+
+/* u3_book_save(): save [len_d] events starting at [eve_d].
+**
+**   NB: single writer; reads may proceed concurrently.
+*/
+c3_o
+u3_book_save(u3_book* bok_u,
+             c3_d     eve_d,               //  first event
+             c3_d     len_d,               //  number of events
+             void**   byt_p,               //  array of bytes
+             size_t*  siz_i)               //  array of lengths
+{
+  u3_book_seg* seg_u;
+  c3_d         i_d = 0, j_d, end_d;
+
+  if ( c3y == bok_u->rdo_o ) {
+    fprintf(stderr, "book: write: read-only\r\n");
+    return c3n;
+  }
+
+  //  events must extend the log contiguously
+  //
+  {
+    c3_d low_d, hig_d;
+
+    pthread_mutex_lock(&bok_u->mut_u);
+    _book_gulf(bok_u, &low_d, &hig_d);
+
+    //  an empty store adopts the first event it is given
+    //
+    if ( !hig_d && (1 == bok_u->len_w) && (eve_d != bok_u->seg_u[0].fir_d) ) {
+      _book_seg_kill(bok_u, &bok_u->seg_u[0]);
+      bok_u->len_w = 0;
+    }
+
+    pthread_mutex_unlock(&bok_u->mut_u);
+
+    if ( hig_d && (eve_d != (hig_d + 1)) ) {
+      fprintf(stderr, "book: write: expected event %" PRIu64
+                      ", received %" PRIu64 "\r\n",
+                      hig_d + 1, eve_d);
+      return c3n;
+    }
+  }
+
+  for ( i_d = 0; i_d < len_d; i_d++ ) {
+    if ( siz_i[i_d] > 0xffffffffULL - 64 ) {
+      fprintf(stderr, "book: write: event %" PRIu64 " too large\r\n",
+                      eve_d + i_d);
+      return c3n;
+    }
+  }
+
+  i_d = 0;
+
+  while ( i_d < len_d ) {
+    //  find or make a segment with room for the next record
+    //
+    seg_u = ( bok_u->len_w ) ? &bok_u->seg_u[bok_u->len_w - 1] : 0;
+
+    if (  !seg_u
+       || ((seg_u->end_d + _book_size(siz_i[i_d])) > seg_u->siz_d) )
+    {
+      u3_book_seg new_u;
+      c3_d        siz_d = c3_max(_BOOK_SEG, _book_size(siz_i[i_d]));
+
+      if ( c3n == _book_seg_make(bok_u, eve_d + i_d, siz_d, &new_u) ) {
+        _book_seg_kill(bok_u, &new_u);
+        return c3n;
+      }
+
+      pthread_mutex_lock(&bok_u->mut_u);
+      seg_u  = _book_seg_push(bok_u, new_u.fir_d);
+      *seg_u = new_u;
+      pthread_mutex_unlock(&bok_u->mut_u);
+    }
+
+    if (  (c3n == seg_u->cln_o)
+       && (c3n == _book_seg_wipe(seg_u)) )
+    {
+      return c3n;
+    }
+
+    //  gather every following record that fits
+    //
+    end_d = seg_u->end_d;
+
+    for ( j_d = i_d; j_d < len_d; j_d++ ) {
+      if ( (end_d + _book_size(siz_i[j_d])) > seg_u->siz_d ) {
+        break;
+      }
+
+      end_d += _book_size(siz_i[j_d]);
+    }
+
+    if ( c3n == _book_save_run(bok_u, seg_u, eve_d, i_d, j_d, byt_p, siz_i) ) {
+      return c3n;
+    }
+
+    i_d = j_d;
+  }
+
+  return c3y;
+}
+
+/* u3_book_walk_init(): initialize iterator.
+*/
+c3_o
+u3_book_walk_init(u3_book*      bok_u,
+                  u3_book_walk* itr_u,
+                  c3_d          nex_d,
+                  c3_d          las_d)
+{
+  c3_d low_d, hig_d;
+
+  u3_book_gulf(bok_u, &low_d, &hig_d);
+
+  if ( !hig_d || (nex_d < low_d) || (nex_d > hig_d) ) {
+    fprintf(stderr, "book: walk: event %" PRIu64 " not in %" PRIu64
+                    "-%" PRIu64 "\r\n", nex_d, low_d, hig_d);
+    return c3n;
+  }
+
+  itr_u->bok_u = bok_u;
+  itr_u->nex_d = nex_d;
+  itr_u->las_d = las_d;
+  itr_u->buf_y = 0;
+  itr_u->cap_i = 0;
+
+  return c3y;
+}
+
+/* u3_book_walk_next(): synchronously read next event from iterator.
+**
+**   the buffer produced is valid until the next call.
+*/
+c3_o
+u3_book_walk_next(u3_book_walk* itr_u, size_t* len_i, void** buf_v)
+{
+  c3_d siz_d, off_d;
+  c3_w len_w;
+  c3_i fid_i;
+
+  u3_assert( itr_u->nex_d <= itr_u->las_d );
+
+  if (  (c3n == _book_find(itr_u->bok_u, itr_u->nex_d, &fid_i, &siz_d, &off_d))
+     || (c3n == _book_rec_read(fid_i, siz_d, off_d, itr_u->nex_d,
+                               &itr_u->buf_y, &itr_u->cap_i, &len_w)) )
+  {
+    fprintf(stderr, "book: walk: read fail at %" PRIu64 "\r\n", itr_u->nex_d);
+    return c3n;
+  }
+
+  *len_i = len_w;
+  *buf_v = itr_u->buf_y;
+
+  itr_u->nex_d++;
+
+  return c3y;
+}
+
+/* u3_book_walk_done(): close iterator.
+*/
+void
+u3_book_walk_done(u3_book_walk* itr_u)
+{
+  c3_free(itr_u->buf_y);
+  itr_u->buf_y = 0;
+  itr_u->cap_i = 0;
+}
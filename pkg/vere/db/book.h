@@ -0,0 +1,81 @@
+/// @file
+
+#ifndef U3_VERE_DB_BOOK_H
+#define U3_VERE_DB_BOOK_H
+
+#include "c3/c3.h"
+
+  /* append-only event log
+  */
+    /* u3_book: segmented event store.
+    */
+    typedef struct _u3_book u3_book;
+
+    /* u3_book_walk: event iterator
+    */
+    typedef struct _u3_book_walk {
+      u3_book*    bok_u;  //  event store
+      c3_d        nex_d;  //  next event number
+      c3_d        las_d;  //  final event number, inclusive
+      c3_y*       buf_y;  //  record buffer
+      size_t      cap_i;  //  record buffer capacity
+    } u3_book_walk;
+
+    /* u3_book_init(): open or create an event store in directory [pax_c],
+    **                 or ([rdo_o]) open one read-only.
+    */
+      u3_book*
+      u3_book_init(const c3_c* pax_c, c3_o rdo_o);
+
+    /* u3_book_exit(): close event store.
+    */
+      void
+      u3_book_exit(u3_book* bok_u);
+
+    /* u3_book_stat(): print event store stats.
+    */
+      void
+      u3_book_stat(u3_book* bok_u, FILE* fil_u);
+
+    /* u3_book_gulf(): read first and last event numbers.
+    */
+      c3_o
+      u3_book_gulf(u3_book* bok_u, c3_d* low_d, c3_d* hig_d);
+
+    /* u3_book_read(): read [len_d] events starting at [eve_d].
+    */
+      c3_o
+      u3_book_read(u3_book* bok_u,
+                   void*    ptr_v,
+                   c3_d     eve_d,
+                   c3_d     len_d,
+                   c3_o  (*read_f)(void*, c3_d, size_t  , void*));
+
+    /* u3_book_save(): save [len_d] events starting at [eve_d].
+    */
+      c3_o
+      u3_book_save(u3_book* bok_u,
+                   c3_d     eve_d,
+                   c3_d     len_d,
+                   void**   byt_p,
+                   size_t*  siz_i);
+
+    /* u3_book_walk_init(): initialize iterator.
+    */
+      c3_o
+      u3_book_walk_init(u3_book*      bok_u,
+                        u3_book_walk* itr_u,
+                        c3_d          nex_d,
+                        c3_d          las_d);
+
+    /* u3_book_walk_next(): synchronously read next event from iterator.
+    */
+      c3_o
+      u3_book_walk_next(u3_book_walk* itr_u, size_t* len_i, void** buf_v);
+
+    /* u3_book_walk_done(): close iterator.
+    */
+      void
+      u3_book_walk_done(u3_book_walk* itr_u);
+
+#endif /* ifndef U3_VERE_DB_BOOK_H */
@@ -0,0 +1,369 @@
+/// @file
+
+#include "db/dict.h"
+
+#include <zlib.h>
+
+#include "c3/c3.h"
+#include "noun.h"
+
+//  dictionary compression
+//
+//    compresses small, similar buffers (such as event log records)
+//    with raw deflate and a preset dictionary trained from a sample
+//    of them. like lmdb.c, this module has no dependence on anything
+//    u3.
+//
+//    training is a simplified form of the "cover" construction used
+//    by zstd: the sample is cut into overlapping segments, each scored
+//    by the frequency of its distinct d-mers (counted in samples, not
+//    occurrences), and the best segments are chosen greedily. once a
+//    segment is chosen its d-mers score nothing, so that later choices
+//    cover new material. deflate codes near distances more cheaply,
+//    so the best segments are placed at the end.
+//
+//    loading a dictionary into a deflate stream costs far more than
+//    compressing a small record with it, so a primed stream is kept,
+//    and copied for each record into a reusable arena.
+//
+
+#define _DICT_D     8                     //  d-mer length
+#define _DICT_K     64                    //  segment length
+#define _DICT_BIT   20                    //  log2 frequency table size
+#define _DICT_LEV   6                     //  deflate level
+#define _DICT_ARE   (1U << 19)            //  stream copy arena size
+
+struct _u3_dict {
+  c3_y*    dic_y;                         //  dictionary
+  c3_w     dic_w;                         //  dictionary length
+  z_stream pri_u;                         //  deflate stream, primed
+  c3_y*    are_y;                         //  stream copy arena
+  size_t   off_i;                         //  arena allocated
+  c3_o     cop_o;                         //  allocating for a copy
+};
+
+/* _dict_seg: training candidate.
+*/
+typedef struct _dict_seg {
+  c3_y* byt_y;                            //  segment start
+  c3_d  sco_d;                            //  score when ranked
+} _dict_seg;
+
+/* _dict_hash(): hash the d-mer at [byt_y].
+*/
+static inline c3_w
+_dict_hash(const c3_y* byt_y)
+{
+  c3_d val_d;
+
+  memcpy(&val_d, byt_y, sizeof(val_d));
+  return (c3_w)((val_d * 0x9e3779b97f4a7c15ULL) >> (64 - _DICT_BIT));
+}
+
+/* _dict_score(): sum frequencies of the distinct d-mers of a segment.
+**
+**   [tam_d] stamps d-mers seen in this segment, with [tam_d].
+*/
+static c3_d
+_dict_score(const c3_y* byt_y, c3_w* fre_w, c3_d* sen_d, c3_d tam_d)
+{
+  c3_d sco_d = 0;
+  c3_w i_w, has_w;
+
+  for ( i_w = 0; i_w <= (_DICT_K - _DICT_D); i_w++ ) {
+    has_w = _dict_hash(byt_y + i_w);
+
+    if ( tam_d != sen_d[has_w] ) {
+      sen_d[has_w] = tam_d;
+
+      //  a d-mer in just one sample is not worth keeping
+      //
+      if ( 1 < fre_w[has_w] ) {
+        sco_d += fre_w[has_w];
+      }
+    }
+  }
+
+  return sco_d;
+}
+
+/* _dict_cmp(): order candidates by descending score.
+*/
+static c3_i
+_dict_cmp(const void* a_v, const void* b_v)
+{
+  const _dict_seg* a_u = a_v;
+  const _dict_seg* b_u = b_v;
+
+  return ( a_u->sco_d > b_u->sco_d ) ? -1
+       : ( a_u->sco_d < b_u->sco_d ) ?  1 : 0;
+}
+
+/* _dict_alloc(): zlib allocator, from the arena while copying.
+*/
+static voidpf
+_dict_alloc(voidpf ptr_v, uInt len_i, uInt siz_i)
+{
+  u3_dict* dit_u = ptr_v;
+  size_t   all_i = (((size_t)len_i * siz_i) + 15) & ~(size_t)15;
+
+  if (  (c3y == dit_u->cop_o)
+     && (all_i <= (_DICT_ARE - dit_u->off_i)) )
+  {
+    voidpf res_v = dit_u->are_y + dit_u->off_i;
+    dit_u->off_i += all_i;
+    return res_v;
+  }
+
+  return calloc(len_i, siz_i);
+}
+
+/* _dict_free(): zlib deallocator, ignoring the arena.
+*/
+static void
+_dict_free(voidpf ptr_v, voidpf adr_v)
+{
+  u3_dict* dit_u = ptr_v;
+  c3_y*    adr_y = adr_v;
+
+  if ( (adr_y < dit_u->are_y) || (adr_y >= (dit_u->are_y + _DICT_ARE)) ) {
+    free(adr_v);
+  }
+}
+
+/* u3_dict_train(): build a dictionary of up to [max_w] bytes into
+**                  [dic_y] from [len_d] sample buffers. produces
+**                  its length, or 0 if the sample is too small.
+*/
+c3_w
+u3_dict_train(c3_d    len_d,
+              c3_y**  byt_y,
+              size_t* siz_i,
+              c3_y*   dic_y,
+              c3_w    max_w)
+{
+  c3_w*      fre_w;
+  c3_d*      sen_d;
+  _dict_seg* seg_u;
+  c3_d       seg_d = 0, tam_d, i_d, j_d;
+  c3_w       dic_w = 0, has_w;
+
+  max_w = c3_min(max_w, u3_dict_max);
+
+  for ( i_d = 0; i_d < len_d; i_d++ ) {
+    if ( siz_i[i_d] >= _DICT_K ) {
+      seg_d += 1 + ((siz_i[i_d] - _DICT_K) / (_DICT_K / 2));
+    }
+  }
+
+  if ( (len_d < 2) || (seg_d < 2) ) {
+    return 0;
+  }
+
+  fre_w = c3_calloc(sizeof(c3_w) << _DICT_BIT);
+  sen_d = c3_malloc(sizeof(c3_d) << _DICT_BIT);
+  seg_u = c3_malloc(seg_d * sizeof(*seg_u));
+  memset(sen_d, 0xff, sizeof(c3_d) << _DICT_BIT);
+
+  //  count the samples containing each d-mer
+  //
+  for ( i_d = 0; i_d < len_d; i_d++ ) {
+    for ( j_d = 0; (j_d + _DICT_D) <= siz_i[i_d]; j_d++ ) {
+      has_w = _dict_hash(byt_y[i_d] + j_d);
+
+      if ( i_d != sen_d[has_w] ) {
+        sen_d[has_w] = i_d;
+        fre_w[has_w]++;
+      }
+    }
+  }
+
+  //  rank half-overlapping segments of every sample
+  //
+  tam_d = len_d;
+  seg_d = 0;
+
+  for ( i_d = 0; i_d < len_d; i_d++ ) {
+    for ( j_d = 0; (j_d + _DICT_K) <= siz_i[i_d]; j_d += (_DICT_K / 2) ) {
+      seg_u[seg_d].byt_y = byt_y[i_d] + j_d;
+      seg_u[seg_d].sco_d = _dict_score(seg_u[seg_d].byt_y, fre_w,
+                                       sen_d, tam_d++);
+      seg_d++;
+    }
+  }
+
+  qsort(seg_u, seg_d, sizeof(*seg_u), _dict_cmp);
+
+  //  choose greedily, rescoring lazily: a candidate whose score has
+  //  fallen by half since ranking is covered by earlier choices
+  //
+  for ( i_d = 0; (i_d < seg_d) && ((dic_w + _DICT_K) <= max_w); i_d++ ) {
+    c3_d sco_d;
+    c3_w k_w;
+
+    if ( !seg_u[i_d].sco_d ) {
+      break;
+    }
+
+    sco_d = _dict_score(seg_u[i_d].byt_y, fre_w, sen_d, tam_d++);
+
+    if ( (2 * sco_d) < seg_u[i_d].sco_d ) {
+      continue;
+    }
+
+    for ( k_w = 0; k_w <= (_DICT_K - _DICT_D); k_w++ ) {
+      fre_w[_dict_hash(seg_u[i_d].byt_y + k_w)] = 0;
+    }
+
+    dic_w += _DICT_K;
+    memcpy(dic_y + (max_w - dic_w), seg_u[i_d].byt_y, _DICT_K);
+  }
+
+  //  the best segment was written last; close the gap at the front
+  //
+  if ( dic_w && (dic_w < max_w) ) {
+    memmove(dic_y, dic_y + (max_w - dic_w), dic_w);
+  }
+
+  c3_free(seg_u);
+  c3_free(sen_d);
+  c3_free(fre_w);
+
+  return dic_w;
+}
+
+/* u3_dict_init(): load dictionary [dic_y], copying it.
+*/
+u3_dict*
+u3_dict_init(const c3_y* dic_y, c3_w dic_w)
+{
+  u3_dict* dit_u = c3_calloc(sizeof(*dit_u));
+
+  if ( dic_w > u3_dict_max ) {
+    fprintf(stderr, "dict: dictionary too large: %u bytes\r\n", dic_w);
+    c3_free(dit_u);
+    return 0;
+  }
+
+  dit_u->dic_w = dic_w;
+  dit_u->dic_y = c3_malloc(c3_max(1, dic_w));
+  dit_u->are_y = c3_malloc(_DICT_ARE);
+  dit_u->cop_o = c3n;
+  memcpy(dit_u->dic_y, dic_y, dic_w);
+
+  dit_u->pri_u.zalloc = _dict_alloc;
+  dit_u->pri_u.zfree  = _dict_free;
+  dit_u->pri_u.opaque = dit_u;
+
+  if ( Z_OK != deflateInit2(&dit_u->pri_u, _DICT_LEV, Z_DEFLATED,
+                            -15, 8, Z_DEFAULT_STRATEGY) )
+  {
+    fprintf(stderr, "dict: deflate init failed\r\n");
+    c3_free(dit_u->are_y);
+    c3_free(dit_u->dic_y);
+    c3_free(dit_u);
+    return 0;
+  }
+
+  if (  dic_w
+     && (Z_OK != deflateSetDictionary(&dit_u->pri_u, dit_u->dic_y, dic_w)) )
+  {
+    fprintf(stderr, "dict: deflate dictionary failed\r\n");
+    u3_dict_free(dit_u);
+    return 0;
+  }
+
+  return dit_u;
+}
+
+/* u3_dict_free(): dispose dictionary.
+*/
+void
+u3_dict_free(u3_dict* dit_u)
+{
+  deflateEnd(&dit_u->pri_u);
+  c3_free(dit_u->are_y);
+  c3_free(dit_u->dic_y);
+  c3_free(dit_u);
+}
+
+/* u3_dict_pack(): compress [len_i] bytes into [out_y], of capacity
+**                 [*out_i], producing the compressed length there.
+**                 c3n if the result would not fit.
+*/
+c3_o
+u3_dict_pack(u3_dict*    dit_u,
+             size_t      len_i,
+             const c3_y* dat_y,
+             c3_y*       out_y,
+             size_t*     out_i)
+{
+  z_stream def_u;
+  c3_i     ret_i;
+
+  if ( (len_i > UINT_MAX) || (*out_i > UINT_MAX) ) {
+    return c3n;
+  }
+
+  dit_u->off_i = 0;
+  dit_u->cop_o = c3y;
+  ret_i = deflateCopy(&def_u, &dit_u->pri_u);
+  dit_u->cop_o = c3n;
+
+  if ( Z_OK != ret_i ) {
+    return c3n;
+  }
+
+  def_u.next_in   = (c3_y*)dat_y;
+  def_u.avail_in  = (uInt)len_i;
+  def_u.next_out  = out_y;
+  def_u.avail_out = (uInt)*out_i;
+
+  ret_i = deflate(&def_u, Z_FINISH);
+  *out_i = def_u.total_out;
+  deflateEnd(&def_u);
+
+  return ( Z_STREAM_END == ret_i ) ? c3y : c3n;
+}
+
+/* u3_dict_unpack(): decompress into exactly [out_i] bytes.
+*/
+c3_o
+u3_dict_unpack(u3_dict*    dit_u,
+               size_t      len_i,
+               const c3_y* dat_y,
+               size_t      out_i,
+               c3_y*       out_y)
+{
+  z_stream inf_u;
+  c3_i     ret_i;
+
+  if ( (len_i > UINT_MAX) || (out_i > UINT_MAX) ) {
+    return c3n;
+  }
+
+  memset(&inf_u, 0, sizeof(inf_u));
+
+  if ( Z_OK != inflateInit2(&inf_u, -15) ) {
+    return c3n;
+  }
+
+  if (  dit_u->dic_w
+     && (Z_OK != inflateSetDictionary(&inf_u, dit_u->dic_y, dit_u->dic_w)) )
+  {
+    inflateEnd(&inf_u);
+    return c3n;
+  }
+
+  inf_u.next_in   = (c3_y*)dat_y;
+  inf_u.avail_in  = (uInt)len_i;
+  inf_u.next_out  = out_y;
+  inf_u.avail_out = (uInt)out_i;
+
+  ret_i = inflate(&inf_u, Z_FINISH);
+
+  inflateEnd(&inf_u);
+
+  return (  (Z_STREAM_END == ret_i)
+         && (out_i == inf_u.total_out) ) ? c3y : c3n;
+}
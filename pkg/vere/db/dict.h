@@ -0,0 +1,61 @@
+/// @file
+
+#ifndef U3_VERE_DB_DICT_H
+#define U3_VERE_DB_DICT_H
+
+#include "c3/c3.h"
+
+  /* dictionary compression
+  */
+#     define u3_dict_max  (1U << 15)  //  deflate window, max dictionary
+
+    /* u3_dict: dictionary compressor.
+    */
+    typedef struct _u3_dict u3_dict;
+
+    /* u3_dict_train(): build a dictionary of up to [max_w] bytes into
+    **                  [dic_y] from [len_d] sample buffers. produces
+    **                  its length, or 0 if the sample is too small.
+    */
+      c3_w
+      u3_dict_train(c3_d    len_d,
+                    c3_y**  byt_y,
+                    size_t* siz_i,
+                    c3_y*   dic_y,
+                    c3_w    max_w);
+
+    /* u3_dict_init(): load dictionary [dic_y], copying it.
+    */
+      u3_dict*
+      u3_dict_init(const c3_y* dic_y, c3_w dic_w);
+
+    /* u3_dict_free(): dispose dictionary.
+    */
+      void
+      u3_dict_free(u3_dict* dit_u);
+
+    /* u3_dict_pack(): compress [len_i] bytes into [out_y], of capacity
+    **                 [*out_i], producing the compressed length there.
+    **                 c3n if the result would not fit.
+    **
+    **   NB: not reentrant; one thread may pack with a given [dit_u].
+    */
+      c3_o
+      u3_dict_pack(u3_dict*    dit_u,
+                   size_t      len_i,
+                   const c3_y* dat_y,
+                   c3_y*       out_y,
+                   size_t*     out_i);
+
+    /* u3_dict_unpack(): decompress into exactly [out_i] bytes.
+    **
+    **   reentrant.
+    */
+      c3_o
+      u3_dict_unpack(u3_dict*    dit_u,
+                     size_t      len_i,
+                     const c3_y* dat_y,
+                     size_t      out_i,
+                     c3_y*       out_y);
+
+#endif /* ifndef U3_VERE_DB_DICT_H */
@@ -33,6 +33,7 @@ intmax_t mdb_get_filesize(mdb_filehandle_t han_u);
 //      - read/save metadata
 //      - read the first and last event numbers
 //      - read/save ranges of events
+//      - delete all events
 //
 
 /* u3_lmdb_init(): open lmdb at [pax_c], mmap up to [siz_i].
@@ -408,6 +409,52 @@ u3_lmdb_save(MDB_env* env_u,
   return c3y;
 }
 
+/* u3_lmdb_wipe(): delete all events, retaining metadata.
+*/
+c3_o
+u3_lmdb_wipe(MDB_env* env_u)
+{
+  MDB_txn* txn_u;
+  MDB_dbi  mdb_u;
+  c3_w     ret_w;
+
+  //  create a write transaction
+  //
+  if ( (ret_w = mdb_txn_begin(env_u, 0, 0, &txn_u)) ) {
+    mdb_logerror(stderr, ret_w, "lmdb: wipe: txn_begin fail");
+    return c3n;
+  }
+
+  //  open the database in the transaction
+  //
+  {
+    c3_w ops_w = MDB_CREATE | MDB_INTEGERKEY;
+
+    if ( (ret_w = mdb_dbi_open(txn_u, "EVENTS", ops_w, &mdb_u)) ) {
+      mdb_logerror(stderr, ret_w, "lmdb: wipe: dbi_open fail");
+      mdb_txn_abort(txn_u);
+      return c3n;
+    }
+  }
+
+  //  empty the database, keeping its handle
+  //
+  if ( (ret_w = mdb_drop(txn_u, mdb_u, 0)) ) {
+    mdb_logerror(stderr, ret_w, "lmdb: wipe: drop fail");
+    mdb_txn_abort(txn_u);
+    return c3n;
+  }
+
+  //  commit transaction
+  //
+  if ( (ret_w = mdb_txn_commit(txn_u)) ) {
+    mdb_logerror(stderr, ret_w, "lmdb: wipe failed");
+    return c3n;
+  }
+
+  return c3y;
+}
+
 /* u3_lmdb_read_meta(): read by string from the META db.
 */
 void
@@ -57,6 +57,11 @@
                    void**   byt_p,
                    size_t*  siz_i);
 
+    /* u3_lmdb_wipe(): delete all events, retaining metadata.
+    */
+      c3_o
+      u3_lmdb_wipe(MDB_env* env_u);
+
     /* u3_lmdb_read_meta(): read by string from the META db.
     */
       void
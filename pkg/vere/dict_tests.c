@@ -0,0 +1,179 @@
+/// @file
+
+#include "db/dict.h"
+#include "noun.h"
+
+#define _SAMPLES  512
+
+/* _event(): deterministic, loosely structured payload for event [eve_d].
+*/
+static size_t
+_event(c3_d eve_d, c3_y* byt_y)
+{
+  static const c3_c* hed_c[] = {
+    "GET /~/channel/1234-abcdef HTTP/1.1 host: sampel-palnet.arvo.network",
+    "PUT /~/channel/1234-abcdef HTTP/1.1 content-type: application/json",
+    "%ames %hear lane ~sampel-palnet ~ravmel-ropdyl packet",
+  };
+  const c3_c* str_c = hed_c[eve_d % 3];
+  size_t      len_i = strlen(str_c);
+  c3_d        val_d = eve_d * 0x9e3779b97f4a7c15ULL;
+  c3_w        i_w;
+
+  memcpy(byt_y, str_c, len_i);
+
+  for ( i_w = 0; i_w < (16 + (eve_d % 64)); i_w++ ) {
+    val_d ^= val_d << 13;
+    val_d ^= val_d >> 7;
+    val_d ^= val_d << 17;
+    byt_y[len_i++] = (c3_y)val_d;
+  }
+
+  return len_i;
+}
+
+/* _train(): train a dictionary on the standard sample.
+*/
+static c3_w
+_train(c3_y* dic_y)
+{
+  c3_y*  byt_y[_SAMPLES];
+  size_t siz_i[_SAMPLES];
+  c3_w   dic_w, i_w;
+
+  for ( i_w = 0; i_w < _SAMPLES; i_w++ ) {
+    byt_y[i_w] = c3_malloc(256);
+    siz_i[i_w] = _event(i_w, byt_y[i_w]);
+  }
+
+  dic_w = u3_dict_train(_SAMPLES, byt_y, siz_i, dic_y, u3_dict_max);
+
+  for ( i_w = 0; i_w < _SAMPLES; i_w++ ) {
+    c3_free(byt_y[i_w]);
+  }
+
+  return dic_w;
+}
+
+/* _test_round_trip(): compress and decompress unseen events.
+*/
+static c3_i
+_test_round_trip(void)
+{
+  c3_y*    dic_y = c3_malloc(u3_dict_max);
+  c3_w     dic_w = _train(dic_y);
+  u3_dict* dit_u;
+  u3_dict* nul_u;
+  size_t   raw_i = 0, pac_i = 0, nul_i = 0;
+  c3_i     ret_i = 1;
+  c3_d     eve_d;
+
+  if ( !dic_w || (dic_w > u3_dict_max) ) {
+    fprintf(stderr, "dict: bad dictionary length %u\r\n", dic_w);
+    c3_free(dic_y);
+    return 0;
+  }
+
+  dit_u = u3_dict_init(dic_y, dic_w);
+  nul_u = u3_dict_init(dic_y, 0);
+
+  for ( eve_d = _SAMPLES; eve_d < (2 * _SAMPLES); eve_d++ ) {
+    c3_y   dat_y[256], out_y[512], bak_y[256];
+    size_t len_i = _event(eve_d, dat_y);
+    size_t out_i = sizeof(out_y);
+
+    if (  (c3n == u3_dict_pack(dit_u, len_i, dat_y, out_y, &out_i))
+       || (c3n == u3_dict_unpack(dit_u, out_i, out_y, len_i, bak_y))
+       || memcmp(dat_y, bak_y, len_i) )
+    {
+      fprintf(stderr, "dict: round trip fail at %" PRIu64 "\r\n", eve_d);
+      ret_i = 0;
+      break;
+    }
+
+    raw_i += len_i;
+    pac_i += out_i;
+
+    //  the wrong length is an error
+    //
+    if ( c3y == u3_dict_unpack(dit_u, out_i, out_y, len_i - 1, bak_y) ) {
+      fprintf(stderr, "dict: short unpack succeeded\r\n");
+      ret_i = 0;
+      break;
+    }
+
+    out_i = sizeof(out_y);
+
+    if ( c3n == u3_dict_pack(nul_u, len_i, dat_y, out_y, &out_i) ) {
+      fprintf(stderr, "dict: pack without dictionary fail\r\n");
+      ret_i = 0;
+      break;
+    }
+
+    nul_i += out_i;
+  }
+
+  //  a trained dictionary should beat none at all
+  //
+  if ( ret_i && (pac_i >= nul_i) ) {
+    fprintf(stderr, "dict: no gain: %zu bytes, %zu without\r\n",
+                    pac_i, nul_i);
+    ret_i = 0;
+  }
+
+  u3_dict_free(nul_u);
+  u3_dict_free(dit_u);
+  c3_free(dic_y);
+
+  return ret_i;
+}
+
+/* _test_limits(): small samples and small buffers are refused.
+*/
+static c3_i
+_test_limits(void)
+{
+  c3_y*    dic_y = c3_malloc(u3_dict_max);
+  c3_y     dat_y[256], out_y[8];
+  c3_y*    byt_y = dat_y;
+  size_t   len_i = _event(1, dat_y);
+  size_t   out_i = sizeof(out_y);
+  u3_dict* dit_u;
+  c3_i     ret_i = 1;
+
+  if ( u3_dict_train(1, &byt_y, &len_i, dic_y, u3_dict_max) ) {
+    fprintf(stderr, "dict: trained on one sample\r\n");
+    ret_i = 0;
+  }
+
+  dit_u = u3_dict_init(dic_y, 0);
+
+  if ( c3y == u3_dict_pack(dit_u, len_i, dat_y, out_y, &out_i) ) {
+    fprintf(stderr, "dict: packed into a short buffer\r\n");
+    ret_i = 0;
+  }
+
+  u3_dict_free(dit_u);
+  c3_free(dic_y);
+
+  return ret_i;
+}
+
+/* main(): run all test cases.
+*/
+int
+main(int argc, char* argv[])
+{
+  if ( !_test_round_trip() ) {
+    fprintf(stderr, "test dict: round trip: failed\r\n");
+    exit(1);
+  }
+
+  if ( !_test_limits() ) {
+    fprintf(stderr, "test dict: limits: failed\r\n");
+    exit(1);
+  }
+
+  fprintf(stderr, "test dict: ok\r\n");
+  return 0;
+}
@@ -4,7 +4,11 @@
 #include "events.h"
 #include "vere.h"
 #include "version.h"
+#include "db/book.h"
+#include "db/dict.h"
 #include "db/lmdb.h"
+#include "ur/ur.h"
+#include <pthread.h>
 #include <types.h>
 
 struct _cd_read {
@@ -25,16 +29,525 @@ struct _cd_save {
   struct _u3_disk* log_u;
 };
 
+/* _cd_ahead: event parsed off-loom by the read-ahead thread.
+*/
+typedef struct _cd_ahead {
+  c3_d       eve_d;                     //  event number
+  c3_l       mug_l;                     //  kernel mug after
+  c3_o       ret_o;                     //  read/parse success
+  ur_root_t* rot_u;                     //  off-loom nouns
+  ur_nref      job;                     //  (pair date ovum)
+} _cd_ahead;
+
+#define _DISK_AHEAD  64                 //  read-ahead depth
+
 struct _u3_disk_walk {
-  u3_lmdb_walk  itr_u;
-  u3_disk*      log_u;
-  c3_o          liv_o;
+  union {                               //  iterator (reader thread)
+    u3_lmdb_walk  mdb_u;                //
+    u3_book_walk  bok_u;                //
+  } itr_u;                              //
+  u3_disk*        log_u;                //  event log
+  c3_o            liv_o;                //  live
+  c3_d            nex_d;                //  next event to step
+  c3_d            las_d;                //  last event to step
+  pthread_t       red_u;                //  reader thread
+  pthread_mutex_t mut_u;                //  guards below
+  pthread_cond_t  ful_u;                //  slot filled / reader done
+  pthread_cond_t  emp_u;                //  slot emptied / halt
+  c3_o            ini_o;                //  reader started
+  c3_o            end_o;                //  reader done
+  c3_o            hal_o;                //  halt requested
+  c3_d            put_d;                //  slots filled
+  c3_d            get_d;                //  slots emptied
+  _cd_ahead       ahe_u[_DISK_AHEAD];   //  read-ahead ring
+};
+
+/* u3_disk_back: event store backend.
+**
+**   each epoch keeps its metadata in lmdb, and its events either
+**   in the same lmdb environment or, if the epoch directory has
+**   a book/ subdirectory, in an append-only log (see db/book.c).
+*/
+struct _u3_disk_back {
+  c3_o (*gulf_f)(u3_disk*, c3_d*, c3_d*);
+  c3_o (*read_f)(u3_disk*, void*, c3_d, c3_d,
+                 c3_o (*)(void*, c3_d, size_t, void*));
+  c3_o (*save_f)(u3_disk*, c3_d, c3_d, void**, size_t*);
+  c3_o (*wini_f)(u3_disk_walk*, c3_d, c3_d);
+  c3_o (*wnex_f)(u3_disk_walk*, size_t*, void**);
+  void (*wdon_f)(u3_disk_walk*);
 };
 
 #undef VERBOSE_DISK
 #undef DISK_TRACE_JAM
 #undef DISK_TRACE_CUE
 
+/* _disk_lmdb_*(): lmdb event store.
+*/
+static c3_o
+_disk_lmdb_gulf(u3_disk* log_u, c3_d* low_d, c3_d* hig_d)
+{
+  return u3_lmdb_gulf(log_u->mdb_u, low_d, hig_d);
+}
+
+static c3_o
+_disk_lmdb_read(u3_disk* log_u,
+                void*    ptr_v,
+                c3_d     eve_d,
+                c3_d     len_d,
+                c3_o   (*read_f)(void*, c3_d, size_t, void*))
+{
+  return u3_lmdb_read(log_u->mdb_u, ptr_v, eve_d, len_d, read_f);
+}
+
+static c3_o
+_disk_lmdb_save(u3_disk* log_u,
+                c3_d     eve_d,
+                c3_d     len_d,
+                void**   byt_p,
+                size_t*  siz_i)
+{
+  return u3_lmdb_save(log_u->mdb_u, eve_d, len_d, byt_p, siz_i);
+}
+
+static c3_o
+_disk_lmdb_wini(u3_disk_walk* wok_u, c3_d nex_d, c3_d las_d)
+{
+  return u3_lmdb_walk_init(wok_u->log_u->mdb_u,
+                          &wok_u->itr_u.mdb_u, nex_d, las_d);
+}
+
+static c3_o
+_disk_lmdb_wnex(u3_disk_walk* wok_u, size_t* len_i, void** buf_v)
+{
+  return u3_lmdb_walk_next(&wok_u->itr_u.mdb_u, len_i, buf_v);
+}
+
+static void
+_disk_lmdb_wdon(u3_disk_walk* wok_u)
+{
+  u3_lmdb_walk_done(&wok_u->itr_u.mdb_u);
+}
+
+static u3_disk_back _disk_back_lmdb = {
+  .gulf_f = _disk_lmdb_gulf,
+  .read_f = _disk_lmdb_read,
+  .save_f = _disk_lmdb_save,
+  .wini_f = _disk_lmdb_wini,
+  .wnex_f = _disk_lmdb_wnex,
+  .wdon_f = _disk_lmdb_wdon,
+};
+
+/* _disk_book_*(): append-only event store.
+*/
+static c3_o
+_disk_book_gulf(u3_disk* log_u, c3_d* low_d, c3_d* hig_d)
+{
+  return u3_book_gulf(log_u->bok_u, low_d, hig_d);
+}
+
+static c3_o
+_disk_book_read(u3_disk* log_u,
+                void*    ptr_v,
+                c3_d     eve_d,
+                c3_d     len_d,
+                c3_o   (*read_f)(void*, c3_d, size_t, void*))
+{
+  return u3_book_read(log_u->bok_u, ptr_v, eve_d, len_d, read_f);
+}
+
+static c3_o
+_disk_book_save(u3_disk* log_u,
+                c3_d     eve_d,
+                c3_d     len_d,
+                void**   byt_p,
+                size_t*  siz_i)
+{
+  return u3_book_save(log_u->bok_u, eve_d, len_d, byt_p, siz_i);
+}
+
+static c3_o
+_disk_book_wini(u3_disk_walk* wok_u, c3_d nex_d, c3_d las_d)
+{
+  return u3_book_walk_init(wok_u->log_u->bok_u,
+                          &wok_u->itr_u.bok_u, nex_d, las_d);
+}
+
+static c3_o
+_disk_book_wnex(u3_disk_walk* wok_u, size_t* len_i, void** buf_v)
+{
+  return u3_book_walk_next(&wok_u->itr_u.bok_u, len_i, buf_v);
+}
+
+static void
+_disk_book_wdon(u3_disk_walk* wok_u)
+{
+  u3_book_walk_done(&wok_u->itr_u.bok_u);
+}
+
+static u3_disk_back _disk_back_book = {
+  .gulf_f = _disk_book_gulf,
+  .read_f = _disk_book_read,
+  .save_f = _disk_book_save,
+  .wini_f = _disk_book_wini,
+  .wnex_f = _disk_book_wnex,
+  .wdon_f = _disk_book_wdon,
+};
+
+/* event compression
+**
+**   with --log-compress, events are compressed with a dictionary
+**   trained from a sample of the pier's own events (see db/dict.c),
+**   kept in the epoch's metadata. a compressed record sets the high
+**   bit of its mug (which is 31 bits), and is followed by the length
+**   of the jam (4 bytes, little-endian) and the compressed jam.
+**   records that would not shrink are stored as before.
+*/
+#define _DISK_ZIP_MIN  64               //  events needed for training
+#define _DISK_ZIP_LEN  4096             //  events sampled for training
+#define _DISK_ZIP_MAX  (1ULL << 23)     //  bytes sampled for training
+#define _DISK_ZIP_RAT  1032             //  deflate's greatest expansion
+
+/* _cd_dict: dictionary read from metadata.
+*/
+struct _cd_dict {
+  c3_w  dic_w;                          //  length
+  c3_y* dic_y;                          //  bytes, of u3_dict_max
+};
+
+/* _disk_zip_read_cb(): copy a dictionary from metadata, if present.
+*/
+static void
+_disk_zip_read_cb(void* ptr_v, ssize_t val_i, void* val_v)
+{
+  struct _cd_dict* dic_u = ptr_v;
+
+  if ( (0 < val_i) && (u3_dict_max >= val_i) ) {
+    memcpy(dic_u->dic_y, val_v, val_i);
+    dic_u->dic_w = (c3_w)val_i;
+  }
+}
+
+/* _disk_zip_read(): read the dictionary of the epoch at [mdb_u] into
+**                   [dic_y], of u3_dict_max bytes. produces its length.
+*/
+static c3_w
+_disk_zip_read(MDB_env* mdb_u, c3_y* dic_y)
+{
+  struct _cd_dict dic_u = { 0, dic_y };
+
+  u3_lmdb_read_meta(mdb_u, &dic_u, "dict", _disk_zip_read_cb);
+  return dic_u.dic_w;
+}
+
+/* _disk_zip_load(): load the dictionary of the current epoch, if any.
+*/
+static c3_o
+_disk_zip_load(u3_disk* log_u)
+{
+  c3_y* dic_y = c3_malloc(u3_dict_max);
+  c3_w  dic_w = _disk_zip_read(log_u->mdb_u, dic_y);
+
+  if ( dic_w && (0 == (log_u->dit_u = u3_dict_init(dic_y, dic_w))) ) {
+    fprintf(stderr, "disk: failed to load event dictionary\r\n");
+    c3_free(dic_y);
+    return c3n;
+  }
+
+  c3_free(dic_y);
+  return c3y;
+}
+
+/* _disk_zip_save(): save [dic_y] as the dictionary of the current epoch.
+*/
+static c3_o
+_disk_zip_save(u3_disk* log_u, c3_w dic_w, c3_y* dic_y)
+{
+  u3_dict* dit_u;
+
+  if (  (c3n == u3_lmdb_save_meta(log_u->mdb_u, "dict", dic_w, dic_y))
+     || (0 == (dit_u = u3_dict_init(dic_y, dic_w))) )
+  {
+    fprintf(stderr, "disk: failed to save event dictionary\r\n");
+    return c3n;
+  }
+
+  if ( log_u->dit_u ) {
+    u3_dict_free(log_u->dit_u);
+  }
+
+  log_u->dit_u = dit_u;
+  return c3y;
+}
+
+/* _disk_zip_open(): produce the jam of event record [dat_y], at
+**                   [dat_y + 4] or, if compressed, in a new buffer.
+*/
+static c3_o
+_disk_zip_open(u3_disk* log_u,
+               size_t   len_i,
+               c3_y*    dat_y,
+               size_t*  jam_i,
+               c3_y**   jam_y)
+{
+  c3_w raw_w;
+
+  if ( !(0x80 & dat_y[3]) ) {
+    *jam_i = len_i - 4;
+    *jam_y = dat_y + 4;
+    return c3y;
+  }
+
+  if ( !log_u->dit_u ) {
+    fprintf(stderr, "disk: compressed event without dictionary\r\n");
+    return c3n;
+  }
+
+  if ( 8 >= len_i ) {
+    return c3n;
+  }
+
+  raw_w = dat_y[4]
+        ^ (dat_y[5] <<  8)
+        ^ (dat_y[6] << 16)
+        ^ ((c3_w)dat_y[7] << 24);
+
+  //  a corrupt length must not drive the allocation
+  //
+  if ( !raw_w || ((c3_d)raw_w > ((c3_d)(len_i - 8) * _DISK_ZIP_RAT)) ) {
+    fprintf(stderr, "disk: compressed event: bad length %u\r\n", raw_w);
+    return c3n;
+  }
+
+  *jam_y = c3_malloc(raw_w);
+
+  if ( c3n == u3_dict_unpack(log_u->dit_u, len_i - 8, dat_y + 8,
+                             raw_w, *jam_y) )
+  {
+    c3_free(*jam_y);
+    return c3n;
+  }
+
+  *jam_i = raw_w;
+  return c3y;
+}
+
+/* _disk_zip_pack(): compress a write batch, where records shrink.
+*/
+static void
+_disk_zip_pack(u3_dict* dit_u, c3_d len_d, c3_y** byt_y, size_t* siz_i)
+{
+  c3_y*  out_y;
+  size_t out_i;
+  c3_d   i_d;
+
+  for ( i_d = 0; i_d < len_d; i_d++ ) {
+    c3_y*  dat_y = byt_y[i_d];
+    size_t len_i = siz_i[i_d];
+
+    //  too small to shrink, or too large to mark
+    //
+    if ( (len_i < 64) || ((len_i - 4) > 0xffffffffULL) ) {
+      continue;
+    }
+
+    out_y = c3_malloc(len_i);
+    out_i = len_i - 9;
+
+    if ( c3n == u3_dict_pack(dit_u, len_i - 4, dat_y + 4,
+                             out_y + 8, &out_i) )
+    {
+      c3_free(out_y);
+      continue;
+    }
+
+    out_y[0] = dat_y[0];
+    out_y[1] = dat_y[1];
+    out_y[2] = dat_y[2];
+    out_y[3] = dat_y[3] | 0x80;
+    out_y[4] = (len_i - 4) & 0xff;
+    out_y[5] = ((len_i - 4) >> 8) & 0xff;
+    out_y[6] = ((len_i - 4) >> 16) & 0xff;
+    out_y[7] = ((len_i - 4) >> 24) & 0xff;
+
+    c3_free(dat_y);
+    byt_y[i_d] = out_y;
+    siz_i[i_d] = 8 + out_i;
+  }
+}
+
+/* _cd_zip: dictionary training sample.
+*/
+struct _cd_zip {
+  u3_disk* log_u;
+  c3_d     len_d;                       //  events sampled
+  size_t   tot_i;                       //  bytes sampled
+  c3_y**   byt_y;                       //  jams
+  size_t*  siz_i;                       //  jam lengths
+};
+
+/* _disk_zip_sample_cb(): collect an event for training.
+*/
+static c3_o
+_disk_zip_sample_cb(void* ptr_v, c3_d eve_d, size_t val_i, void* val_p)
+{
+  struct _cd_zip* zip_u = ptr_v;
+  c3_y*           dat_y = val_p;
+  c3_y*           jam_y;
+  size_t          jam_i;
+
+  if ( (4 >= val_i) || (_DISK_ZIP_MAX <= zip_u->tot_i) ) {
+    return c3y;
+  }
+
+  if ( c3n == _disk_zip_open(zip_u->log_u, val_i, dat_y, &jam_i, &jam_y) ) {
+    return c3n;
+  }
+
+  if ( (dat_y + 4) == jam_y ) {
+    jam_y = c3_malloc(jam_i);
+    memcpy(jam_y, dat_y + 4, jam_i);
+  }
+
+  zip_u->byt_y[zip_u->len_d] = jam_y;
+  zip_u->siz_i[zip_u->len_d] = jam_i;
+  zip_u->len_d++;
+  zip_u->tot_i += jam_i;
+
+  return c3y;
+}
+
+/* _disk_zip_ratio(): compression ratio of [dit_u] on a sample.
+*/
+static double
+_disk_zip_ratio(u3_dict* dit_u, struct _cd_zip* zip_u)
+{
+  size_t out_i, pac_i = 0, tot_i = 0;
+  c3_y*  out_y = 0;
+  c3_d   i_d;
+
+  for ( i_d = 0; i_d < zip_u->len_d; i_d++ ) {
+    out_y = c3_realloc(out_y, zip_u->siz_i[i_d]);
+    out_i = zip_u->siz_i[i_d];
+    tot_i += zip_u->siz_i[i_d];
+
+    pac_i += ( c3y == u3_dict_pack(dit_u, zip_u->siz_i[i_d],
+                                   zip_u->byt_y[i_d], out_y, &out_i) )
+             ? c3_min(out_i + 4, zip_u->siz_i[i_d])
+             : zip_u->siz_i[i_d];
+  }
+
+  c3_free(out_y);
+  return ( pac_i ) ? ((double)tot_i / pac_i) : 1.0;
+}
+
+/* _disk_zip_train(): train a dictionary into [dic_y], of u3_dict_max
+**                    bytes, on the latest events of the current epoch.
+**                    produces its length, or 0.
+*/
+static c3_w
+_disk_zip_train(u3_disk* log_u, c3_y* dic_y)
+{
+  struct _cd_zip zip_u = { log_u, 0, 0, 0, 0 };
+  c3_d           fir_d, las_d, len_d;
+  c3_w           dic_w = 0;
+
+  if (  (c3n == log_u->bak_u->gulf_f(log_u, &fir_d, &las_d))
+     || !las_d
+     || (_DISK_ZIP_MIN > (las_d - fir_d + 1)) )
+  {
+    return 0;
+  }
+
+  len_d = c3_min(las_d - fir_d + 1, _DISK_ZIP_LEN);
+  zip_u.byt_y = c3_malloc(len_d * sizeof(*zip_u.byt_y));
+  zip_u.siz_i = c3_malloc(len_d * sizeof(*zip_u.siz_i));
+
+  if (  (c3y == log_u->bak_u->read_f(log_u, &zip_u, las_d - len_d + 1,
+                                     len_d, _disk_zip_sample_cb))
+     && (dic_w = u3_dict_train(zip_u.len_d, zip_u.byt_y, zip_u.siz_i,
+                               dic_y, u3_dict_max)) )
+  {
+    u3_dict* dit_u = u3_dict_init(dic_y, dic_w);
+    u3_dict* nul_u = u3_dict_init(dic_y, 0);
+
+    fprintf(stderr, "disk: trained %u-byte event dictionary on %" PRIu64
+                    " events: %.2fx (%.2fx without)\r\n",
+                    dic_w, zip_u.len_d,
+                    _disk_zip_ratio(dit_u, &zip_u),
+                    _disk_zip_ratio(nul_u, &zip_u));
+
+    u3_dict_free(nul_u);
+    u3_dict_free(dit_u);
+  }
+
+  while ( zip_u.len_d-- ) {
+    c3_free(zip_u.byt_y[zip_u.len_d]);
+  }
+
+  c3_free(zip_u.byt_y);
+  c3_free(zip_u.siz_i);
+
+  return dic_w;
+}
+
+/* _disk_back_open(): open the event store of the epoch at [epo_c].
+**
+**   NB: requires that log_u->mdb_u is initialized to the epoch's lmdb
+*/
+static c3_o
+_disk_back_open(u3_disk* log_u, const c3_c* epo_c)
+{
+  c3_c bok_c[8193];
+  snprintf(bok_c, sizeof(bok_c), "%s/book", epo_c);
+
+  if ( c3n == _disk_zip_load(log_u) ) {
+    return c3n;
+  }
+
+  if ( 0 != access(bok_c, F_OK) ) {
+    log_u->bak_u = &_disk_back_lmdb;
+    log_u->bok_u = 0;
+    return c3y;
+  }
+
+  //  an unlocked log is a read-only view (see u3_disk_epoc_view())
+  //
+  if ( 0 == (log_u->bok_u = u3_book_init(bok_c, ( -1 == log_u->lok_i )
+                                                ? c3y : c3n)) )
+  {
+    fprintf(stderr, "disk: failed to open event store at %s\r\n", bok_c);
+
+    if ( log_u->dit_u ) {
+      u3_dict_free(log_u->dit_u);
+      log_u->dit_u = 0;
+    }
+
+    return c3n;
+  }
+
+  log_u->bak_u = &_disk_back_book;
+  return c3y;
+}
+
+/* _disk_back_close(): close the event store of the current epoch.
+*/
+static void
+_disk_back_close(u3_disk* log_u)
+{
+  if ( log_u->bok_u ) {
+    u3_book_exit(log_u->bok_u);
+    log_u->bok_u = 0;
+  }
+
+  if ( log_u->dit_u ) {
+    u3_dict_free(log_u->dit_u);
+    log_u->dit_u = 0;
+  }
+
+  log_u->bak_u = &_disk_back_lmdb;
+}
+
 static void
 _disk_commit(u3_disk* log_u);
 
@@ -134,11 +647,19 @@ static void
 _disk_commit_cb(uv_work_t* ted_u)
 {
   struct _cd_save* req_u = ted_u->data;
-  req_u->ret_o = u3_lmdb_save(req_u->log_u->mdb_u,
-                              req_u->eve_d,
-                              req_u->len_d,
-                              (void**)req_u->byt_y, // XX safe?
-                              req_u->siz_i);
+  u3_disk*         log_u = req_u->log_u;
+
+  if (  log_u->dit_u
+     && (c3y == u3_Host.ops_u.zip) )
+  {
+    _disk_zip_pack(log_u->dit_u, req_u->len_d, req_u->byt_y, req_u->siz_i);
+  }
+
+  req_u->ret_o = log_u->bak_u->save_f(log_u,
+                                      req_u->eve_d,
+                                      req_u->len_d,
+                                      (void**)req_u->byt_y, // XX safe?
+                                      req_u->siz_i);
 }
 
 /* _disk_commit_start(): queue async event-batch write.
@@ -220,8 +741,24 @@ _disk_batch(u3_disk* log_u, c3_d len_d)
   for ( c3_d i_d = 0ULL; i_d < len_d; ++i_d) {
     u3_assert( (req_u->eve_d + i_d) == tac_u->eve_d );
 
-    req_u->siz_i[i_d] = u3_disk_etch(log_u, tac_u->job,
-                                     tac_u->mug_l, &req_u->byt_y[i_d]);
+    //  reuse the jam from the ipc path, if any, filling in the mug
+    //
+    if ( tac_u->dat_y ) {
+      c3_y* dat_y = tac_u->dat_y;
+
+      dat_y[0] = tac_u->mug_l & 0xff;
+      dat_y[1] = (tac_u->mug_l >> 8) & 0xff;
+      dat_y[2] = (tac_u->mug_l >> 16) & 0xff;
+      dat_y[3] = (tac_u->mug_l >> 24) & 0xff;
+
+      req_u->byt_y[i_d] = dat_y;
+      req_u->siz_i[i_d] = tac_u->len_i;
+      tac_u->dat_y = 0;
+    }
+    else {
+      req_u->siz_i[i_d] = u3_disk_etch(log_u, tac_u->job,
+                                       tac_u->mug_l, &req_u->byt_y[i_d]);
+    }
 
     tac_u = tac_u->nex_u;
   }
@@ -388,6 +925,9 @@ u3_disk_sift(u3_disk* log_u,
              c3_l*    mug_l,
              u3_noun*   job)
 {
+  size_t jam_i;
+  c3_y*  jam_y;
+
   if ( 4 >= len_i ) {
     return c3n;
   }
@@ -401,11 +941,19 @@ u3_disk_sift(u3_disk* log_u,
   *mug_l = dat_y[0]
          ^ (dat_y[1] <<  8)
          ^ (dat_y[2] << 16)
-         ^ (dat_y[3] << 24);
+         ^ ((dat_y[3] & 0x7f) << 24);
+
+  if ( c3n == _disk_zip_open(log_u, len_i, dat_y, &jam_i, &jam_y) ) {
+    return c3n;
+  }
 
   //  XX u3m_soft?
   //
-  *job = u3ke_cue(u3i_bytes(len_i - 4, dat_y + 4));
+  *job = u3ke_cue(u3i_bytes(jam_i, jam_y));
+
+  if ( (dat_y + 4) != jam_y ) {
+    c3_free(jam_y);
+  }
 
 #ifdef DISK_TRACE_CUE
   u3t_event_trace("disk sift", 'E');
@@ -459,11 +1007,11 @@ _disk_read_start_cb(uv_timer_t* tim_u)
 
   //  read events synchronously
   //
-  if ( c3n == u3_lmdb_read(log_u->mdb_u,
-                           red_u,
-                           red_u->eve_d,
-                           red_u->len_d,
-                           _disk_read_one_cb) )
+  if ( c3n == log_u->bak_u->read_f(log_u,
+                                   red_u,
+                                   red_u->eve_d,
+                                   red_u->len_d,
+                                   _disk_read_one_cb) )
   {
     log_u->cb_u.read_bail_f(log_u->cb_u.ptr_v, red_u->eve_d);
     _disk_read_close(red_u);
@@ -537,8 +1085,8 @@ u3_disk_read_list(u3_disk* log_u, c3_d eve_d, c3_d len_d, c3_l* mug_l)
 {
   struct _cd_list ven_u = { log_u, u3_nul, 0 };
 
-  if ( c3n == u3_lmdb_read(log_u->mdb_u, &ven_u,
-                           eve_d, len_d, _disk_read_list_cb) )
+  if ( c3n == log_u->bak_u->read_f(log_u, &ven_u,
+                                   eve_d, len_d, _disk_read_list_cb) )
   {
     u3z(ven_u.eve);
     return u3_none;
@@ -548,6 +1096,137 @@ u3_disk_read_list(u3_disk* log_u, c3_d eve_d, c3_d len_d, c3_l* mug_l)
   return u3kb_flop(ven_u.eve);
 }
 
+/* _disk_walk_sift(): parse a persisted event buffer off-loom.
+*/
+static c3_o
+_disk_walk_sift(u3_disk*   log_u,
+                _cd_ahead* ahe_u,
+                size_t     len_i,
+                c3_y*      dat_y)
+{
+  size_t jam_i;
+  c3_y*  jam_y;
+  c3_o   ret_o;
+
+  if ( 4 >= len_i ) {
+    return c3n;
+  }
+
+  ahe_u->mug_l = dat_y[0]
+               ^ (dat_y[1] <<  8)
+               ^ (dat_y[2] << 16)
+               ^ ((dat_y[3] & 0x7f) << 24);
+
+  if ( c3n == _disk_zip_open(log_u, len_i, dat_y, &jam_i, &jam_y) ) {
+    return c3n;
+  }
+
+  ahe_u->rot_u = ur_root_init();
+
+  ret_o = ( ur_cue_good == ur_cue(ahe_u->rot_u, jam_i, jam_y, &ahe_u->job) )
+          ? c3y : c3n;
+
+  if ( (dat_y + 4) != jam_y ) {
+    c3_free(jam_y);
+  }
+
+  return ret_o;
+}
+
+/* _disk_walk_read(): read-ahead thread, cue events off-loom.
+**
+**   events are read and parsed into hash-consed ur nouns
+**   up to [_DISK_AHEAD] ahead of the consumer, which need
+**   only copy them onto the loom. the lmdb read transaction
+**   is thread-bound, and so is opened and closed here.
+*/
+static void*
+_disk_walk_read(void* ptr_v)
+{
+  u3_disk_walk* wok_u = ptr_v;
+  u3_disk_back* bak_u = wok_u->log_u->bak_u;
+  _cd_ahead*    ahe_u;
+  c3_o          liv_o, hal_o;
+  c3_d          eve_d = wok_u->nex_d;
+  size_t        len_i;
+  void*         buf_v;
+
+  {
+    sigset_t set;
+    sigfillset(&set);
+    pthread_sigmask(SIG_BLOCK, &set, NULL);
+  }
+
+  liv_o = bak_u->wini_f(wok_u, wok_u->nex_d, wok_u->las_d);
+
+  pthread_mutex_lock(&wok_u->mut_u);
+  wok_u->ini_o = c3y;
+  wok_u->liv_o = liv_o;
+  pthread_cond_broadcast(&wok_u->ful_u);
+  pthread_mutex_unlock(&wok_u->mut_u);
+
+  if ( c3n == liv_o ) {
+    return 0;
+  }
+
+  while ( eve_d <= wok_u->las_d ) {
+    pthread_mutex_lock(&wok_u->mut_u);
+    while (  (c3n == wok_u->hal_o)
+          && (_DISK_AHEAD == (wok_u->put_d - wok_u->get_d)) )
+    {
+      pthread_cond_wait(&wok_u->emp_u, &wok_u->mut_u);
+    }
+    hal_o = wok_u->hal_o;
+    pthread_mutex_unlock(&wok_u->mut_u);
+
+    if ( c3y == hal_o ) {
+      break;
+    }
+
+    //  slots at or beyond [get_d] are ours; release a consumed root
+    //
+    ahe_u = &wok_u->ahe_u[wok_u->put_d % _DISK_AHEAD];
+
+    if ( ahe_u->rot_u ) {
+      ur_root_free(ahe_u->rot_u);
+      ahe_u->rot_u = 0;
+    }
+
+    ahe_u->eve_d = eve_d++;
+    ahe_u->ret_o = c3n;
+
+    if ( c3n == bak_u->wnex_f(wok_u, &len_i, &buf_v) ) {
+      fprintf(stderr, "disk: (%" PRIu64 "): read fail\r\n", ahe_u->eve_d);
+    }
+    else if ( c3n == _disk_walk_sift(wok_u->log_u, ahe_u,
+                                     len_i, (c3_y*)buf_v) )
+    {
+      fprintf(stderr, "disk: (%" PRIu64 "): sift fail\r\n", ahe_u->eve_d);
+    }
+    else {
+      ahe_u->ret_o = c3y;
+    }
+
+    pthread_mutex_lock(&wok_u->mut_u);
+    wok_u->put_d++;
+    pthread_cond_signal(&wok_u->ful_u);
+    pthread_mutex_unlock(&wok_u->mut_u);
+
+    if ( c3n == ahe_u->ret_o ) {
+      break;
+    }
+  }
+
+  bak_u->wdon_f(wok_u);
+
+  pthread_mutex_lock(&wok_u->mut_u);
+  wok_u->end_o = c3y;
+  pthread_cond_signal(&wok_u->ful_u);
+  pthread_mutex_unlock(&wok_u->mut_u);
+
+  return 0;
+}
+
 /* u3_disk_walk_init(): init iterator.
 */
 u3_disk_walk*
@@ -555,16 +1234,40 @@ u3_disk_walk_init(u3_disk* log_u,
                   c3_d     eve_d,
                   c3_d     len_d)
 {
-  u3_disk_walk* wok_u = c3_malloc(sizeof(*wok_u));
+  u3_disk_walk* wok_u = c3_calloc(sizeof(*wok_u));
   c3_d          max_d = eve_d + len_d - 1;
 
   wok_u->log_u = log_u;
-  wok_u->liv_o = u3_lmdb_walk_init(log_u->mdb_u,
-                                  &wok_u->itr_u,
-                                   eve_d,
-                                   c3_min(max_d, log_u->dun_d));
+  wok_u->nex_d = eve_d;
+  wok_u->las_d = c3_min(max_d, log_u->dun_d);
+  wok_u->ini_o = c3n;
+  wok_u->end_o = c3n;
+  wok_u->hal_o = c3n;
+
+  pthread_mutex_init(&wok_u->mut_u, NULL);
+  pthread_cond_init(&wok_u->ful_u, NULL);
+  pthread_cond_init(&wok_u->emp_u, NULL);
+
+  if ( pthread_create(&wok_u->red_u, NULL, _disk_walk_read, wok_u) ) {
+    fprintf(stderr, "disk: walk: thread create fail: %s\r\n", strerror(errno));
+    wok_u->liv_o = c3n;
+  }
+  else {
+    pthread_mutex_lock(&wok_u->mut_u);
+    while ( c3n == wok_u->ini_o ) {
+      pthread_cond_wait(&wok_u->ful_u, &wok_u->mut_u);
+    }
+    pthread_mutex_unlock(&wok_u->mut_u);
+
+    if ( c3n == wok_u->liv_o ) {
+      pthread_join(wok_u->red_u, NULL);
+    }
+  }
 
   if ( c3n == wok_u->liv_o ) {
+    pthread_cond_destroy(&wok_u->emp_u);
+    pthread_cond_destroy(&wok_u->ful_u);
+    pthread_mutex_destroy(&wok_u->mut_u);
     c3_free(wok_u);
     return 0;
   }
@@ -577,7 +1280,7 @@ u3_disk_walk_init(u3_disk* log_u,
 c3_o
 u3_disk_walk_live(u3_disk_walk* wok_u)
 {
-  if ( wok_u->itr_u.nex_d > wok_u->itr_u.las_d ) {
+  if ( wok_u->nex_d > wok_u->las_d ) {
     wok_u->liv_o = c3n;
   }
 
@@ -589,26 +1292,54 @@ u3_disk_walk_live(u3_disk_walk* wok_u)
 c3_o
 u3_disk_walk_step(u3_disk_walk* wok_u, u3_fact* tac_u)
 {
-  u3_disk* log_u = wok_u->log_u;
-  size_t   len_i;
-  void*    buf_v;
+  _cd_ahead* ahe_u;
+  c3_o       fil_o;
 
-  tac_u->eve_d = wok_u->itr_u.nex_d;
+  tac_u->eve_d = wok_u->nex_d;
+  tac_u->len_i = 0;
+  tac_u->dat_y = 0;
 
-  if ( c3n == u3_lmdb_walk_next(&wok_u->itr_u, &len_i, &buf_v) ) {
+  pthread_mutex_lock(&wok_u->mut_u);
+  while (  (c3n == wok_u->end_o)
+        && (wok_u->put_d == wok_u->get_d) )
+  {
+    pthread_cond_wait(&wok_u->ful_u, &wok_u->mut_u);
+  }
+  fil_o = __(wok_u->put_d != wok_u->get_d);
+  pthread_mutex_unlock(&wok_u->mut_u);
+
+  if ( c3n == fil_o ) {
     fprintf(stderr, "disk: (%" PRIu64 "): read fail\r\n", tac_u->eve_d);
     return wok_u->liv_o = c3n;
   }
 
-  if ( c3n == u3_disk_sift(log_u, len_i,
-                           (c3_y*)buf_v,
-                           &tac_u->mug_l,
-                           &tac_u->job) )
-  {
-    fprintf(stderr, "disk: (%" PRIu64 "): sift fail\r\n", tac_u->eve_d);
+  ahe_u = &wok_u->ahe_u[wok_u->get_d % _DISK_AHEAD];
+  u3_assert( ahe_u->eve_d == tac_u->eve_d );
+
+  if ( c3n == ahe_u->ret_o ) {
     return wok_u->liv_o = c3n;
   }
 
+#ifdef DISK_TRACE_CUE
+  u3t_event_trace("disk walk", 'B');
+#endif
+
+  tac_u->mug_l = ahe_u->mug_l;
+  tac_u->job   = u3u_from_ur(ahe_u->rot_u, ahe_u->job);
+
+#ifdef DISK_TRACE_CUE
+  u3t_event_trace("disk walk", 'E');
+#endif
+
+  //  the reader thread frees the root when it reuses the slot
+  //
+  pthread_mutex_lock(&wok_u->mut_u);
+  wok_u->get_d++;
+  pthread_cond_signal(&wok_u->emp_u);
+  pthread_mutex_unlock(&wok_u->mut_u);
+
+  wok_u->nex_d++;
+
   return c3y;
 }
 
@@ -617,7 +1348,24 @@ u3_disk_walk_step(u3_disk_walk* wok_u, u3_fact* tac_u)
 void
 u3_disk_walk_done(u3_disk_walk* wok_u)
 {
-  u3_lmdb_walk_done(&wok_u->itr_u);
+  c3_w i_w;
+
+  pthread_mutex_lock(&wok_u->mut_u);
+  wok_u->hal_o = c3y;
+  pthread_cond_signal(&wok_u->emp_u);
+  pthread_mutex_unlock(&wok_u->mut_u);
+
+  pthread_join(wok_u->red_u, NULL);
+
+  for ( i_w = 0; i_w < _DISK_AHEAD; i_w++ ) {
+    if ( wok_u->ahe_u[i_w].rot_u ) {
+      ur_root_free(wok_u->ahe_u[i_w].rot_u);
+    }
+  }
+
+  pthread_cond_destroy(&wok_u->emp_u);
+  pthread_cond_destroy(&wok_u->ful_u);
+  pthread_mutex_destroy(&wok_u->mut_u);
   c3_free(wok_u);
 }
 
@@ -991,6 +1739,7 @@ u3_disk_exit(u3_disk* log_u)
 
   //  close database
   //
+  _disk_back_close(log_u);
   u3_lmdb_exit(log_u->mdb_u);
 
   //  dispose planned writes
@@ -1007,7 +1756,9 @@ u3_disk_exit(u3_disk* log_u)
     }
   }
 
-  _disk_release(log_u->dir_u->pax_c, log_u->lok_i);
+  if ( -1 != log_u->lok_i ) {
+    _disk_release(log_u->dir_u->pax_c, log_u->lok_i);
+  }
 
   u3_dire_free(log_u->dir_u);
   u3_dire_free(log_u->urb_u);
@@ -1321,10 +2072,34 @@ _disk_epoc_roll(u3_disk* log_u, c3_d epo_d)
     fprintf(stderr, "disk: failed to read metadata\r\n");
     goto fail3;
   }
-  
+
+  //  the new epoch keeps the event store of the old
+  c3_o bok_o = ( log_u->bok_u ) ? c3y : c3n;
+
+  //  and a dictionary retrained on its latest events, or carried over
+  c3_y dic_y[u3_dict_max];
+  c3_w dic_w = 0;
+
+  if ( c3y == u3_Host.ops_u.zip ) {
+    if ( !(dic_w = _disk_zip_train(log_u, dic_y)) ) {
+      dic_w = _disk_zip_read(log_u->mdb_u, dic_y);
+    }
+  }
+
+  _disk_back_close(log_u);
   u3_lmdb_exit(log_u->mdb_u);
   log_u->mdb_u = 0;
 
+  if ( c3y == bok_o ) {
+    c3_c bok_c[8193];
+    snprintf(bok_c, sizeof(bok_c), "%s/book", epo_c);
+
+    if ( c3_mkdir(bok_c, 0700) && (EEXIST != errno) ) {
+      fprintf(stderr, "disk: create %s failed: %s\r\n", bok_c, strerror(errno));
+      goto fail3;
+    }
+  }
+
   //  initialize db of new epoch
   if ( 0 == (log_u->mdb_u = u3_lmdb_init(epo_c, u3_Host.ops_u.siz_i)) ) {
     fprintf(stderr, "disk: failed to initialize database\r\n");
@@ -1332,12 +2107,20 @@ _disk_epoc_roll(u3_disk* log_u, c3_d epo_d)
     goto fail3;
   }
 
+  if ( c3n == _disk_back_open(log_u, epo_c) ) {
+    goto fail3;
+  }
+
   // write the metadata to the database
   if ( c3n == u3_disk_save_meta(log_u->mdb_u, U3D_VERLAT, who_d, fak_o, lif_w) ) {
     fprintf(stderr, "disk: failed to save metadata\r\n");
     goto fail3;
   }
 
+  if ( dic_w && (c3n == _disk_zip_save(log_u, dic_w, dic_y)) ) {
+    goto fail3;
+  }
+
   if ( -1 == c3_sync(epo_i) ) {  //  XX fdatasync on linux?
     fprintf(stderr, "disk: sync epoch dir %" PRIc3_d " failed: %s\r\n",
                     epo_d, strerror(errno));
@@ -1365,6 +2148,40 @@ fail1:
   return c3n;
 }
 
+/* _disk_book_kill(): delete an append-only event store.
+*/
+static c3_o
+_disk_book_kill(const c3_c* bok_c)
+{
+  u3_dire* dir_u = u3_foil_folder(bok_c);
+  u3_dent* den_u;
+
+  if ( !dir_u ) {
+    return c3n;
+  }
+
+  for ( den_u = dir_u->all_u; den_u; den_u = den_u->nex_u ) {
+    c3_c fil_c[8193];
+    snprintf(fil_c, sizeof(fil_c), "%s/%s", bok_c, den_u->nam_c);
+    if ( 0 != c3_unlink(fil_c) ) {
+      fprintf(stderr, "disk: failed to delete %s: %s\r\n",
+                      fil_c, strerror(errno));
+      u3_dire_free(dir_u);
+      return c3n;
+    }
+  }
+
+  u3_dire_free(dir_u);
+
+  if ( 0 != c3_rmdir(bok_c) ) {
+    fprintf(stderr, "disk: failed to delete %s: %s\r\n",
+                    bok_c, strerror(errno));
+    return c3n;
+  }
+
+  return c3y;
+}
+
 /* _disk_epoc_kill: delete an epoch.
 */
 static c3_o
@@ -1387,6 +2204,19 @@ _disk_epoc_kill(u3_disk* log_u, c3_d epo_d)
     den_u = den_u->nex_u;
   }
 
+  //  delete append-only event store, if any
+  for ( den_u = dir_u->dil_u; den_u; den_u = den_u->nex_u ) {
+    if (  (0 == strcmp("book", den_u->nam_c))
+       || (0 == strcmp("book.tmp", den_u->nam_c)) )
+    {
+      c3_c bok_c[8193];
+      snprintf(bok_c, sizeof(bok_c), "%s/%s", epo_c, den_u->nam_c);
+      if ( c3n == _disk_book_kill(bok_c) ) {
+        return c3n;
+      }
+    }
+  }
+
   //  delete epoch directory
   if ( 0 != c3_rmdir(epo_c) ) {
     fprintf(stderr, "disk: failed to delete epoch directory\r\n");
@@ -1752,7 +2582,7 @@ u3_disk_roll(u3_disk* log_u, c3_d eve_d)
   //  XX get fir_d from log_u
   c3_d fir_d, las_d;
 
-  if ( c3n == u3_lmdb_gulf(log_u->mdb_u, &fir_d, &las_d) ) {
+  if ( c3n == log_u->bak_u->gulf_f(log_u, &fir_d, &las_d) ) {
     fprintf(stderr, "roll: failed to read first/last event numbers\r\n");
     exit(1);
   }
@@ -1773,6 +2603,216 @@ u3_disk_roll(u3_disk* log_u, c3_d eve_d)
   }
 }
 
+#define _DISK_MOVE  1024                //  events per conversion batch
+
+/* _cd_move: event store conversion.
+*/
+struct _cd_move {
+  u3_disk* log_u;
+  c3_o     bok_o;                       //  into the append-only store
+  u3_book* bok_u;                       //  append-only store
+  c3_d     eve_d;                       //  first event in batch
+  c3_d     len_d;                       //  number of events in batch
+  void*    byt_v[_DISK_MOVE];           //  array of bytes
+  size_t   siz_i[_DISK_MOVE];           //  array of lengths
+};
+
+/* _disk_move_save(): write a conversion batch.
+*/
+static c3_o
+_disk_move_save(struct _cd_move* mov_u)
+{
+  c3_o ret_o;
+  c3_d i_d;
+
+  if ( !mov_u->len_d ) {
+    return c3y;
+  }
+
+  ret_o = ( c3y == mov_u->bok_o )
+          ? u3_book_save(mov_u->bok_u, mov_u->eve_d, mov_u->len_d,
+                         mov_u->byt_v, mov_u->siz_i)
+          : u3_lmdb_save(mov_u->log_u->mdb_u, mov_u->eve_d, mov_u->len_d,
+                         mov_u->byt_v, mov_u->siz_i);
+
+  for ( i_d = 0; i_d < mov_u->len_d; i_d++ ) {
+    c3_free(mov_u->byt_v[i_d]);
+  }
+
+  mov_u->eve_d += mov_u->len_d;
+  mov_u->len_d  = 0;
+
+  return ret_o;
+}
+
+/* _disk_move_cb(): buffer an event for conversion.
+*/
+static c3_o
+_disk_move_cb(void* ptr_v, c3_d eve_d, size_t val_i, void* val_p)
+{
+  struct _cd_move* mov_u = ptr_v;
+  c3_y*            byt_y = c3_malloc(val_i);
+
+  memcpy(byt_y, val_p, val_i);
+  mov_u->byt_v[mov_u->len_d] = byt_y;
+  mov_u->siz_i[mov_u->len_d] = val_i;
+  mov_u->len_d++;
+
+  if ( (c3_d)_DISK_MOVE == mov_u->len_d ) {
+    return _disk_move_save(mov_u);
+  }
+
+  return c3y;
+}
+
+/* _disk_sync_dir(): sync a directory.
+*/
+static c3_o
+_disk_sync_dir(const c3_c* pax_c)
+{
+  c3_i dir_i;
+
+  if ( -1 == (dir_i = c3_open(pax_c, O_RDONLY)) ) {
+    fprintf(stderr, "disk: open %s failed: %s\r\n", pax_c, strerror(errno));
+    return c3n;
+  }
+
+  if ( -1 == c3_sync(dir_i) ) {
+    fprintf(stderr, "disk: sync %s failed: %s\r\n", pax_c, strerror(errno));
+    close(dir_i);
+    return c3n;
+  }
+
+  close(dir_i);
+  return c3y;
+}
+
+/* u3_disk_book(): move the latest epoch's events to ([bok_o]) or
+**                 from the append-only event store.
+**
+**   the destination is filled, then installed by an atomic rename;
+**   until then, an interrupted conversion leaves the source intact.
+*/
+c3_o
+u3_disk_book(u3_disk* log_u, c3_o bok_o)
+{
+  c3_c             epo_c[8193], bok_c[8193], tmp_c[8193];
+  c3_d             fir_d, las_d;
+  struct _cd_move* mov_u;
+  c3_o             ret_o;
+
+  if ( bok_o == (( log_u->bok_u ) ? c3y : c3n) ) {
+    fprintf(stderr, "book: epoch 0i%" PRIc3_d " already uses %s\r\n",
+                    log_u->epo_d, ( c3y == bok_o ) ? "book" : "lmdb");
+    return c3y;
+  }
+
+  snprintf(epo_c, sizeof(epo_c), "%s/0i%" PRIc3_d,
+                                 log_u->com_u->pax_c, log_u->epo_d);
+  snprintf(bok_c, sizeof(bok_c), "%s/book", epo_c);
+  snprintf(tmp_c, sizeof(tmp_c), "%s/book.tmp", epo_c);
+
+  if ( c3n == log_u->bak_u->gulf_f(log_u, &fir_d, &las_d) ) {
+    fprintf(stderr, "book: failed to read first/last event numbers\r\n");
+    return c3n;
+  }
+
+  fprintf(stderr, "book: moving events %" PRIu64 "-%" PRIu64
+                  " of epoch 0i%" PRIc3_d " to %s\r\n",
+                  fir_d, las_d, log_u->epo_d,
+                  ( c3y == bok_o ) ? "book" : "lmdb");
+
+  mov_u = c3_calloc(sizeof(*mov_u));
+  mov_u->log_u = log_u;
+  mov_u->bok_o = bok_o;
+  mov_u->eve_d = fir_d;
+
+  if ( c3y == bok_o ) {
+    //  discard any partial copy from an earlier attempt
+    //
+    if (  (0 == access(tmp_c, F_OK))
+       && (c3n == _disk_book_kill(tmp_c)) )
+    {
+      c3_free(mov_u);
+      return c3n;
+    }
+
+    if ( 0 == (mov_u->bok_u = u3_book_init(tmp_c, c3n)) ) {
+      c3_free(mov_u);
+      return c3n;
+    }
+
+    ret_o = ( !las_d ) ? c3y
+          : u3_lmdb_read(log_u->mdb_u, mov_u, fir_d,
+                         (las_d - fir_d) + 1, _disk_move_cb);
+    ret_o = ( c3y == ret_o ) ? _disk_move_save(mov_u) : c3n;
+
+    u3_book_exit(mov_u->bok_u);
+
+    if (  (c3n == ret_o)
+       || rename(tmp_c, bok_c)
+       || (c3n == _disk_sync_dir(epo_c)) )
+    {
+      fprintf(stderr, "book: failed to install %s\r\n", bok_c);
+      _disk_book_kill(tmp_c);
+      c3_free(mov_u);
+      return c3n;
+    }
+
+    //  the lmdb events are now unreachable; reclaim them
+    //
+    if ( c3n == u3_lmdb_wipe(log_u->mdb_u) ) {
+      fprintf(stderr, "book: warning: stale events remain in lmdb\r\n");
+    }
+  }
+  else {
+    //  discard any partial copy from an earlier attempt
+    //
+    if ( c3n == u3_lmdb_wipe(log_u->mdb_u) ) {
+      c3_free(mov_u);
+      return c3n;
+    }
+
+    ret_o = ( !las_d ) ? c3y
+          : u3_book_read(log_u->bok_u, mov_u, fir_d,
+                         (las_d - fir_d) + 1, _disk_move_cb);
+    ret_o = ( c3y == ret_o ) ? _disk_move_save(mov_u) : c3n;
+
+    if ( c3n == ret_o ) {
+      fprintf(stderr, "book: failed to copy events to lmdb\r\n");
+      c3_free(mov_u);
+      return c3n;
+    }
+
+    //  uninstall the append-only store, then delete it
+    //
+    _disk_back_close(log_u);
+
+    if (  rename(bok_c, tmp_c)
+       || (c3n == _disk_sync_dir(epo_c)) )
+    {
+      fprintf(stderr, "book: failed to uninstall %s\r\n", bok_c);
+      c3_free(mov_u);
+      return c3n;
+    }
+
+    _disk_book_kill(tmp_c);
+  }
+
+  c3_free(mov_u);
+
+  _disk_back_close(log_u);
+
+  if ( c3n == _disk_back_open(log_u, epo_c) ) {
+    return c3n;
+  }
+
+  fprintf(stderr, "book: epoch 0i%" PRIc3_d " now uses %s\r\n",
+                  log_u->epo_d, ( log_u->bok_u ) ? "book" : "lmdb");
+
+  return c3y;
+}
+
 typedef enum {
   _epoc_good = 0,  // load successfully
   _epoc_gone = 1,  // version missing, total failure
@@ -1828,12 +2868,21 @@ _disk_epoc_load(u3_disk* log_u, c3_d lat_d)
     return _epoc_fail;
   }
 
-  fprintf(stderr, "disk: loaded epoch 0i%" PRIc3_d "\r\n", lat_d);
+  //  open its event store
+  if ( c3n == _disk_back_open(log_u, epo_c) ) {
+    u3_lmdb_exit(log_u->mdb_u);
+    log_u->mdb_u = 0;
+    return _epoc_fail;
+  }
+
+  fprintf(stderr, "disk: loaded epoch 0i%" PRIc3_d "%s\r\n", lat_d,
+                  ( log_u->bok_u ) ? " (book)" : "");
 
-  //  get first/last event numbers from lmdb
+  //  get first/last event numbers
   c3_d fir_d, las_d;
-  if ( c3n == u3_lmdb_gulf(log_u->mdb_u, &fir_d, &las_d) ) {
+  if ( c3n == log_u->bak_u->gulf_f(log_u, &fir_d, &las_d) ) {
     fprintf(stderr, "disk: failed to get first/last event numbers\r\n");
+    _disk_back_close(log_u);
     u3_lmdb_exit(log_u->mdb_u);
     log_u->mdb_u = 0;
     return _epoc_fail;
@@ -1844,6 +2893,7 @@ _disk_epoc_load(u3_disk* log_u, c3_d lat_d)
      && !las_d
      && (c3n == u3_disk_read_meta(log_u->mdb_u, 0, 0, 0, 0)) )
   {
+    _disk_back_close(log_u);
     u3_lmdb_exit(log_u->mdb_u);
     log_u->mdb_u = 0;
     return _epoc_void;
@@ -1859,6 +2909,58 @@ _disk_epoc_load(u3_disk* log_u, c3_d lat_d)
   return _epoc_good;
 }
 
+/* u3_disk_epoc_view(): open epoch [epo_d] of the pier at [pax_c], unlocked.
+**
+**   for read-only consumers running alongside the lockholder,
+**   such as the workers of `play --verify-epochs`.
+*/
+u3_disk*
+u3_disk_epoc_view(c3_c* pax_c, c3_d epo_d)
+{
+  u3_disk* log_u = c3_calloc(sizeof(*log_u));
+  c3_c     urb_c[8193];
+  c3_c     log_c[8193];
+
+  log_u->lok_i = -1;
+  log_u->liv_o = c3n;
+  log_u->ted_o = c3n;
+  log_u->bak_u = &_disk_back_lmdb;
+
+  snprintf(urb_c, sizeof(urb_c), "%s/.urb", pax_c);
+  snprintf(log_c, sizeof(log_c), "%s/.urb/log", pax_c);
+
+  if (  (0 == (log_u->dir_u = u3_foil_folder(pax_c)))
+     || (0 == (log_u->urb_u = u3_foil_folder(urb_c)))
+     || (0 == (log_u->com_u = u3_foil_folder(log_c))) )
+  {
+    fprintf(stderr, "disk: failed to load event log in %s\r\n", pax_c);
+    goto fail;
+  }
+
+  if ( _epoc_good != _disk_epoc_load(log_u, epo_d) ) {
+    fprintf(stderr, "disk: failed to load epoch 0i%" PRIc3_d "\r\n", epo_d);
+    goto fail;
+  }
+
+  log_u->epo_d = epo_d;
+  log_u->ver_w = U3D_VERLAT;
+
+  return log_u;
+
+fail:
+  if ( log_u->com_u ) {
+    u3_dire_free(log_u->com_u);
+  }
+  if ( log_u->urb_u ) {
+    u3_dire_free(log_u->urb_u);
+  }
+  if ( log_u->dir_u ) {
+    u3_dire_free(log_u->dir_u);
+  }
+  c3_free(log_u);
+  return 0;
+}
+
 /* u3_disk_init(): load or create pier directories and event log.
 */
 u3_disk*
@@ -1870,6 +2972,7 @@ u3_disk_init(c3_c* pax_c, u3_disk_cb cb_u)
   log_u->ted_o = c3n;
   log_u->cb_u  = cb_u;
   log_u->red_u = 0;
+  log_u->bak_u = &_disk_back_lmdb;
   log_u->put_u.ent_u = log_u->put_u.ext_u = 0;
 
   //  create/load pier directory
@@ -1956,6 +3059,19 @@ u3_disk_init(c3_c* pax_c, u3_disk_cb cb_u)
         return 0;
       }
 
+      //  optionally, keep events in the append-only store
+      if ( c3y == u3_Host.ops_u.bok ) {
+        c3_c bok_c[8193];
+        snprintf(bok_c, sizeof(bok_c), "%s/0i0/book", log_c);
+
+        if ( c3_mkdir(bok_c, 0700) && (EEXIST != errno) ) {
+          fprintf(stderr, "disk: create %s failed: %s\r\n",
+                          bok_c, strerror(errno));
+          c3_free(log_u);
+          return 0;
+        }
+      }
+
       if ( _epoc_good != _disk_epoc_load(log_u, 0) ) {
         fprintf(stderr, "disk: failed to initialize lmdb\r\n");
         c3_free(log_u);
@@ -2047,6 +3163,20 @@ try_init:
           //  mark the log as live
           log_u->liv_o = c3y;
 
+          //  train an event dictionary, if wanted and missing
+          if (  (c3y == u3_Host.ops_u.zip)
+             && !log_u->dit_u )
+          {
+            c3_y* dic_y = c3_malloc(u3_dict_max);
+            c3_w  dic_w = _disk_zip_train(log_u, dic_y);
+
+            if ( dic_w ) {
+              _disk_zip_save(log_u, dic_w, dic_y);
+            }
+
+            c3_free(dic_y);
+          }
+
 #if defined(DISK_TRACE_JAM) || defined(DISK_TRACE_CUE)
           u3t_trace_open(pax_c);
 #endif
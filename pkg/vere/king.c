@@ -1706,9 +1706,7 @@ u3_king_grab(void* vod_p)
   all_u[4]->nam_c = "total marked";
   all_u[4]->siz_w = tot_w;
 
-  all_u[5] = c3_calloc(sizeof(*all_u[5]));
-  all_u[5]->nam_c = "sweep";
-  all_u[5]->siz_w = u3a_sweep();
+  all_u[5] = u3a_sweep_quac();
 
   for ( c3_w i_w = 0; i_w < 6; i_w++ ) {
     u3a_print_quac(fil_u, 0, all_u[i_w]);
@@ -90,6 +90,7 @@ _lord_writ_free(u3_writ* wit_u)
       u3_ovum* egg_u = wit_u->wok_u.egg_u;
       u3_auto_drop(egg_u->car_u, egg_u);
       u3z(wit_u->wok_u.job);
+      c3_free(wit_u->wok_u.dat_y);
     } break;
 
     case u3_writ_peek: {
@@ -590,9 +591,13 @@ _lord_work_done(u3_lord* god_u,
                 c3_d     eve_d,
                 c3_l     mug_l,
                 u3_noun    job,
+                size_t   len_i,
+                c3_y*    dat_y,
                 u3_noun    act)
 {
   u3_fact* tac_u = u3_fact_init(eve_d, mug_l, job);
+  tac_u->len_i   = len_i;
+  tac_u->dat_y   = dat_y;
   god_u->mug_l   = mug_l;
   god_u->eve_d   = eve_d;
 
@@ -637,7 +642,7 @@ _lord_plea_work_swap(u3_lord* god_u, u3_ovum* egg_u, u3_noun dat)
   else {
     u3k(job); u3k(act);
     u3z(dat);
-    _lord_work_done(god_u, egg_u, eve_d, mug_l, job, act);
+    _lord_work_done(god_u, egg_u, eve_d, mug_l, job, 0, 0, act);
   }
 }
 
@@ -647,6 +652,8 @@ static void
 _lord_plea_work_done(u3_lord* god_u,
                      u3_ovum* egg_u,
                      u3_noun    job,
+                     size_t   len_i,
+                     c3_y*    dat_y,
                      u3_noun    dat)
 {
   u3_noun eve, mug, act;
@@ -658,6 +665,7 @@ _lord_plea_work_done(u3_lord* god_u,
      || (c3n == u3r_safe_word(mug, &mug_l)) )
   {
     u3z(job);
+    c3_free(dat_y);
     u3_ovum_free(egg_u);
     fprintf(stderr, "lord: invalid %%work\r\n");
     _lord_plea_foul(god_u, c3__done, dat);
@@ -666,7 +674,7 @@ _lord_plea_work_done(u3_lord* god_u,
   else {
     u3k(act);
     u3z(dat);
-    _lord_work_done(god_u, egg_u, eve_d, mug_l, job, act);
+    _lord_work_done(god_u, egg_u, eve_d, mug_l, job, len_i, dat_y, act);
   }
 }
 
@@ -677,16 +685,21 @@ _lord_plea_work(u3_lord* god_u, u3_noun dat)
 {
   u3_ovum* egg_u;
   u3_noun    job;
+  size_t   len_i;
+  c3_y*    dat_y;
 
   {
     u3_writ*  wit_u = _lord_writ_need(god_u, u3_writ_work);
     egg_u = wit_u->wok_u.egg_u;
     job   = wit_u->wok_u.job;
+    len_i = wit_u->wok_u.len_i;
+    dat_y = wit_u->wok_u.dat_y;
     c3_free(wit_u);
   }
 
   if ( c3n == u3a_is_cell(dat) ) {
     u3z(job);
+    c3_free(dat_y);
     u3_ovum_free(egg_u);
     _lord_plea_foul(god_u, c3__work, dat);
     return;
@@ -695,22 +708,25 @@ _lord_plea_work(u3_lord* god_u, u3_noun dat)
   switch ( u3h(dat) ) {
     default: {
       u3z(job);
+      c3_free(dat_y);
       u3_ovum_free(egg_u);
       _lord_plea_foul(god_u, c3__work, dat);
       return;
     } break;
 
     case c3__done: {
-      _lord_plea_work_done(god_u, egg_u, job, u3k(u3t(dat)));
+      _lord_plea_work_done(god_u, egg_u, job, len_i, dat_y, u3k(u3t(dat)));
     } break;
 
     case c3__swap: {
       u3z(job);
+      c3_free(dat_y);
       _lord_plea_work_swap(god_u, egg_u, u3k(u3t(dat)));
     } break;
 
     case c3__bail: {
       u3z(job);
+      c3_free(dat_y);
       _lord_plea_work_bail(god_u, egg_u, u3k(u3t(dat)));
     } break;
   }
@@ -883,7 +899,19 @@ _lord_writ_send(u3_lord* god_u, u3_writ* wit_u)
     u3t_event_trace("king ipc jam", 'B');
 #endif
 
-    u3s_jam_xeno(jar, &len_d, &byt_y);
+    //  jam the job once more, into the event log format,
+    //  sharing the traversal (see _disk_batch())
+    //
+    if ( u3_writ_work == wit_u->typ_e ) {
+      c3_d  dat_d;
+
+      u3s_jam_xeno_twin(jar, 2, 4, &len_d, &byt_y,
+                        &dat_d, &wit_u->wok_u.dat_y);
+      wit_u->wok_u.len_i = dat_d;
+    }
+    else {
+      u3s_jam_xeno(jar, &len_d, &byt_y);
+    }
 
 #ifdef LORD_TRACE_JAM
     u3t_event_trace("king ipc jam", 'E');
@@ -1221,14 +1249,16 @@ u3_lord_init(c3_c* pax_c, c3_w wag_w, c3_d key_d[4], u3_lord_cb cb_u)
   //  spawn new process and connect to it
   //
   {
-    c3_c* arg_c[12];
+    c3_c* arg_c[14];
     c3_c  key_c[256];
     c3_c  wag_c[11];
-    c3_c  hap_c[11];
-    c3_c  per_c[11];
+    c3_c  hap_c[22];
+    c3_c  per_c[22];
     c3_c  cev_c[11];
     c3_c  lom_c[11];
     c3_c  tos_c[11];
+    c3_c  nod_c[11];
+    c3_i  fid_i = -1;
     c3_i  err_i;
 
     sprintf(key_c, "%" PRIx64 ":%" PRIx64 ":%" PRIx64 ":%" PRIx64,
@@ -1239,20 +1269,22 @@ u3_lord_init(c3_c* pax_c, c3_w wag_w, c3_d key_d[4], u3_lord_cb cb_u)
 
     sprintf(wag_c, "%u", god_u->wag_w);
 
-    sprintf(hap_c, "%u", u3_Host.ops_u.hap_w);
+    sprintf(hap_c, "%u:%u", u3_Host.ops_u.hap_w, u3_Host.ops_u.hab_w);
 
-    sprintf(per_c, "%u", u3_Host.ops_u.per_w);
+    sprintf(per_c, "%u:%u", u3_Host.ops_u.per_w, u3_Host.ops_u.peb_w);
 
     sprintf(lom_c, "%u", u3_Host.ops_u.lom_y);
 
     sprintf(tos_c, "%u", u3C.tos_w);
 
+    sprintf(nod_c, "%u", u3C.nod_w);
+
     arg_c[0] = god_u->bin_c;            //  executable
     arg_c[1] = "serf";                  //  protocol
     arg_c[2] = god_u->pax_c;            //  path to checkpoint directory
     arg_c[3] = key_c;                   //  disk key
     arg_c[4] = wag_c;                   //  runtime config
-    arg_c[5] = hap_c;                   //  hash table size
+    arg_c[5] = hap_c;                   //  memo cache entries:MiB
     arg_c[6] = lom_c;                   //  loom bex
 
     if ( u3_Host.ops_u.roc_c ) {
@@ -1273,13 +1305,28 @@ u3_lord_init(c3_c* pax_c, c3_w wag_w, c3_d key_d[4], u3_lord_cb cb_u)
 
     arg_c[9] = tos_c;
     arg_c[10] = per_c;
-    arg_c[11] = NULL;
+    arg_c[11] = nod_c;                  //  loom NUMA node
 
     uv_pipe_init(u3L, &god_u->inn_u.pyp_u, 0);
     uv_timer_init(u3L, &god_u->out_u.tim_u);
     uv_pipe_init(u3L, &god_u->out_u.pyp_u, 0);
     uv_pipe_init(u3L, &god_u->err_u, 0);
 
+    //  offer shared-memory rings, as [FD 3]
+    //
+    if (  (c3y == u3_Host.ops_u.rin)
+       && (0 <= (fid_i = u3_newt_ring_make(&god_u->out_u, &god_u->inn_u, 0))) )
+    {
+      god_u->cod_u[3].flags = UV_INHERIT_FD;
+      god_u->cod_u[3].data.fd = fid_i;
+      arg_c[12] = "3";                  //  shared-memory rings
+    }
+    else {
+      arg_c[12] = "0";
+    }
+
+    arg_c[13] = NULL;
+
     god_u->cod_u[0].flags = UV_CREATE_PIPE | UV_READABLE_PIPE;
     god_u->cod_u[0].data.stream = (uv_stream_t *)&god_u->inn_u;
 
@@ -1290,7 +1337,7 @@ u3_lord_init(c3_c* pax_c, c3_w wag_w, c3_d key_d[4], u3_lord_cb cb_u)
     god_u->cod_u[2].data.stream = (uv_stream_t *)&god_u->err_u;
 
     god_u->ops_u.stdio = god_u->cod_u;
-    god_u->ops_u.stdio_count = 3;
+    god_u->ops_u.stdio_count = ( 0 <= fid_i ) ? 4 : 3;
 
     // if any fds are inherited, libuv ignores UV_PROCESS_WINDOWS_HIDE*
     god_u->ops_u.flags = UV_PROCESS_WINDOWS_HIDE;
@@ -1299,7 +1346,13 @@ u3_lord_init(c3_c* pax_c, c3_w wag_w, c3_d key_d[4], u3_lord_cb cb_u)
     god_u->ops_u.args = arg_c;
 
     /* spawns worker thread */
-    if ( (err_i = uv_spawn(u3L, &god_u->cub_u, &god_u->ops_u)) ) {
+    err_i = uv_spawn(u3L, &god_u->cub_u, &god_u->ops_u);
+
+    if ( 0 <= fid_i ) {
+      close(fid_i);
+    }
+
+    if ( err_i ) {
       fprintf(stderr, "spawn: %s: %s\r\n", arg_c[0], uv_strerror(err_i));
 
       return 0;
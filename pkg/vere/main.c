@@ -15,6 +15,7 @@
 #include "openssl/ssl.h"
 #include "h2o.h"
 #include "curl/curl.h"
+#include "db/book.h"
 #include "db/lmdb.h"
 #include "getopt.h"
 #include "libgen.h"
@@ -33,6 +34,7 @@ static u3_serf        u3V;             //  one serf per process
 static u3_moat      inn_u;             //  input stream
 static u3_mojo      out_u;             //  output stream
 static u3_cue_xeno* sil_u;             //  cue handle
+static uv_idle_t    idl_u;             //  between-writ work
 
 #undef SERF_TRACE_JAM
 #undef SERF_TRACE_CUE
@@ -82,6 +84,42 @@ _main_readw(const c3_c* str_c, c3_w max_w, c3_w* out_w)
   else return c3n;
 }
 
+/* _main_readc(): parse a memo cache limit from a string: a number of
+**                entries, or a budget in MiB with an M (or G) suffix.
+*/
+static c3_o
+_main_readc(const c3_c* str_c, c3_w* ent_w, c3_w* mib_w)
+{
+  c3_c* end_c;
+  c3_d  par_d = strtoull(str_c, &end_c, 0);
+
+  if ( (*str_c == '\0') || (end_c == str_c) ) {
+    return c3n;
+  }
+  else if ( *end_c == '\0' ) {
+    if ( par_d >= 1000000000 ) {
+      return c3n;
+    }
+    *ent_w = par_d;
+    return c3y;
+  }
+  else if ( (('M' == *end_c) || ('G' == *end_c)) && (end_c[1] == '\0') ) {
+    if ( 'G' == *end_c ) {
+      par_d = ( par_d >= 8 ) ? 8192 : (par_d << 10);
+    }
+
+    //  budgets are kept in words, within a direct atom
+    //
+    if ( par_d >= 8192 ) {
+      fprintf(stderr, "error: memo budget must be under 8G\r\n");
+      return c3n;
+    }
+    *mib_w = par_d;
+    return c3y;
+  }
+  else return c3n;
+}
+
 /* _main_readw_loom(): parse loom pointer bit size from a string.
 */
 static c3_i
@@ -179,6 +217,14 @@ _main_init(void)
   u3_Host.ops_u.rep = c3n;
   u3_Host.ops_u.eph = c3n;
   u3_Host.ops_u.tos = c3n;
+  u3_Host.ops_u.pak = c3n;
+  u3_Host.ops_u.sof = c3n;
+  u3_Host.ops_u.asy = c3n;
+  u3_Host.ops_u.hug = c3n;
+  u3_Host.ops_u.num = c3n;
+  u3_Host.ops_u.bok = c3n;
+  u3_Host.ops_u.zip = c3n;
+  u3_Host.ops_u.rin = c3n;
   u3_Host.ops_u.beb = c3n;
   u3_Host.ops_u.tem = c3n;
   u3_Host.ops_u.tex = c3n;
@@ -187,8 +233,12 @@ _main_init(void)
   u3_Host.ops_u.puf_c = "jam";
   u3_Host.ops_u.hap_w = 50000;
   u3C.hap_w = u3_Host.ops_u.hap_w;
+  u3_Host.ops_u.hab_w = 64;     /* MiB */
+  u3C.hab_w = u3_Host.ops_u.hab_w;
   u3_Host.ops_u.per_w = 50000;
   u3C.per_w = u3_Host.ops_u.per_w;
+  u3_Host.ops_u.peb_w = 128;    /* MiB */
+  u3C.peb_w = u3_Host.ops_u.peb_w;
   u3_Host.ops_u.kno_w = DefaultKernel;
 
   u3_Host.ops_u.sap_w = 120;    /* aka 2 minutes */
@@ -311,6 +361,14 @@ _main_getopt(c3_i argc, c3_c** argv)
     { "behn-allow-blocked",  no_argument,       NULL, 10 },
     { "serf-bin",            required_argument, NULL, 11 },
     { "lmdb-map-size",       required_argument, NULL, 12 },
+    { "pack-idle",           no_argument,       NULL, 13 },
+    { "soft-dirty",          no_argument,       NULL, 14 },
+    { "save-async",          no_argument,       NULL, 15 },
+    { "huge-pages",          no_argument,       NULL, 16 },
+    { "numa-node",           required_argument, NULL, 17 },
+    { "event-book",          no_argument,       NULL, 18 },
+    { "log-compress",        no_argument,       NULL, 19 },
+    { "ipc-ring",            no_argument,       NULL, 20 },
     //
     { NULL, 0, NULL, 0 },
   };
@@ -365,6 +423,41 @@ _main_getopt(c3_i argc, c3_c** argv)
 
         break;
       }
+      case 13: { //  pack-idle
+        u3_Host.ops_u.pak = c3y;
+        break;
+      }
+      case 14: { //  soft-dirty
+        u3_Host.ops_u.sof = c3y;
+        break;
+      }
+      case 15: { //  save-async
+        u3_Host.ops_u.asy = c3y;
+        break;
+      }
+      case 16: { //  huge-pages
+        u3_Host.ops_u.hug = c3y;
+        break;
+      }
+      case 17: { //  numa-node
+        u3_Host.ops_u.num = c3y;
+        if ( 1 != sscanf(optarg, "%" SCNu32, &u3C.nod_w) ) {
+          return c3n;
+        }
+        break;
+      }
+      case 18: { //  event-book
+        u3_Host.ops_u.bok = c3y;
+        break;
+      }
+      case 19: { //  log-compress
+        u3_Host.ops_u.zip = c3y;
+        break;
+      }
+      case 20: { //  ipc-ring
+        u3_Host.ops_u.rin = c3y;
+        break;
+      }
       //  special args
       //
       case c3__bloq: {
@@ -427,10 +520,13 @@ _main_getopt(c3_i argc, c3_c** argv)
         break;
       }
       case 'C': {
-        if ( c3n == _main_readw(optarg, 1000000000, &u3_Host.ops_u.hap_w) ) {
+        if ( c3n == _main_readc(optarg, &u3_Host.ops_u.hap_w,
+                                        &u3_Host.ops_u.hab_w) )
+        {
           return c3n;
         }
         u3C.hap_w = u3_Host.ops_u.hap_w;
+        u3C.hab_w = u3_Host.ops_u.hab_w;
         break;
       }
       case 'c': {
@@ -479,10 +575,22 @@ _main_getopt(c3_i argc, c3_c** argv)
         break;
       }
       case 'M': {
-        if ( c3n == _main_readw(optarg, 1000000000, &u3_Host.ops_u.per_w) ) {
+        if ( c3n == _main_readc(optarg, &u3_Host.ops_u.per_w,
+                                        &u3_Host.ops_u.peb_w) )
+        {
           return c3n;
         }
+
+        //  0 means default
+        //
+        if ( !u3_Host.ops_u.per_w ) {
+          u3_Host.ops_u.per_w = 50000;
+        }
+        if ( !u3_Host.ops_u.peb_w ) {
+          u3_Host.ops_u.peb_w = 128;    /* MiB */
+        }
         u3C.per_w = u3_Host.ops_u.per_w;
+        u3C.peb_w = u3_Host.ops_u.peb_w;
         break;
       }
       case 'n': {
@@ -809,6 +917,7 @@ _cw_usage(c3_c* bin_c)
     "  %s queu %.*s<at-event>    cue state:\n",
     "  %s chop %.*s              truncate event log:\n",
     "  %s roll %.*s              rollover to new epoch:\n",
+    "  %s book %.*s              move events to append-only log:\n",
     "  %s vere ARGS <output dir>    download binary:\n",
     "\n  run as a 'serf':\n",
     "    %s serf <pier> <key> <flags> <cache-size> <at-event>"
@@ -844,7 +953,7 @@ u3_ve_usage(c3_i argc, c3_c** argv)
     "-a, --abort                   Abort aggressively\n",
     "-B, --bootstrap PILL          Bootstrap from this pill\n",
     "-b, --http-ip IP              Bind HTTP server to this IP address\n",
-    "-C, --memo-cache-limit LIMIT  Set memo cache max size; 0 means uncapped\n",
+    "-C, --memo-cache-limit LIMIT  Set memo cache max entries, or MiB with M suffix; 0 means uncapped\n",
     "-c, --pier PIER               Create a new urbit in <pier>/\n",
     "-D, --replay                  Recompute from events\n",
     "-d, --daemon                  Daemon mode; implies -t\n",
@@ -862,7 +971,7 @@ u3_ve_usage(c3_i argc, c3_c** argv)
     "-L, --local                   Local networking only\n",
     "    --loom EXPO               Set loom to binary exponent (31 == 2GB)\n"
     "-l, --lite-boot               Most-minimal startup\n",
-    "-M, --keep-cache-limit LIMIT  Set persistent memo cache max size; 0 means default\n",
+    "-M, --keep-cache-limit LIMIT  Set persistent memo cache max entries, or MiB with M suffix; 0 means default\n",
     "-n, --replay-to NUMBER        Replay up to event\n",
     "-P, --profile                 Profiling\n",
     "-p, --ames-port PORT          Set the ames port to bind to\n",
@@ -888,6 +997,14 @@ u3_ve_usage(c3_i argc, c3_c** argv)
     "    --no-dock                 Skip binary \"docking\" on boot\n",
     "    --swap                    Use an explicit ephemeral (swap-like) file\n",
     "    --swap-to FILE            Specify ephemeral file location\n",
+    "    --pack-idle               Compact memory incrementally between events\n",
+    "    --soft-dirty              Track dirty pages with kernel soft-dirty bits\n",
+    "    --save-async              Write snapshots in the background\n",
+    "    --huge-pages              Back the loom with transparent huge pages\n",
+    "    --numa-node NODE          Bind the loom to a NUMA node\n",
+    "    --event-book              Boot with an append-only event log\n",
+    "    --log-compress            Compress events with a trained dictionary\n",
+    "    --ipc-ring                Talk to the serf through shared memory\n",
     "    --prop-file FILE          Add a prop into the boot sequence\n"
     "    --prop-url URL            Download a prop into the boot sequence\n",
     "    --prop-name NAME          Download a prop from bootstrap.urbit.org\n",
@@ -1055,6 +1172,16 @@ _cw_serf_step_trace(void)
   }
 }
 
+/* _cw_serf_idle(): work between commands from the king.
+*/
+static void
+_cw_serf_idle(uv_idle_t* idl_u)
+{
+  if ( c3n == u3_serf_idle(&u3V) ) {
+    uv_idle_stop(idl_u);
+  }
+}
+
 /* _cw_serf_writ(): process a command from the king.
 */
 static void
@@ -1086,6 +1213,10 @@ _cw_serf_writ(void* vod_p, c3_d len_d, c3_y* byt_y)
     //  all references must now be counted, and all roots recorded
     //
     u3_serf_post(&u3V);
+
+    //  continue any background work until the next writ
+    //
+    uv_idle_start(&idl_u, _cw_serf_idle);
   }
 }
 
@@ -1198,10 +1329,30 @@ _cw_serf_commence(c3_i argc, c3_c* argv[])
   c3_c*      eph_c = argv[8];
   c3_c*      tos_c = argv[9];
   c3_c*      per_c = argv[10];
+  c3_c*      nod_c = ( 11 < argc ) ? argv[11] : "0";
+  c3_c*      rin_c = ( 12 < argc ) ? argv[12] : "0";
   c3_w       tos_w;
 
   _cw_init_io(lup_u);
 
+  //  join shared-memory rings, if offered
+  //
+  {
+    c3_i fid_i;
+
+    if ( 1 != sscanf(rin_c, "%d", &fid_i) ) {
+      fprintf(stderr, "serf: ring: invalid descriptor '%s'\r\n", rin_c);
+    }
+    else if ( fid_i ) {
+      if ( c3n == u3_newt_ring_join(&inn_u, &out_u, fid_i) ) {
+        fprintf(stderr, "serf: ring: join failed\r\n");
+        exit(1);
+      }
+
+      close(fid_i);
+    }
+  }
+
   memset(&u3V, 0, sizeof(u3V));
 
   //  load passkey
@@ -1222,10 +1373,14 @@ _cw_serf_commence(c3_i argc, c3_c* argv[])
     //  XX check return
     //
     sscanf(wag_c, "%" SCNu32, &u3C.wag_w);
-    sscanf(hap_c, "%" SCNu32, &u3C.hap_w);
-    sscanf(per_c, "%" SCNu32, &u3C.per_w);
+    sscanf(hap_c, "%" SCNu32 ":%" SCNu32, &u3C.hap_w, &u3C.hab_w);
+    sscanf(per_c, "%" SCNu32 ":%" SCNu32, &u3C.per_w, &u3C.peb_w);
     sscanf(lom_c, "%" SCNu32, &lom_w);
 
+    if ( 1 != sscanf(nod_c, "%" SCNu32, &u3C.nod_w) ) {
+      fprintf(stderr, "serf: numa node: invalid number '%s'\r\n", nod_c);
+    }
+
     if ( 1 != sscanf(tos_c, "%" SCNu32, &u3C.tos_w) ) {
       fprintf(stderr, "serf: toss: invalid number '%s'\r\n", tos_c);
     }
@@ -1293,6 +1448,7 @@ _cw_serf_commence(c3_i argc, c3_c* argv[])
   //  start reading
   //
   u3_newt_read_sync(&inn_u);
+  uv_idle_init(lup_u, &idl_u);
 
   //  enter loop
   //
@@ -1480,6 +1636,7 @@ _cw_eval(c3_i argc, c3_c* argv[])
     uv_pipe_open(&std_u.pyp_u, 1);
 
     std_u.ptr_v = NULL;
+    std_u.rin_u = 0;
     std_u.bal_f = _cw_king_fail;
   }
 
@@ -1706,6 +1863,11 @@ _cw_info(c3_i argc, c3_c* argv[])
   }
 
   u3_lmdb_stat(log_u->mdb_u, stdout);
+
+  if ( log_u->bok_u ) {
+    u3_book_stat(log_u->bok_u, stdout);
+  }
+
   u3_disk_exit(log_u);
 
   u3m_stop();
@@ -2285,6 +2447,8 @@ _cw_pack(c3_i argc, c3_c* argv[])
     { "swap-to",       required_argument, NULL, 8 },
     { "gc-early",      no_argument,       NULL, 9 },
     { "lmdb-map-size", required_argument, NULL, 10 },
+    { "huge-pages",    no_argument,       NULL, 11 },
+    { "numa-node",     required_argument, NULL, 12 },
     { NULL, 0, NULL, 0 }
   };
 
@@ -2327,6 +2491,19 @@ _cw_pack(c3_i argc, c3_c* argv[])
         break;
       }
 
+      case 11: {  //  huge-pages
+        u3C.wag_w |= u3o_huge_page;
+        break;
+      }
+
+      case 12: {  //  numa-node
+        if ( 1 != sscanf(optarg, "%" SCNu32, &u3C.nod_w) ) {
+          exit(1);
+        }
+        u3C.wag_w |= u3o_numa_node;
+        break;
+      }
+
       case '?': {
         fprintf(stderr, "invalid argument\r\n");
         exit(1);
@@ -2531,10 +2708,11 @@ _cw_play_fork_exit(uv_process_t* req_u, c3_ds sat_d, c3_i tem_i) {
 static c3_i
 _cw_play_fork(c3_d eve_d, c3_d sap_d, c3_o mel_o, c3_o sof_o, c3_o ful_o)
 {
-  c3_c *argv[13] = {0};
+  c3_c *argv[17] = {0};
   c3_c eve_c[21] = {0};
   c3_c sap_c[21] = {0};
   c3_c lom_c[3]  = {0};
+  c3_c nod_c[11] = {0};
   c3_i ret_i;
 
   ret_i = snprintf(eve_c, sizeof(eve_c), "%" PRIu64, eve_d);
@@ -2543,6 +2721,8 @@ _cw_play_fork(c3_d eve_d, c3_d sap_d, c3_o mel_o, c3_o sof_o, c3_o ful_o)
   u3_assert( ret_i && ret_i < sizeof(sap_c) );
   ret_i = snprintf(lom_c, sizeof(lom_c), "%u", u3_Host.ops_u.lom_y);
   u3_assert( ret_i && ret_i < sizeof(lom_c) );
+  ret_i = snprintf(nod_c, sizeof(nod_c), "%u", u3C.nod_w);
+  u3_assert( ret_i && ret_i < sizeof(nod_c) );
 
   {
     c3_z    i_z = 0;
@@ -2573,6 +2753,13 @@ _cw_play_fork(c3_d eve_d, c3_d sap_d, c3_o mel_o, c3_o sof_o, c3_o ful_o)
     if _(ful_o) {
       argv[i_z++] = "--full";
     }
+    if ( u3C.wag_w & u3o_huge_page ) {
+      argv[i_z++] = "--huge-pages";
+    }
+    if ( u3C.wag_w & u3o_numa_node ) {
+      argv[i_z++] = "--numa-node";
+      argv[i_z++] = nod_c;
+    }
     if ( !run_i ) {
       argv[i_z++] = u3_Host.dir_c;
     }
@@ -2614,6 +2801,425 @@ _cw_play_fork(c3_d eve_d, c3_d sap_d, c3_o mel_o, c3_o sof_o, c3_o ful_o)
   return uv_run(u3L, UV_RUN_DEFAULT);
 }
 
+/* _cw_vrf_epoc: per-epoch verification worker.
+*/
+typedef struct _cw_vrf_epoc {
+  uv_process_t    pro_u;                //  worker process
+  uv_pipe_t       pin_u;                //  worker stdin
+  struct _cw_vrf* vrf_u;                //  verification
+  c3_d            epo_d;                //  epoch number
+  c3_o            dun_o;                //  finished
+  c3_o            gud_o;                //  replay succeeded
+  c3_d            fir_d;                //  first state (snapshot) event
+  c3_l            fim_l;                //  first state mug
+  c3_d            las_d;                //  last state event
+  c3_l            lam_l;                //  last state mug
+  struct timeval  bef_u;                //  start time
+  c3_d            mil_d;                //  duration in ms
+} _cw_vrf_epoc;
+
+/* _cw_vrf: `play --verify-epochs` coordinator.
+*/
+typedef struct _cw_vrf {
+  c3_z            len_z;                //  number of epochs
+  c3_z            nex_z;                //  next epoch to spawn
+  c3_z            dun_z;                //  epochs finished
+  c3_w            run_w;                //  workers running
+  c3_w            job_w;                //  max workers
+  c3_c*           lom_c;                //  --loom argument
+  c3_c*           nod_c;                //  --numa-node argument
+  _cw_vrf_epoc*   epo_u;                //  epochs, ascending
+} _cw_vrf;
+
+/* _cw_play_vrfy_path(): scratch pier for verifying [epo_d].
+*/
+static void
+_cw_play_vrfy_path(c3_d epo_d, c3_z len_z, c3_c* vrf_c)
+{
+  snprintf(vrf_c, len_z, "%s/.urb/vrf/0i%" PRIc3_d, u3_Host.dir_c, epo_d);
+}
+
+/* _cw_play_vrfy_wipe(): delete the snapshot files in scratch pier [vrf_c].
+*/
+static void
+_cw_play_vrfy_wipe(c3_c* vrf_c)
+{
+  c3_c     chk_c[8193], fil_c[8193];
+  u3_dire* dir_u;
+  u3_dent* den_u;
+
+  snprintf(chk_c, sizeof(chk_c), "%s/.urb/chk", vrf_c);
+
+  if ( !(dir_u = u3_foil_folder(chk_c)) ) {
+    return;
+  }
+
+  for ( den_u = dir_u->all_u; den_u; den_u = den_u->nex_u ) {
+    snprintf(fil_c, sizeof(fil_c), "%s/%s", chk_c, den_u->nam_c);
+    if ( c3_unlink(fil_c) ) {
+      fprintf(stderr, "play: verify: failed to delete %s: %s\r\n",
+                      fil_c, strerror(errno));
+    }
+  }
+
+  u3_dire_free(dir_u);
+  c3_rmdir(chk_c);
+
+  snprintf(chk_c, sizeof(chk_c), "%s/.urb", vrf_c);
+  c3_rmdir(chk_c);
+}
+
+/* _cw_play_vepo(): verification worker, replay epoch [epo_d] in scratch.
+**
+**   boots from a copy of the epoch's snapshot, replays through the
+**   end of the epoch checking every event mug, and records the first
+**   and last state in $vrf/verify.txt for the coordinator.
+*/
+static void
+_cw_play_vepo(c3_d epo_d)
+{
+  c3_c     vrf_c[8193], res_c[8193];
+  c3_d     fir_d;
+  c3_l     fim_l;
+  u3_disk* log_u;
+  FILE*    res_f;
+
+  if ( !(log_u = u3_disk_epoc_view(u3_Host.dir_c, epo_d)) ) {
+    fprintf(stderr, "play: verify: unable to open epoch 0i%" PRIc3_d "\r\n",
+                    epo_d);
+    exit(1);
+  }
+
+  snprintf(vrf_c, sizeof(vrf_c), "%s/.urb/vrf", u3_Host.dir_c);
+  if ( c3_mkdir(vrf_c, 0700) && (EEXIST != errno) ) {
+    fprintf(stderr, "play: verify: mkdir %s: %s\r\n", vrf_c, strerror(errno));
+    exit(1);
+  }
+
+  _cw_play_vrfy_path(epo_d, sizeof(vrf_c), vrf_c);
+  c3_free(u3m_pier(vrf_c));
+
+  //  epoch 0 boots from the lifecycle sequence in its log
+  //
+  if ( epo_d ) {
+    c3_c epo_c[8193], chk_c[8193];
+    snprintf(epo_c, sizeof(epo_c), "%s/0i%" PRIc3_d,
+                                   log_u->com_u->pax_c, epo_d);
+    snprintf(chk_c, sizeof(chk_c), "%s/.urb/chk", vrf_c);
+
+    if ( c3n == u3e_backup(epo_c, chk_c, c3y) ) {
+      fprintf(stderr, "play: verify: failed to copy snapshot of 0i%"
+                      PRIc3_d "\r\n", epo_d);
+      exit(1);
+    }
+  }
+
+  signal(SIGTSTP, _cw_play_exit);
+
+  u3C.wag_w |= u3o_hashless;
+
+  fir_d = u3m_boot(vrf_c, (size_t)1 << u3_Host.ops_u.lom_y);
+
+  if ( fir_d != epo_d ) {
+    fprintf(stderr, "play: verify: epoch 0i%" PRIc3_d
+                    " snapshot is at event %" PRIu64 "\r\n",
+                    epo_d, fir_d);
+    exit(1);
+  }
+
+  fim_l = ( fir_d ) ? u3r_mug(u3A->roc) : 0;
+
+  u3C.slog_f = _cw_play_slog;
+
+  {
+    u3_mars mar_u = {
+      .log_u = log_u,
+      .dir_c = vrf_c,
+      .sen_d = u3A->eve_d,
+      .dun_d = u3A->eve_d,
+    };
+
+    //  exits on any failure, including a mug mismatch
+    //
+    u3_mars_play(&mar_u, 0, 0);
+
+    if ( mar_u.dun_d != log_u->dun_d ) {
+      fprintf(stderr, "play: verify: epoch 0i%" PRIc3_d " stopped at %"
+                      PRIu64 " of %" PRIu64 "\r\n",
+                      epo_d, mar_u.dun_d, log_u->dun_d);
+      exit(1);
+    }
+  }
+
+  snprintf(res_c, sizeof(res_c), "%s/verify.txt", vrf_c);
+
+  if (  !(res_f = fopen(res_c, "w"))
+     || (0 > fprintf(res_f, "%" PRIu64 " %" PRIu32 " %" PRIu64 " %" PRIu32 "\n",
+                            fir_d, fim_l, u3A->eve_d, u3r_mug(u3A->roc)))
+     || fclose(res_f) )
+  {
+    fprintf(stderr, "play: verify: write %s failed: %s\r\n",
+                    res_c, strerror(errno));
+    exit(1);
+  }
+
+  u3_disk_exit(log_u);
+  u3m_stop();
+
+  _cw_play_vrfy_wipe(vrf_c);
+}
+
+/* _cw_play_vrfy_read(): load worker results for [epo_u].
+*/
+static c3_o
+_cw_play_vrfy_read(_cw_vrf_epoc* epo_u)
+{
+  c3_c  vrf_c[8193], res_c[8193];
+  FILE* res_f;
+  c3_i  ret_i;
+
+  _cw_play_vrfy_path(epo_u->epo_d, sizeof(vrf_c), vrf_c);
+  snprintf(res_c, sizeof(res_c), "%s/verify.txt", vrf_c);
+
+  if ( !(res_f = fopen(res_c, "r")) ) {
+    return c3n;
+  }
+
+  ret_i = fscanf(res_f, "%" SCNu64 " %" SCNu32 " %" SCNu64 " %" SCNu32,
+                        &epo_u->fir_d, &epo_u->fim_l,
+                        &epo_u->las_d, &epo_u->lam_l);
+  fclose(res_f);
+
+  if ( 4 != ret_i ) {
+    return c3n;
+  }
+
+  c3_unlink(res_c);
+  c3_rmdir(vrf_c);
+  return c3y;
+}
+
+static void
+_cw_play_vrfy_next(_cw_vrf* vrf_u);
+
+/* _cw_play_vrfy_exit(): verification worker exited.
+*/
+static void
+_cw_play_vrfy_exit(uv_process_t* req_u, c3_ds sat_d, c3_i tem_i)
+{
+  _cw_vrf_epoc* epo_u = req_u->data;
+  _cw_vrf*      vrf_u = epo_u->vrf_u;
+  struct timeval aft_u, dif_u;
+
+  gettimeofday(&aft_u, 0);
+  timersub(&aft_u, &epo_u->bef_u, &dif_u);
+  epo_u->mil_d = (dif_u.tv_sec * 1000ULL) + (dif_u.tv_usec / 1000);
+
+  epo_u->dun_o = c3y;
+  epo_u->gud_o = ( !sat_d && !tem_i ) ? _cw_play_vrfy_read(epo_u) : c3n;
+
+  vrf_u->run_w--;
+  vrf_u->dun_z++;
+
+  if ( c3y == epo_u->gud_o ) {
+    fprintf(stderr, "play: verify: 0i%" PRIc3_d ": ok, events %" PRIu64
+                    "-%" PRIu64 " in %" PRIu64 " ms (%zu/%zu)\r\n",
+                    epo_u->epo_d,
+                    (c3_d)(1ULL + epo_u->fir_d), epo_u->las_d, epo_u->mil_d,
+                    vrf_u->dun_z, vrf_u->len_z);
+  }
+  else {
+    fprintf(stderr, "play: verify: 0i%" PRIc3_d ": failed: %" PRId64
+                    " signal: %d, see .urb/vrf/0i%" PRIc3_d " (%zu/%zu)\r\n",
+                    epo_u->epo_d, sat_d, tem_i, epo_u->epo_d,
+                    vrf_u->dun_z, vrf_u->len_z);
+  }
+
+  uv_close((uv_handle_t*)&epo_u->pin_u, NULL);
+  uv_close((uv_handle_t*)req_u, NULL);
+
+  _cw_play_vrfy_next(vrf_u);
+}
+
+/* _cw_play_vrfy_next(): spawn workers up to the job limit.
+*/
+static void
+_cw_play_vrfy_next(_cw_vrf* vrf_u)
+{
+  while (  (vrf_u->run_w < vrf_u->job_w)
+        && (vrf_u->nex_z < vrf_u->len_z) )
+  {
+    _cw_vrf_epoc*        epo_u = &vrf_u->epo_u[vrf_u->nex_z++];
+    uv_process_options_t opt_u = {0};
+    uv_stdio_container_t sio_u[3];
+    c3_c*                argv[14] = {0};
+    c3_c                 epo_c[21];
+    c3_z                 i_z = 0;
+    c3_i                 sat_i;
+
+    snprintf(epo_c, sizeof(epo_c), "%" PRIu64, epo_u->epo_d);
+
+    argv[i_z++] = u3_Host.wrk_c;
+    argv[i_z++] = "play";
+    argv[i_z++] = "--watch-replay";
+    argv[i_z++] = "--loom";
+    argv[i_z++] = vrf_u->lom_c;
+    argv[i_z++] = "--verify-epoch";
+    argv[i_z++] = epo_c;
+
+    if ( u3C.wag_w & u3o_huge_page ) {
+      argv[i_z++] = "--huge-pages";
+    }
+    if ( u3C.wag_w & u3o_numa_node ) {
+      argv[i_z++] = "--numa-node";
+      argv[i_z++] = vrf_u->nod_c;
+    }
+
+    {
+      c3_c* run_c = _main_pier_run(u3_Host.wrk_c);
+
+      if ( run_c ) {
+        c3_free(run_c);
+      }
+      else {
+        argv[i_z++] = u3_Host.dir_c;
+      }
+    }
+
+    argv[i_z] = NULL;
+    u3_assert( i_z < sizeof(argv) / sizeof(*argv) );
+
+    epo_u->vrf_u = vrf_u;
+    epo_u->pro_u.data = epo_u;
+    uv_pipe_init(u3L, &epo_u->pin_u, 0);
+
+    sio_u[0].data.stream = (uv_stream_t*)&epo_u->pin_u;
+    sio_u[1].data.fd = STDOUT_FILENO;
+    sio_u[2].data.fd = STDERR_FILENO;
+    sio_u[0].flags = UV_CREATE_PIPE | UV_READABLE_PIPE;  //  stdin
+    sio_u[1].flags = UV_INHERIT_FD;                      //  stdout
+    sio_u[2].flags = UV_INHERIT_FD;                      //  stderr
+    opt_u.stdio_count = 3;
+    opt_u.stdio = sio_u;
+    opt_u.file = argv[0];
+    opt_u.args = argv;
+    opt_u.exit_cb = (uv_exit_cb)_cw_play_vrfy_exit;
+
+    gettimeofday(&epo_u->bef_u, 0);
+
+    if ( 0 != (sat_i = uv_spawn(u3L, &epo_u->pro_u, &opt_u)) ) {
+      fprintf(stderr, "play: verify: uv_spawn: %s\r\n", uv_strerror(sat_i));
+      uv_close((uv_handle_t*)&epo_u->pin_u, NULL);
+      epo_u->dun_o = c3y;
+      epo_u->gud_o = c3n;
+      vrf_u->dun_z++;
+      continue;
+    }
+
+    vrf_u->run_w++;
+  }
+}
+
+/* _cw_play_vrfy(): replay every epoch from its own snapshot, in parallel.
+**
+**   each epoch is replayed by a `play --verify-epoch` worker, which
+**   checks every event mug. afterwards, the final state of each epoch
+**   is checked against the snapshot that seeds the next.
+*/
+static void
+_cw_play_vrfy(c3_w job_w)
+{
+  u3_disk*  log_u = _cw_disk_init(u3_Host.dir_c);
+  _cw_vrf   vrf_u = {0};
+  c3_c      lom_c[3]  = {0};
+  c3_c      nod_c[11] = {0};
+  c3_d*     sot_d;
+  c3_z      i_z, bad_z = 0;
+  c3_d      num_d = 0;
+  struct timeval bef_u, aft_u, dif_u;
+
+  snprintf(lom_c, sizeof(lom_c), "%u", u3_Host.ops_u.lom_y);
+  snprintf(nod_c, sizeof(nod_c), "%u", u3C.nod_w);
+
+  vrf_u.len_z = u3_disk_epoc_list(log_u, 0);
+  vrf_u.job_w = c3_max(1, job_w);
+  vrf_u.lom_c = lom_c;
+  vrf_u.nod_c = nod_c;
+
+  if ( !vrf_u.len_z ) {
+    fprintf(stderr, "play: verify: no epochs\r\n");
+    exit(1);
+  }
+
+  //  u3_disk_epoc_list() is descending; verify oldest first
+  //
+  sot_d = c3_malloc(vrf_u.len_z * sizeof(*sot_d));
+  u3_disk_epoc_list(log_u, sot_d);
+  vrf_u.epo_u = c3_calloc(vrf_u.len_z * sizeof(*vrf_u.epo_u));
+
+  for ( i_z = 0; i_z < vrf_u.len_z; i_z++ ) {
+    vrf_u.epo_u[i_z].epo_d = sot_d[vrf_u.len_z - i_z - 1];
+  }
+
+  c3_free(sot_d);
+
+  u3l_log("play: verify: %zu epochs, %u jobs", vrf_u.len_z, vrf_u.job_w);
+
+  gettimeofday(&bef_u, 0);
+
+  u3L = uv_default_loop();
+  _cw_play_vrfy_next(&vrf_u);
+  uv_run(u3L, UV_RUN_DEFAULT);
+
+  gettimeofday(&aft_u, 0);
+  timersub(&aft_u, &bef_u, &dif_u);
+
+  //  check that each epoch ends where its successor's snapshot begins
+  //
+  for ( i_z = 0; i_z < vrf_u.len_z; i_z++ ) {
+    _cw_vrf_epoc* epo_u = &vrf_u.epo_u[i_z];
+    _cw_vrf_epoc* nex_u = ( i_z + 1 < vrf_u.len_z ) ? epo_u + 1 : 0;
+
+    if ( c3n == epo_u->gud_o ) {
+      bad_z++;
+      continue;
+    }
+
+    num_d += epo_u->las_d - epo_u->fir_d;
+
+    if (  nex_u
+       && (c3y == nex_u->gud_o)
+       && (  (epo_u->las_d != nex_u->fir_d)
+          || (epo_u->lam_l != nex_u->fim_l) ) )
+    {
+      fprintf(stderr, "play: verify: 0i%" PRIc3_d ": ends at %" PRIu64
+                      " (mug %x), but 0i%" PRIc3_d " begins at %" PRIu64
+                      " (mug %x)\r\n",
+                      epo_u->epo_d, epo_u->las_d, epo_u->lam_l,
+                      nex_u->epo_d, nex_u->fir_d, nex_u->fim_l);
+      epo_u->gud_o = c3n;
+      bad_z++;
+    }
+  }
+
+  u3l_log("play: verify: %zu of %zu epochs ok, %" PRIu64 " events in %"
+          PRIu64 " s", vrf_u.len_z - bad_z, vrf_u.len_z, num_d,
+          (c3_d)dif_u.tv_sec);
+
+  //  failed epochs leave their scratch piers behind for inspection
+  //
+  if ( !bad_z ) {
+    c3_c vrf_c[8193];
+    snprintf(vrf_c, sizeof(vrf_c), "%s/.urb/vrf", u3_Host.dir_c);
+    c3_rmdir(vrf_c);
+  }
+
+  c3_free(vrf_u.epo_u);
+  u3_disk_exit(log_u);
+
+  exit( bad_z ? 1 : 0 );
+}
+
 /* _cw_play(): replay events, but better.
 */
 static void
@@ -2625,8 +3231,12 @@ _cw_play(c3_i argc, c3_c* argv[])
   c3_o mel_o = c3n;
   c3_o sof_o = c3n;
   c3_o wat_o = c3n;
+  c3_o vrf_o = c3n;
   c3_d eve_d = 0;
   c3_d sap_d = 0;
+  c3_d vep_d = 0;
+  c3_o vep_o = c3n;
+  c3_w job_w = 1;
 
   static struct option lop_u[] = {
     { "loom",              required_argument, NULL, c3__loom },
@@ -2634,7 +3244,12 @@ _cw_play(c3_i argc, c3_c* argv[])
     { "auto-meld",         no_argument,       NULL, 7 },
     { "soft-mugs",         no_argument,       NULL, 8 },
     { "watch-replay",      no_argument,       NULL, 9 },
+    { "huge-pages",        no_argument,       NULL, 10 },
+    { "numa-node",         required_argument, NULL, 11 },
+    { "verify-epochs",     no_argument,       NULL, 12 },
+    { "verify-epoch",      required_argument, NULL, 13 },
     { "full",              no_argument,       NULL, 'f' },
+    { "jobs",              required_argument, NULL, 'j' },
     { "replay-to",         required_argument, NULL, 'n' },
     { "snap-at",           required_argument, NULL, 's' },
     { NULL, 0, NULL, 0 }
@@ -2642,7 +3257,7 @@ _cw_play(c3_i argc, c3_c* argv[])
 
   u3_Host.dir_c = _main_pier_run(argv[0]);
 
-  while ( -1 != (ch_i=getopt_long(argc, argv, "fn:", lop_u, &lid_i)) ) {
+  while ( -1 != (ch_i=getopt_long(argc, argv, "fj:n:", lop_u, &lid_i)) ) {
     switch ( ch_i ) {
       case c3__loom: {
         if (_main_readw_loom("loom", &u3_Host.ops_u.lom_y)) {
@@ -2667,10 +3282,41 @@ _cw_play(c3_i argc, c3_c* argv[])
         wat_o = c3y;
       } break;
 
+      case 10: {  //  huge-pages
+        u3C.wag_w |= u3o_huge_page;
+      } break;
+
+      case 11: {  //  numa-node
+        if ( 1 != sscanf(optarg, "%" SCNu32, &u3C.nod_w) ) {
+          fprintf(stderr, "mars: numa-node invalid: '%s'\r\n", optarg);
+          exit(1);
+        }
+        u3C.wag_w |= u3o_numa_node;
+      } break;
+
+      case 12: {  //  verify-epochs
+        vrf_o = c3y;
+      } break;
+
+      case 13: {  //  verify-epoch
+        if ( 1 != sscanf(optarg, "%" SCNu64, &vep_d) ) {
+          fprintf(stderr, "mars: verify-epoch invalid: '%s'\r\n", optarg);
+          exit(1);
+        }
+        vep_o = c3y;
+      } break;
+
       case 'f': {
         ful_o = c3y;
       } break;
 
+      case 'j': {
+        if ( (1 != sscanf(optarg, "%" SCNu32, &job_w)) || !job_w ) {
+          fprintf(stderr, "mars: jobs invalid: '%s'\r\n", optarg);
+          exit(1);
+        }
+      } break;
+
       case 'n': {
         if ( 1 != sscanf(optarg, "%" PRIu64 "", &eve_d) ) {
           fprintf(stderr, "mars: replay-to invalid: '%s'\r\n", optarg);
@@ -2712,7 +3358,32 @@ _cw_play(c3_i argc, c3_c* argv[])
     exit(1);
   }
 
-  if ( _(wat_o) ) {
+  if (  (_(vrf_o) || _(vep_o))
+     && (eve_d || sap_d || _(ful_o) || _(mel_o) || _(sof_o)) )
+  {
+    fprintf(stderr, "mars: --verify-epochs cannot be combined with "
+                    "--full, --replay-to, --snap-at, --auto-meld or "
+                    "--soft-mugs\r\n");
+    exit(1);
+  }
+
+  if ( _(vrf_o) ) {
+    _cw_play_vrfy(job_w);
+  }
+  else if ( _(vep_o) ) {
+    pthread_t ted;
+
+    if ( _(wat_o) ) {
+      pthread_create(&ted, NULL, _cw_play_fork_heed, NULL);
+    }
+
+    _cw_play_vepo(vep_d);
+
+    if ( _(wat_o) ) {
+      pthread_cancel(ted);
+    }
+  }
+  else if ( _(wat_o) ) {
     pthread_t ted;
     pthread_create(&ted, NULL, _cw_play_fork_heed, NULL);
 
@@ -2959,6 +3630,84 @@ _cw_roll(c3_i argc, c3_c* argv[])
   u3m_stop();
 }
 
+/* _cw_book(): move event log between lmdb and append-only storage
+ */
+static void
+_cw_book(c3_i argc, c3_c* argv[])
+{
+  c3_i ch_i, lid_i;
+  c3_o bok_o = c3y;
+
+  static struct option lop_u[] = {
+    { "loom",          required_argument, NULL, c3__loom },
+    { "lmdb-map-size", required_argument, NULL, 6 },
+    { "lmdb",          no_argument,       NULL, 7 },
+    { NULL, 0, NULL, 0 }
+  };
+
+  u3_Host.dir_c = _main_pier_run(argv[0]);
+
+  while ( -1 != (ch_i=getopt_long(argc, argv, "", lop_u, &lid_i)) ) {
+    switch ( ch_i ) {
+      case 6: {  //  lmdb-map-size
+        if ( 1 != sscanf(optarg, "%" SCNuMAX, &u3_Host.ops_u.siz_i) ) {
+          exit(1);
+        }
+        break;
+      }
+
+      case 7: {  //  lmdb
+        bok_o = c3n;
+      } break;
+
+      case c3__loom: {
+        if (_main_readw_loom("loom", &u3_Host.ops_u.lom_y)) {
+          exit(1);
+        }
+      } break;
+
+      case '?': {
+        fprintf(stderr, "invalid argument\r\n");
+        exit(1);
+      } break;
+    }
+  }
+
+  //  argv[optind] is always "book"
+  //
+
+  if ( !u3_Host.dir_c ) {
+    if ( optind + 1 < argc ) {
+      u3_Host.dir_c = argv[optind + 1];
+    }
+    else {
+      fprintf(stderr, "invalid command, pier required\r\n");
+      exit(1);
+    }
+
+    optind++;
+  }
+
+  if ( optind + 1 != argc ) {
+    fprintf(stderr, "invalid command\r\n");
+    exit(1);
+  }
+
+  // gracefully shutdown the pier if it's running
+  u3_Host.eve_d = u3m_boot(u3_Host.dir_c, (size_t)1 << u3_Host.ops_u.lom_y);
+  u3_disk* log_u = _cw_disk_init(u3_Host.dir_c);
+
+  u3_disk_kindly(log_u, u3_Host.eve_d);
+
+  if ( c3n == u3_disk_book(log_u, bok_o) ) {
+    fprintf(stderr, "book: conversion failed\r\n");
+    exit(1);
+  }
+
+  u3_disk_exit(log_u);
+  u3m_stop();
+}
+
 /* _cw_vere(): download vere
 */
 static void
@@ -3244,6 +3993,7 @@ _cw_utils(c3_i argc, c3_c* argv[])
     case c3__queu: _cw_queu(argc, argv); return 1;
     case c3__chop: _cw_chop(argc, argv); return 1;
     case c3__roll: _cw_roll(argc, argv); return 1;
+    case c3__book: _cw_book(argc, argv); return 1;
     case c3__vere: _cw_vere(argc, argv); return 1;
     case c3__vile: _cw_vile(argc, argv); return 1;
 
@@ -3433,6 +4183,36 @@ main(c3_i   argc,
       if ( _(u3_Host.ops_u.tos) ) {
         u3C.wag_w |= u3o_toss;
       }
+
+      /*  Set incremental compaction flag
+      */
+      if ( _(u3_Host.ops_u.pak) ) {
+        u3C.wag_w |= u3o_pack_idle;
+      }
+
+      /*  Set soft-dirty tracking flag
+      */
+      if ( _(u3_Host.ops_u.sof) ) {
+        u3C.wag_w |= u3o_soft_dirty;
+      }
+
+      /*  Set background snapshot flag
+      */
+      if ( _(u3_Host.ops_u.asy) ) {
+        u3C.wag_w |= u3o_save_async;
+      }
+
+      /*  Set huge page flag
+      */
+      if ( _(u3_Host.ops_u.hug) ) {
+        u3C.wag_w |= u3o_huge_page;
+      }
+
+      /*  Set NUMA binding flag
+      */
+      if ( _(u3_Host.ops_u.num) ) {
+        u3C.wag_w |= u3o_numa_node;
+      }
     }
 
     //  we need the current snapshot's latest event number to
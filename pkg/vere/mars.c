@@ -292,7 +292,11 @@ u3_mars_play(u3_mars* mar_u, c3_d eve_d, c3_d sap_d)
     c3_d  pas_d = mar_u->dun_d;  // last snapshot
     c3_d  mem_d = 0;             // last event to meme
     c3_w  try_w = 0;             // [mem_d] retry count
+    c3_d  fir_d = mar_u->dun_d;  // first event (exclusive)
     c3_c* wen_c;
+    struct timeval bef_u;
+
+    gettimeofday(&bef_u, 0);
 
     while ( mar_u->dun_d < eve_d ) {
       _mars_step_trace(mar_u->dir_c);
@@ -379,6 +383,19 @@ u3_mars_play(u3_mars* mar_u, c3_d eve_d, c3_d sap_d)
         } break;
       }
     }
+
+    {
+      struct timeval aft_u, dif_u;
+      c3_d           num_d = mar_u->dun_d - fir_d;
+      c3_d           mil_d;
+
+      gettimeofday(&aft_u, 0);
+      timersub(&aft_u, &bef_u, &dif_u);
+      mil_d = (dif_u.tv_sec * 1000ULL) + (dif_u.tv_usec / 1000);
+
+      u3l_log("play: %" PRIu64 " events in %" PRIu64 " ms (%" PRIu64 " events/s)",
+              num_d, mil_d, (num_d * 1000) / c3_max(1, mil_d));
+    }
   }
 
   u3l_log("---------------- playback complete ----------------");
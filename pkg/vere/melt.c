@@ -4,6 +4,7 @@
 #include "options.h"
 #include "retrieve.h"
 #include "vortex.h"
+#include "zave.h"
 
 static c3_d
 _melt_hash(u3_noun foo)
@@ -207,8 +208,7 @@ u3_meld_all(FILE *fil_u)
 {
   c3_w pre_w = u3a_open(u3R);
 
-  u3h_free(u3R->cax.per_p);
-  u3R->cax.per_p = u3h_new_cache(u3C.per_w);
+  u3z_free(u3z_memo_keep);
 
   (void)u3_melt_all(fil_u);
   (void)u3m_pack();
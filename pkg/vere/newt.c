@@ -11,10 +11,21 @@
 **
 **  the implementation is relatively inefficient and could
 **  lose a few copies, mallocs, etc.
+**
+**  optionally, a moat/mojo pair may carry the same byte stream
+**  through a pair of shared-memory rings (one each way), made by
+**  one side and joined by the other. the pipes then carry only
+**  one-byte wakeups, sent when the peer has declared itself idle
+**  (for new data) or blocked (for free space), so that a busy
+**  peer costs no syscalls at all. the pipes still signal EOF.
 */
 
 #include "vere.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include "noun.h"
 
 /* _newt_mess_head(): await next msg header.
@@ -188,6 +199,414 @@ u3_newt_decode(u3_moat* mot_u, c3_y* buf_y, c3_d len_d)
   return c3y;
 }
 
+/* _newt_rail: shared state of one ring direction.
+**
+**   each counter is written by one side only, on its own cache line.
+*/
+typedef struct _newt_rail {
+  c3_d hed_d;                           //  bytes produced
+  c3_y pad_y[56];
+  c3_d tal_d;                           //  bytes consumed
+  c3_y paf_y[56];
+  c3_w sle_w;                           //  consumer idle, ring on data
+  c3_w wan_w;                           //  producer blocked, ring on space
+  c3_y pag_y[56];
+} _newt_rail;
+
+/* _newt_shm: shared header, followed by two buffers of cap_d bytes.
+*/
+typedef struct _newt_shm {
+  c3_d       mag_d;                     //  _NEWT_RING_MAG
+  c3_d       cap_d;                     //  buffer size, a power of 2
+  c3_y       pad_y[48];
+  _newt_rail ral_u[2];                  //  maker to joiner, and back
+} _newt_shm;
+
+#define _NEWT_RING_MAG  0x676e6972746e656eULL   //  "newtring"
+#define _NEWT_RING_OFF  4096                    //  buffer offset
+#define _NEWT_RING_CAP  (1ULL << 23)            //  default buffer size
+
+/* _newt_wait: outbound message, awaiting ring space.
+*/
+typedef struct _newt_wait {
+  struct _newt_wait* nex_u;             //  next in queue
+  c3_y*              buf_y;             //  message body
+  c3_d               len_d;             //  body length
+  c3_d               off_d;             //  bytes written, with header
+  c3_y               hed_y[5];          //  header
+} _newt_wait;
+
+/* u3_ring: shared-memory rings, as attached.
+*/
+struct _u3_ring {
+  _newt_shm*  shm_u;                    //  mapping
+  size_t      map_i;                    //  mapping length
+  c3_d        cap_d;                    //  buffer size
+  _newt_rail* inn_u;                    //  inbound rail
+  c3_y*       inb_y;                    //  inbound buffer
+  _newt_rail* out_u;                    //  outbound rail
+  c3_y*       oub_y;                    //  outbound buffer
+  c3_d        hed_d;                    //  outbound bytes written
+  u3_moat*    mot_u;                    //  inbound stream, if open
+  u3_mojo*    moj_u;                    //  outbound stream, if open
+  _newt_wait* ent_u;                    //  pending outbound, last
+  _newt_wait* ext_u;                    //  pending outbound, first
+};
+
+/* _newt_ring_attach(): attach rings at [shm_u] to [mot_u] and [moj_u].
+*/
+static void
+_newt_ring_attach(u3_moat*   mot_u,
+                  u3_mojo*   moj_u,
+                  _newt_shm* shm_u,
+                  size_t     map_i,
+                  c3_o       mak_o)
+{
+  u3_ring* rin_u = c3_calloc(sizeof(*rin_u));
+  c3_y*    buf_y = (c3_y*)shm_u + _NEWT_RING_OFF;
+  c3_w     out_w = ( c3y == mak_o ) ? 0 : 1;
+
+  rin_u->shm_u = shm_u;
+  rin_u->map_i = map_i;
+  rin_u->cap_d = shm_u->cap_d;
+  rin_u->out_u = &shm_u->ral_u[out_w];
+  rin_u->oub_y = buf_y + (out_w * shm_u->cap_d);
+  rin_u->inn_u = &shm_u->ral_u[!out_w];
+  rin_u->inb_y = buf_y + (!out_w * shm_u->cap_d);
+  rin_u->hed_d = rin_u->out_u->hed_d;
+  rin_u->mot_u = mot_u;
+  rin_u->moj_u = moj_u;
+
+  mot_u->rin_u = rin_u;
+  moj_u->rin_u = rin_u;
+}
+
+/* u3_newt_ring_make(): create shared-memory rings of [cap_d] bytes
+**                      each way for [mot_u] and [moj_u], producing
+**                      a descriptor for the peer, or -1.
+*/
+c3_i
+u3_newt_ring_make(u3_moat* mot_u, u3_mojo* moj_u, c3_d cap_d)
+{
+  static c3_w sed_w;
+  _newt_shm*  shm_u;
+  size_t      map_i;
+  c3_c        nam_c[32];
+  c3_i        fid_i;
+
+  if ( !cap_d ) {
+    cap_d = _NEWT_RING_CAP;
+  }
+  else if ( cap_d & (cap_d - 1) ) {
+    cap_d = 1ULL << (64 - __builtin_clzll(cap_d));
+  }
+
+  map_i = _NEWT_RING_OFF + (2 * cap_d);
+
+  //  the object is unlinked at once; only the descriptor names it
+  //
+  snprintf(nam_c, sizeof(nam_c), "/vere-%d-%u", (c3_i)getpid(), sed_w++);
+
+  if ( -1 == (fid_i = shm_open(nam_c, O_RDWR | O_CREAT | O_EXCL, 0600)) ) {
+    fprintf(stderr, "newt: ring open: %s\r\n", strerror(errno));
+    return -1;
+  }
+
+  shm_unlink(nam_c);
+
+  if ( ftruncate(fid_i, map_i) ) {
+    fprintf(stderr, "newt: ring size: %s\r\n", strerror(errno));
+    close(fid_i);
+    return -1;
+  }
+
+  shm_u = mmap(0, map_i, PROT_READ | PROT_WRITE, MAP_SHARED, fid_i, 0);
+
+  if ( MAP_FAILED == shm_u ) {
+    fprintf(stderr, "newt: ring map: %s\r\n", strerror(errno));
+    close(fid_i);
+    return -1;
+  }
+
+  memset(shm_u, 0, sizeof(*shm_u));
+  shm_u->cap_d = cap_d;
+  shm_u->ral_u[0].sle_w = 1;
+  shm_u->ral_u[1].sle_w = 1;
+  __atomic_store_n(&shm_u->mag_d, _NEWT_RING_MAG, __ATOMIC_RELEASE);
+
+  _newt_ring_attach(mot_u, moj_u, shm_u, map_i, c3y);
+
+  return fid_i;
+}
+
+/* u3_newt_ring_join(): attach [mot_u] and [moj_u] to the rings
+**                      at [fid_i], made by the peer.
+*/
+c3_o
+u3_newt_ring_join(u3_moat* mot_u, u3_mojo* moj_u, c3_i fid_i)
+{
+  struct stat buf_u;
+  _newt_shm*  shm_u;
+  size_t      map_i;
+
+  if ( fstat(fid_i, &buf_u) ) {
+    fprintf(stderr, "newt: ring stat: %s\r\n", strerror(errno));
+    return c3n;
+  }
+
+  map_i = buf_u.st_size;
+
+  if ( map_i <= _NEWT_RING_OFF ) {
+    fprintf(stderr, "newt: ring too small\r\n");
+    return c3n;
+  }
+
+  shm_u = mmap(0, map_i, PROT_READ | PROT_WRITE, MAP_SHARED, fid_i, 0);
+
+  if ( MAP_FAILED == shm_u ) {
+    fprintf(stderr, "newt: ring map: %s\r\n", strerror(errno));
+    return c3n;
+  }
+
+  if (  (_NEWT_RING_MAG != __atomic_load_n(&shm_u->mag_d, __ATOMIC_ACQUIRE))
+     || !shm_u->cap_d
+     || (shm_u->cap_d & (shm_u->cap_d - 1))
+     || (map_i != (_NEWT_RING_OFF + (2 * shm_u->cap_d))) )
+  {
+    fprintf(stderr, "newt: ring corrupt\r\n");
+    munmap(shm_u, map_i);
+    return c3n;
+  }
+
+  _newt_ring_attach(mot_u, moj_u, shm_u, map_i, c3n);
+
+  return c3y;
+}
+
+/* _newt_ring_drop(): detach one side, disposing the rings after both.
+*/
+static void
+_newt_ring_drop(u3_ring* rin_u)
+{
+  if ( !rin_u->mot_u && !rin_u->moj_u ) {
+    _newt_wait* wat_u = rin_u->ext_u;
+
+    while ( wat_u ) {
+      _newt_wait* nex_u = wat_u->nex_u;
+      c3_free(wat_u->buf_y);
+      c3_free(wat_u);
+      wat_u = nex_u;
+    }
+
+    munmap(rin_u->shm_u, rin_u->map_i);
+    c3_free(rin_u);
+  }
+}
+
+/* _newt_ring_bell(): wake the peer.
+*/
+static void
+_newt_ring_bell(u3_ring* rin_u)
+{
+  if ( rin_u->moj_u ) {
+    c3_y     bel_y = 0;
+    uv_buf_t buf_u = uv_buf_init((c3_c*)&bel_y, 1);
+
+    //  a full pipe already holds a wakeup, and a broken one
+    //  will be seen as EOF on read
+    //
+    uv_try_write((uv_stream_t*)&rin_u->moj_u->pyp_u, &buf_u, 1);
+  }
+}
+
+/* _newt_ring_put(): copy as much of [len_d] bytes as fits.
+*/
+static c3_d
+_newt_ring_put(u3_ring* rin_u, c3_y* byt_y, c3_d len_d)
+{
+  c3_d tal_d = __atomic_load_n(&rin_u->out_u->tal_d, __ATOMIC_ACQUIRE);
+  c3_d fre_d = rin_u->cap_d - (rin_u->hed_d - tal_d);
+  c3_d cop_d = c3_min(len_d, fre_d);
+  c3_d off_d = rin_u->hed_d & (rin_u->cap_d - 1);
+  c3_d fir_d = c3_min(cop_d, rin_u->cap_d - off_d);
+
+  memcpy(rin_u->oub_y + off_d, byt_y, fir_d);
+  memcpy(rin_u->oub_y, byt_y + fir_d, cop_d - fir_d);
+  rin_u->hed_d += cop_d;
+
+  return cop_d;
+}
+
+/* _newt_ring_post(): publish written bytes, waking an idle peer.
+*/
+static void
+_newt_ring_post(u3_ring* rin_u)
+{
+  __atomic_store_n(&rin_u->out_u->hed_d, rin_u->hed_d, __ATOMIC_RELEASE);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  if ( __atomic_exchange_n(&rin_u->out_u->sle_w, 0, __ATOMIC_SEQ_CST) ) {
+    _newt_ring_bell(rin_u);
+  }
+}
+
+/* _newt_ring_full(): c3y if the ring is still full, having asked
+**                    the peer to wake us on space.
+*/
+static c3_o
+_newt_ring_full(u3_ring* rin_u)
+{
+  c3_d tal_d;
+
+  __atomic_store_n(&rin_u->out_u->wan_w, 1, __ATOMIC_SEQ_CST);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  tal_d = __atomic_load_n(&rin_u->out_u->tal_d, __ATOMIC_ACQUIRE);
+
+  return ( rin_u->cap_d == (rin_u->hed_d - tal_d) ) ? c3y : c3n;
+}
+
+/* _newt_ring_flush(): write pending outbound messages.
+*/
+static void
+_newt_ring_flush(u3_ring* rin_u)
+{
+  _newt_wait* wat_u;
+  c3_o        pos_o = c3n;
+
+  while ( (wat_u = rin_u->ext_u) ) {
+    c3_d tot_d = sizeof(wat_u->hed_y) + wat_u->len_d;
+
+    if ( wat_u->off_d < sizeof(wat_u->hed_y) ) {
+      wat_u->off_d += _newt_ring_put(rin_u, wat_u->hed_y + wat_u->off_d,
+                                     sizeof(wat_u->hed_y) - wat_u->off_d);
+    }
+
+    if ( wat_u->off_d >= sizeof(wat_u->hed_y) ) {
+      c3_d bod_d = wat_u->off_d - sizeof(wat_u->hed_y);
+
+      wat_u->off_d += _newt_ring_put(rin_u, wat_u->buf_y + bod_d,
+                                     wat_u->len_d - bod_d);
+    }
+
+    if ( tot_d == wat_u->off_d ) {
+      pos_o = c3y;
+
+      if ( !(rin_u->ext_u = wat_u->nex_u) ) {
+        rin_u->ent_u = 0;
+      }
+
+      c3_free(wat_u->buf_y);
+      c3_free(wat_u);
+      continue;
+    }
+
+    //  full; publish what we have, and wait for space
+    //
+    _newt_ring_post(rin_u);
+    pos_o = c3n;
+
+    if ( c3y == _newt_ring_full(rin_u) ) {
+      return;
+    }
+  }
+
+  if ( c3y == pos_o ) {
+    _newt_ring_post(rin_u);
+  }
+}
+
+/* _newt_ring_send(): write message to the rings.
+*/
+static void
+_newt_ring_send(u3_ring* rin_u, c3_d len_d, c3_y* byt_y)
+{
+  _newt_wait* wat_u = c3_malloc(sizeof(*wat_u));
+
+  wat_u->nex_u = 0;
+  wat_u->buf_y = byt_y;
+  wat_u->len_d = len_d;
+  wat_u->off_d = 0;
+  wat_u->hed_y[0] = 0x0;
+  wat_u->hed_y[1] = ( len_d        & 0xff);
+  wat_u->hed_y[2] = ((len_d >>  8) & 0xff);
+  wat_u->hed_y[3] = ((len_d >> 16) & 0xff);
+  wat_u->hed_y[4] = ((len_d >> 24) & 0xff);
+
+  if ( rin_u->ent_u ) {
+    rin_u->ent_u->nex_u = wat_u;
+    rin_u->ent_u = wat_u;
+  }
+  else {
+    rin_u->ent_u = rin_u->ext_u = wat_u;
+    _newt_ring_flush(rin_u);
+  }
+}
+
+/* _newt_ring_drain(): decode all inbound bytes; c3y if any.
+*/
+static c3_o
+_newt_ring_drain(u3_ring* rin_u, c3_o* fal_o)
+{
+  c3_d hed_d = __atomic_load_n(&rin_u->inn_u->hed_d, __ATOMIC_ACQUIRE);
+  c3_d tal_d = rin_u->inn_u->tal_d;
+
+  if ( hed_d == tal_d ) {
+    return c3n;
+  }
+
+  while ( tal_d != hed_d ) {
+    c3_d off_d = tal_d & (rin_u->cap_d - 1);
+    c3_d len_d = c3_min(hed_d - tal_d, rin_u->cap_d - off_d);
+
+    if ( c3n == u3_newt_decode(rin_u->mot_u, rin_u->inb_y + off_d, len_d) ) {
+      *fal_o = c3y;
+      return c3n;
+    }
+
+    tal_d += len_d;
+  }
+
+  __atomic_store_n(&rin_u->inn_u->tal_d, tal_d, __ATOMIC_RELEASE);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  if ( __atomic_exchange_n(&rin_u->inn_u->wan_w, 0, __ATOMIC_SEQ_CST) ) {
+    _newt_ring_bell(rin_u);
+  }
+
+  return c3y;
+}
+
+/* _newt_ring_pump(): exchange bytes until idle; c3n on decode failure.
+*/
+static c3_o
+_newt_ring_pump(u3_ring* rin_u)
+{
+  c3_o fal_o = c3n;
+
+  while ( 1 ) {
+    while ( c3y == _newt_ring_drain(rin_u, &fal_o) );
+
+    if ( c3y == fal_o ) {
+      return c3n;
+    }
+
+    _newt_ring_flush(rin_u);
+
+    //  declare ourselves idle, then look again
+    //
+    __atomic_store_n(&rin_u->inn_u->sle_w, 1, __ATOMIC_SEQ_CST);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    if (  (__atomic_load_n(&rin_u->inn_u->hed_d, __ATOMIC_ACQUIRE)
+           == rin_u->inn_u->tal_d)
+       && (  !rin_u->ext_u
+          || (c3y == _newt_ring_full(rin_u)) ) )
+    {
+      return c3y;
+    }
+  }
+}
+
 /* _newt_read(): handle async read result.
 */
 static c3_o
@@ -212,6 +631,17 @@ _newt_read(u3_moat*        mot_u,
     c3_free(buf_u->base);
     return c3n;
   }
+  //  with rings, the pipe carries only wakeups
+  //
+  else if ( mot_u->rin_u ) {
+    c3_free(buf_u->base);
+
+    if ( c3n == _newt_ring_pump(mot_u->rin_u) ) {
+      mot_u->bal_f(mot_u->ptr_v, -1, "newt-decode");
+      return c3n;
+    }
+    return c3y;
+  }
   else {
     if ( c3n == u3_newt_decode(mot_u, (c3_y*)buf_u->base, (c3_d)len_i) ) {
       mot_u->bal_f(mot_u->ptr_v, -1, "newt-decode");
@@ -317,6 +747,12 @@ u3_newt_moat_stop(u3_moat* mot_u, u3_moor_bail bal_f)
   uv_close((uv_handle_t*)&mot_u->pyp_u, _moat_stop_cb);
   uv_close((uv_handle_t*)&mot_u->tim_u, 0);
 
+  if ( mot_u->rin_u ) {
+    mot_u->rin_u->mot_u = 0;
+    _newt_ring_drop(mot_u->rin_u);
+    mot_u->rin_u = 0;
+  }
+
   //  dispose in-process message
   //
   if ( u3_mess_tail == mot_u->mes_u.sat_e ) {
@@ -443,6 +879,12 @@ u3_newt_mojo_stop(u3_mojo* moj_u, u3_moor_bail bal_f)
   }
 
   uv_close((uv_handle_t*)&moj_u->pyp_u, _mojo_stop_cb);
+
+  if ( moj_u->rin_u ) {
+    moj_u->rin_u->moj_u = 0;
+    _newt_ring_drop(moj_u->rin_u);
+    moj_u->rin_u = 0;
+  }
 }
 
 /* u3_newt_send(): write buffer to stream.
@@ -450,7 +892,14 @@ u3_newt_mojo_stop(u3_mojo* moj_u, u3_moor_bail bal_f)
 void
 u3_newt_send(u3_mojo* moj_u, c3_d len_d, c3_y* byt_y)
 {
-  n_req* req_u = c3_malloc(sizeof(*req_u));
+  n_req* req_u;
+
+  if ( moj_u->rin_u ) {
+    _newt_ring_send(moj_u->rin_u, len_d, byt_y);
+    return;
+  }
+
+  req_u = c3_malloc(sizeof(*req_u));
   req_u->moj_u = moj_u;
   req_u->buf_y = byt_y;
 
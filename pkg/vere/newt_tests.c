@@ -335,6 +335,178 @@ _test_newt_vast(void)
   u3z(a);
 }
 
+/* _ring_test: shared-memory ring scenario state.
+*/
+typedef struct _ring_test {
+  u3_moat kin_u;                        //  "king" inbound
+  u3_mojo kou_u;                        //  "king" outbound
+  u3_moat sin_u;                        //  "serf" inbound
+  u3_mojo sou_u;                        //  "serf" outbound
+  c3_w    num_w;                        //  messages expected
+  c3_w    got_w;                        //  messages echoed
+  c3_w    bal_w;                        //  streams closed
+  c3_o    bad_o;                        //  failed
+} _ring_test;
+
+/* _ring_size(): length of test message [i_w].
+*/
+static c3_d
+_ring_size(c3_w i_w)
+{
+  //  some messages much larger than the rings
+  //
+  return ( 0 == (i_w % 16) ) ? (20000 + i_w) : (4 + (i_w * 37) % 700);
+}
+
+/* _ring_fill(): deterministic contents of test message [i_w].
+*/
+static c3_y*
+_ring_fill(c3_w i_w, c3_d len_d)
+{
+  c3_y* byt_y = c3_malloc(len_d);
+  c3_d  j_d;
+
+  for ( j_d = 0; j_d < len_d; j_d++ ) {
+    byt_y[j_d] = (c3_y)(i_w + (j_d * 7));
+  }
+
+  return byt_y;
+}
+
+/* _ring_echo(): "serf" pok_f, echo.
+*/
+static void
+_ring_echo(void* ptr_v, c3_d len_d, c3_y* byt_y)
+{
+  _ring_test* tes_u = ptr_v;
+  c3_y*       cop_y = c3_malloc(len_d);
+
+  memcpy(cop_y, byt_y, len_d);
+  u3_newt_send(&tes_u->sou_u, len_d, cop_y);
+}
+
+/* _ring_take(): "king" pok_f, check echo.
+*/
+static void
+_ring_take(void* ptr_v, c3_d len_d, c3_y* byt_y)
+{
+  _ring_test* tes_u = ptr_v;
+  c3_w        i_w   = tes_u->got_w++;
+  c3_y*       exp_y = _ring_fill(i_w, _ring_size(i_w));
+
+  if (  (len_d != _ring_size(i_w))
+     || memcmp(exp_y, byt_y, len_d) )
+  {
+    fprintf(stderr, "newt ring fail (echo %u)\n", i_w);
+    tes_u->bad_o = c3y;
+  }
+
+  c3_free(exp_y);
+
+  if ( tes_u->got_w == tes_u->num_w ) {
+    uv_stop(tes_u->kin_u.pyp_u.loop);
+  }
+}
+
+/* _ring_bail(): stream failed or closed.
+*/
+static void
+_ring_bail(void* ptr_v, ssize_t err_i, const c3_c* err_c)
+{
+  _ring_test* tes_u = ptr_v;
+
+  if ( -1 != err_i || strlen(err_c) ) {
+    fprintf(stderr, "newt ring fail (bail %s)\n", err_c);
+    tes_u->bad_o = c3y;
+  }
+
+  tes_u->bal_w++;
+}
+
+/* _test_newt_ring(): messages through shared-memory rings.
+*/
+static void
+_test_newt_ring(void)
+{
+  _ring_test tes_u;
+  uv_loop_t  lup_u;
+  c3_i       kin_i[2], sin_i[2];
+  c3_i       fid_i;
+  c3_w       i_w;
+
+  memset(&tes_u, 0, sizeof(tes_u));
+  tes_u.num_w = 64;
+  tes_u.bad_o = c3n;
+
+  uv_loop_init(&lup_u);
+
+  if ( pipe(kin_i) || pipe(sin_i) ) {
+    fprintf(stderr, "newt ring fail (pipe)\n");
+    exit(1);
+  }
+
+  uv_pipe_init(&lup_u, &tes_u.kin_u.pyp_u, 0);
+  uv_pipe_open(&tes_u.kin_u.pyp_u, kin_i[0]);
+  uv_timer_init(&lup_u, &tes_u.kin_u.tim_u);
+  uv_pipe_init(&lup_u, &tes_u.sou_u.pyp_u, 0);
+  uv_pipe_open(&tes_u.sou_u.pyp_u, kin_i[1]);
+
+  uv_pipe_init(&lup_u, &tes_u.sin_u.pyp_u, 0);
+  uv_pipe_open(&tes_u.sin_u.pyp_u, sin_i[0]);
+  uv_timer_init(&lup_u, &tes_u.sin_u.tim_u);
+  uv_pipe_init(&lup_u, &tes_u.kou_u.pyp_u, 0);
+  uv_pipe_open(&tes_u.kou_u.pyp_u, sin_i[1]);
+
+  tes_u.kin_u.ptr_v = tes_u.kou_u.ptr_v = &tes_u;
+  tes_u.sin_u.ptr_v = tes_u.sou_u.ptr_v = &tes_u;
+  tes_u.kin_u.pok_f = _ring_take;
+  tes_u.sin_u.pok_f = _ring_echo;
+  tes_u.kin_u.bal_f = tes_u.kou_u.bal_f = _ring_bail;
+  tes_u.sin_u.bal_f = tes_u.sou_u.bal_f = _ring_bail;
+
+  //  rings much smaller than some messages, to exercise backpressure
+  //
+  if ( 0 > (fid_i = u3_newt_ring_make(&tes_u.kin_u, &tes_u.kou_u, 4000)) ) {
+    fprintf(stderr, "newt ring fail (make)\n");
+    exit(1);
+  }
+
+  if ( c3n == u3_newt_ring_join(&tes_u.sin_u, &tes_u.sou_u, fid_i) ) {
+    fprintf(stderr, "newt ring fail (join)\n");
+    exit(1);
+  }
+
+  close(fid_i);
+
+  u3_newt_read(&tes_u.kin_u);
+  u3_newt_read_sync(&tes_u.sin_u);
+
+  for ( i_w = 0; i_w < tes_u.num_w; i_w++ ) {
+    c3_d len_d = _ring_size(i_w);
+    u3_newt_send(&tes_u.kou_u, len_d, _ring_fill(i_w, len_d));
+  }
+
+  uv_run(&lup_u, UV_RUN_DEFAULT);
+
+  if ( (c3y == tes_u.bad_o) || (tes_u.num_w != tes_u.got_w) ) {
+    fprintf(stderr, "newt ring fail (%u of %u)\n", tes_u.got_w, tes_u.num_w);
+    exit(1);
+  }
+
+  u3_newt_moat_stop(&tes_u.kin_u, 0);
+  u3_newt_mojo_stop(&tes_u.kou_u, 0);
+  u3_newt_moat_stop(&tes_u.sin_u, 0);
+  u3_newt_mojo_stop(&tes_u.sou_u, 0);
+
+  uv_run(&lup_u, UV_RUN_DEFAULT);
+  uv_loop_close(&lup_u);
+
+  if ( (c3y == tes_u.bad_o) || (4 != tes_u.bal_w) ) {
+    fprintf(stderr, "newt ring fail (stop)\n");
+    exit(1);
+  }
+}
+
 /* main(): run all test cases.
 */
 int
@@ -344,6 +516,7 @@ main(int argc, char* argv[])
 
   _test_newt_smol();
   _test_newt_vast();
+  _test_newt_ring();
 
   //  GC
   //
@@ -1,5 +1,6 @@
 /// @file
 
+#include "db/book.h"
 #include "db/lmdb.h"
 #include "ent/ent.h"
 #include "noun.h"
@@ -1907,6 +1908,11 @@ u3_pier_stay(c3_w wag_w, u3_noun pax)
   if ( c3y == u3_Host.ops_u.veb ) {
     FILE* fil_u = u3_term_io_hija();
     u3_lmdb_stat(pir_u->log_u->mdb_u, fil_u);
+
+    if ( pir_u->log_u->bok_u ) {
+      u3_book_stat(pir_u->log_u->bok_u, fil_u);
+    }
+
     u3_term_io_loja(1, fil_u);
   }
 
@@ -2,6 +2,7 @@
 
 #include "noun.h"
 
+#include "events.h"
 #include "vere.h"
 #include "ivory.h"
 #include "ur/ur.h"
@@ -182,7 +183,7 @@ _serf_grab(u3_noun sac, c3_o pri_o)
       u3z(sac);
       return u3_nul;
     } else {
-      u3m_quac** all_u = c3_malloc(sizeof(*all_u) * 11);
+      u3m_quac** all_u = c3_malloc(sizeof(*all_u) * 12);
       all_u[0] = pro_u;
 
       u3m_quac** var_u = u3m_mark();
@@ -209,15 +210,15 @@ _serf_grab(u3_noun sac, c3_o pri_o)
       all_u[7]->nam_c = strdup("free lists");
       all_u[7]->siz_w = u3a_idle(u3R) * 4;
 
-      all_u[8] = c3_calloc(sizeof(*all_u[8]));
-      all_u[8]->nam_c = strdup("sweep");
-      all_u[8]->siz_w = u3a_sweep() * 4;
-      
+      all_u[8] = u3a_sweep_quac();
+
       all_u[9] = c3_calloc(sizeof(*all_u[9]));
       all_u[9]->nam_c = strdup("loom");
       all_u[9]->siz_w = u3C.wor_i * 4;
 
-      all_u[10] = NULL;
+      all_u[10] = u3m_pack_quac();
+
+      all_u[11] = NULL;
 
       if ( c3y == pri_o ) {
         _serf_print_quacs(fil_u, all_u);
@@ -257,7 +258,7 @@ u3_serf_grab(c3_o pri_o)
       sam = u3nt(lyc, c3n, u3nq(c3__once, u3_blip, u3_blip, pax));
     }
 
-    gon = u3m_soft(0, u3v_peek, sam);
+    gon = u3m_soft_sand(0, u3v_peek, sam);
 
     {
       u3_noun tag, dat, val;
@@ -294,6 +295,12 @@ u3_serf_grab(c3_o pri_o)
     u3a_print_memory(stderr, "total marked", tot_w / 4);
     u3a_print_memory(stderr, "free lists", u3a_idle(u3R));
     u3a_print_memory(stderr, "sweep", u3a_sweep());
+
+    {
+      u3m_quac* pac_u = u3m_pack_quac();
+      u3a_print_quac(stderr, 0, pac_u);
+      u3a_quac_free(pac_u);
+    }
     fprintf(stderr, "\r\n");
   }
 
@@ -309,9 +316,9 @@ u3_serf_post(u3_serf* sef_u)
 {
   if ( sef_u->fag_w & _serf_fag_hit1 ) {
     if ( u3C.wag_w & u3o_verbose ) {
-      u3l_log("serf: threshold 1: %u", u3h_wyt(u3R->cax.per_p));
+      u3l_log("serf: threshold 1: %u", u3z_wyt(u3z_memo_keep));
     }
-    u3h_trim_to(u3R->cax.per_p, u3h_wyt(u3R->cax.per_p) / 2);
+    u3z_trim(u3z_memo_keep, u3z_wyt(u3z_memo_keep) / 2);
     u3m_reclaim();
   }
 
@@ -320,7 +327,7 @@ u3_serf_post(u3_serf* sef_u)
   }
 
   if ( sef_u->fag_w & _serf_fag_vega ) {
-    u3h_trim_to(u3R->cax.per_p, u3h_wyt(u3R->cax.per_p) / 2);
+    u3z_trim(u3z_memo_keep, u3z_wyt(u3z_memo_keep) / 2);
     u3m_reclaim();
   }
 
@@ -333,10 +340,9 @@ u3_serf_post(u3_serf* sef_u)
 
   if ( sef_u->fag_w & _serf_fag_hit0 ) {
     if ( u3C.wag_w & u3o_verbose ) {
-      u3l_log("serf: threshold 0: per_p %u", u3h_wyt(u3R->cax.per_p));
+      u3l_log("serf: threshold 0: per_p %u", u3z_wyt(u3z_memo_keep));
     }
-    u3h_free(u3R->cax.per_p);
-    u3R->cax.per_p = u3h_new_cache(u3C.per_w);
+    u3z_free(u3z_memo_keep);
     u3a_print_memory(stderr, "serf: pack: gained", u3m_pack());
     u3l_log("");
   }
@@ -345,9 +351,32 @@ u3_serf_post(u3_serf* sef_u)
     u3m_toss();
   }
 
+  //  reap a finished background snapshot, if any
+  //
+  u3e_wait(c3n);
+
+  //  begin incremental compaction, if fragmented, every 1k events
+  //
+  if (  (u3C.wag_w & u3o_pack_idle)
+     && ((sef_u->dun_d - sef_u->pak_d) >= 1000) )
+  {
+    sef_u->pak_d = sef_u->dun_d;
+    u3m_pack_open();
+  }
+
   sef_u->fag_w = _serf_fag_none;
 }
 
+/* u3_serf_idle(): work between writs, producing c3y if more remains.
+*/
+c3_o
+u3_serf_idle(u3_serf* sef_u)
+{
+  //  2ms slices keep the latency added to the next writ small
+  //
+  return u3m_pack_step(2000);
+}
+
 /* _serf_curb(): check for memory threshold
 */
 static inline c3_t
@@ -883,7 +912,7 @@ u3_serf_peek(u3_serf* sef_u, c3_w mil_w, u3_noun sam)
   }
 
 
-  u3_noun gon = u3m_soft(mil_w, u3v_peek, sam);
+  u3_noun gon = u3m_soft_sand(mil_w, u3v_peek, sam);
   u3_noun pro;
 
   if ( tac_t ) {
@@ -13,6 +13,7 @@
         c3_l    mug_l;             //  hash of state
         c3_w    mas_w;             //  memory threshold state
         c3_w    fag_w;             //  post-op flags
+        c3_d    pak_d;             //  last compaction check
         u3_noun sac;               //  space measurementl
         void  (*xit_f)(void);      //  exit callback
       } u3_serf;
@@ -59,5 +60,10 @@
       u3_noun
       u3_serf_grab(c3_o pri_o);
 
+    /* u3_serf_idle(): work between writs, producing c3y if more remains.
+    */
+      c3_o
+      u3_serf_idle(u3_serf* sef_u);
+
 
 #endif /* ifndef U3_VERE_SERF_H */
@@ -84,10 +84,15 @@
         };
       } u3_mess;
 
+    /* u3_ring: shared-memory message rings (see newt.c).
+    */
+      typedef struct _u3_ring u3_ring;
+
     /* u3_moat: inbound message stream.
     */
       typedef struct _u3_moat {
         uv_pipe_t        pyp_u;             //  input stream
+        u3_ring*         rin_u;             //  shared-memory rings, if any
         u3_moor_bail     bal_f;             //  error response function
         void*            ptr_v;             //  callback pointer
         u3_moor_poke     pok_f;             //  action function
@@ -101,6 +106,7 @@
     */
       typedef struct _u3_mojo {
         uv_pipe_t        pyp_u;             //  output stream
+        u3_ring*         rin_u;             //  shared-memory rings, if any
         u3_moor_bail     bal_f;             //  error response function
         void*            ptr_v;             //  callback pointer
       } u3_mojo;
@@ -108,6 +114,7 @@
     /* u3_moor: two-way message stream, linked list */
       typedef struct _u3_moor {
         uv_pipe_t        pyp_u;             //  duplex stream
+        u3_ring*         rin_u;             //  unused, for u3_moat/u3_mojo
         u3_moor_bail     bal_f;             //  error response function
         void*            ptr_v;             //  callback pointer
         u3_moor_poke     pok_f;             //  action function
@@ -274,6 +281,7 @@
         c3_c*   pil_c;                      //  -B, bootstrap from
         c3_c*   bin_c;                      //  -b, http server bind ip
         c3_w    hap_w;                      //  -C, cap transient memo cache
+        c3_w    hab_w;                      //  -C, transient memo budget (MiB)
         c3_o    dry;                        //  -D, dry compute, no checkpoint
         c3_o    dem;                        //  -d, daemon
         c3_c*   eth_c;                      //  -e, ethereum node url
@@ -292,6 +300,7 @@
         c3_y    lom_y;                      //      loom bex
         c3_y    lut_y;                      //      urth-loom bex
         c3_w    per_w;                      //  -M, cap persistent memo cache
+        c3_w    peb_w;                      //  -M, persistent memo budget (MiB)
         c3_c*   til_c;                      //  -n, play till eve_d
         c3_o    pro;                        //  -P, profile
         c3_s    per_s;                      //      http port
@@ -317,10 +326,18 @@
         c3_o    map;                        //  --no-demand (reversed)
         c3_o    eph;                        //  --swap, use ephemeral file
         c3_o    tos;                        //  --toss, discard ephemeral
+        c3_o    pak;                        //  --pack-idle, compact when idle
+        c3_o    sof;                        //  --soft-dirty, kernel tracking
+        c3_o    asy;                        //  --save-async, background save
+        c3_o    hug;                        //  --huge-pages, THP loom
+        c3_o    num;                        //  --numa-node, bind loom
         u3_even* vex_u;                     //  --prop-*, boot enhancements
 
         c3_o    beb;                        //  --behn-allow-blocked
         c3_z    siz_i;                      //  --lmdb-map-size
+        c3_o    bok;                        //  --event-book, append-only log
+        c3_o    zip;                        //  --log-compress, event dictionary
+        c3_o    rin;                        //  --ipc-ring, shared-memory ipc
         c3_y    jum_y;                      //  jumbo frame size, TODO parser
       } u3_opts;
 
@@ -395,6 +412,8 @@
           c3_d             eve_d;               //  event number
           c3_l             mug_l;               //  kernel mug after
           u3_noun            job;               //  (pair date ovum)
+          size_t           len_i;               //  etched length
+          c3_y*            dat_y;               //  mug slot ++ jam (or 0)
           struct _u3_fact* nex_u;               //  next in queue
         } u3_fact;
 
@@ -474,6 +493,8 @@
             struct {                            //  work:
               u3_ovum*     egg_u;               //    origin
               u3_noun        job;               //    (pair date ovum)
+              size_t       len_i;               //    etched length
+              c3_y*        dat_y;               //    etched job (or 0)
             } wok_u;                            //
             u3_peek*       pek_u;               //  peek
             u3_info        fon_u;               //  recompute
@@ -509,7 +530,7 @@
         typedef struct _u3_lord {
           uv_process_t         cub_u;           //  process handle
           uv_process_options_t ops_u;           //  process configuration
-          uv_stdio_container_t cod_u[3];        //  process options
+          uv_stdio_container_t cod_u[4];        //  process options
           u3_cue_xeno*         sil_u;           //  cue handle
           time_t               wen_t;           //  process creation time
           u3_mojo              inn_u;           //  client's stdin
@@ -557,6 +578,10 @@
           void (*write_bail_f)(void*, c3_d eve_d);
         } u3_disk_cb;
 
+      /* u3_disk_back: opaque event store backend.
+      */
+        typedef struct _u3_disk_back u3_disk_back;
+
       /* u3_disk: manage event persistence.
       */
         typedef struct _u3_disk {
@@ -567,6 +592,9 @@
           c3_o             liv_o;               //  live
           c3_w             ver_w;               //  version (see version.h)
           void*            mdb_u;               //  lmdb env of current epoch
+          u3_disk_back*    bak_u;               //  event store backend
+          void*            bok_u;               //  append-only event store
+          void*            dit_u;               //  event dictionary, if any
           c3_d             sen_d;               //  commit requested
           c3_d             dun_d;               //  committed
           c3_d             epo_d;               //  current epoch number
@@ -1052,6 +1080,11 @@
         c3_z
         u3_disk_epoc_list(u3_disk* log_u, c3_d* sot_d);
 
+      /* u3_disk_epoc_view(): open epoch [epo_d] of the pier at [pax_c], unlocked.
+      */
+        u3_disk*
+        u3_disk_epoc_view(c3_c* pax_c, c3_d epo_d);
+
       /* u3_disk_kindly(): do the needful.
       */
         void
@@ -1067,6 +1100,12 @@
         void
         u3_disk_roll(u3_disk* log_u, c3_d epo_d);
 
+      /* u3_disk_book(): move the latest epoch's events to ([bok_o]) or
+      **                 from the append-only event store.
+      */
+        c3_o
+        u3_disk_book(u3_disk* log_u, c3_o bok_o);
+
       /* u3_disk_read_list(): synchronously read a cons list of events.
       */
         u3_weak
@@ -1372,6 +1411,19 @@
         void
         u3_newt_read(u3_moat* mot_u);
 
+      /* u3_newt_ring_make(): create shared-memory rings of [cap_d] bytes
+      **                      each way for [mot_u] and [moj_u], producing
+      **                      a descriptor for the peer, or -1.
+      */
+        c3_i
+        u3_newt_ring_make(u3_moat* mot_u, u3_mojo* moj_u, c3_d cap_d);
+
+      /* u3_newt_ring_join(): attach [mot_u] and [moj_u] to the rings
+      **                      at [fid_i], made by the peer.
+      */
+        c3_o
+        u3_newt_ring_join(u3_moat* mot_u, u3_mojo* moj_u, c3_i fid_i);
+
       /* u3_newt_moat_info(): status info as $mass.
       */
         u3_noun
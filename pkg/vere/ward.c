@@ -87,6 +87,8 @@ u3_fact_init(c3_d eve_d, c3_l mug_l, u3_noun job)
   tac_u->mug_l = mug_l;
   tac_u->nex_u = 0;
   tac_u->job   = job;
+  tac_u->len_i = 0;
+  tac_u->dat_y = 0;
 
   return tac_u;
 }
@@ -97,6 +99,7 @@ void
 u3_fact_free(u3_fact *tac_u)
 {
   u3z(tac_u->job);
+  c3_free(tac_u->dat_y);
   c3_free(tac_u);
 }
 